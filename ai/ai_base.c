@@ -110,16 +110,16 @@ void AI_Stand (edict_t *self, float dist)
 	if (dist)
 		AI_MoveWalk (self, self->s.angles[YAW], dist);
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		if (self->enemy)
 		{
 			VectorSubtract3 (self->enemy->s.origin, self->s.origin, v);
 			self->ideal_yaw = vectoyaw(v);
-			if (self->s.angles[YAW] != self->ideal_yaw && self->monsterinfo.aiflags & AI_TEMP_STAND_GROUND)
+			if (self->s.angles[YAW] != self->ideal_yaw && self->monsterinfo->aiflags & AI_TEMP_STAND_GROUND)
 			{
-				self->monsterinfo.aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
-				self->monsterinfo.run (self);
+				self->monsterinfo->aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
+				self->monsterinfo->run (self);
 			}
 			AI_ChangeYaw (self);
 			AI_CheckForAttack (self, 0);
@@ -132,22 +132,22 @@ void AI_Stand (edict_t *self, float dist)
 	if (AI_FindTarget (self))
 		return;
 	
-	if (level.time > self->monsterinfo.pausetime)
+	if (level.time > self->monsterinfo->pausetime)
 	{
-		self->monsterinfo.walk (self);
+		self->monsterinfo->walk (self);
 		return;
 	}
 
-	if (!(self->spawnflags & 1) && (self->monsterinfo.idle) && (level.time > self->monsterinfo.idle_time))
+	if (!(self->spawnflags & 1) && (self->monsterinfo->idle) && (level.time > self->monsterinfo->idle_time))
 	{
-		if (self->monsterinfo.idle_time)
+		if (self->monsterinfo->idle_time)
 		{
-			self->monsterinfo.idle (self);
-			self->monsterinfo.idle_time = level.time + 15 + random() * 15;
+			self->monsterinfo->idle (self);
+			self->monsterinfo->idle_time = level.time + 15 + random() * 15;
 		}
 		else
 		{
-			self->monsterinfo.idle_time = level.time + random() * 15;
+			self->monsterinfo->idle_time = level.time + random() * 15;
 		}
 	}
 }
@@ -168,24 +168,24 @@ void AI_Walk (edict_t *self, float dist)
 	if (AI_FindTarget (self))
 		return;
 
-	if ((self->monsterinfo.search) && (level.time > self->monsterinfo.idle_time))
+	if ((self->monsterinfo->search) && (level.time > self->monsterinfo->idle_time))
 	{
-		if (self->monsterinfo.idle_time)
+		if (self->monsterinfo->idle_time)
 		{
-			self->monsterinfo.search (self);
-			self->monsterinfo.idle_time = level.time + 15 + random() * 15;
+			self->monsterinfo->search (self);
+			self->monsterinfo->idle_time = level.time + 15 + random() * 15;
 		}
 		else
 		{
-			self->monsterinfo.idle_time = level.time + random() * 15;
+			self->monsterinfo->idle_time = level.time + random() * 15;
 		}
 	}
-	else if (!self->monsterinfo.search
-		&& self->monsterinfo.aiflags & AI_WANDER)
+	else if (!self->monsterinfo->search
+		&& self->monsterinfo->aiflags & AI_WANDER)
 	{
 		// if we haven't moved long enough yet to change wander
 
-		if (self->monsterinfo.wander_steps > self->monsterinfo.wander_steps_total)
+		if (self->monsterinfo->wander_steps > self->monsterinfo->wander_steps_total)
 		{
 			// walk in a random direction
 			self->ideal_yaw = rand() % 360;
@@ -193,22 +193,22 @@ void AI_Walk (edict_t *self, float dist)
 			AI_ChangeYaw(self);
 
 			// generate a number from zero to highest wand erstuep
-			self->monsterinfo.wander_steps_total = rand() % (self->monsterinfo.wander_steps_max + 1);
+			self->monsterinfo->wander_steps_total = rand() % (self->monsterinfo->wander_steps_max + 1);
 
 			// if it's lower than the minimu
-			while (self->monsterinfo.wander_steps_total < self->monsterinfo.wander_steps_min)
+			while (self->monsterinfo->wander_steps_total < self->monsterinfo->wander_steps_min)
 			{
-				self->monsterinfo.wander_steps_total = rand() % (self->monsterinfo.wander_steps_max + 1);
+				self->monsterinfo->wander_steps_total = rand() % (self->monsterinfo->wander_steps_max + 1);
 			}
 
-			self->monsterinfo.wander_steps = 0;
+			self->monsterinfo->wander_steps = 0;
 		}
 
 
 		// wander randomly
 		AI_MoveWalk(self, self->ideal_yaw, dist);
 
-		self->monsterinfo.wander_steps++;
+		self->monsterinfo->wander_steps++;
 	}
 }
 
@@ -324,7 +324,7 @@ bool Edict_CanSee (edict_t *self, edict_t *other)
 	spot1[2] += self->viewheight;
 	VectorCopy3 (other->s.origin, spot2);
 	spot2[2] += other->viewheight;
-	trace = gi.trace (spot1, vec3_origin, vec3_origin, spot2, self, MASK_OPAQUE);
+	trace = Game_Trace (spot1, vec3_origin, vec3_origin, spot2, self, MASK_OPAQUE);
 	
 	if (trace.fraction == 1.0)
 		return true;
@@ -363,14 +363,14 @@ void AI_HuntTarget (edict_t *self)
 	vec3_t	vec;
 
 	self->goalentity = self->enemy;
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
-		self->monsterinfo.stand (self);
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
+		self->monsterinfo->stand (self);
 	else
-		self->monsterinfo.run (self);
+		self->monsterinfo->run (self);
 	VectorSubtract3 (self->enemy->s.origin, self->s.origin, vec);
 	self->ideal_yaw = vectoyaw(vec);
 	// wait a while before first attack
-	if (!(self->monsterinfo.aiflags & AI_STAND_GROUND))
+	if (!(self->monsterinfo->aiflags & AI_STAND_GROUND))
 		AI_AttackFinished (self, 1);
 }
 
@@ -386,8 +386,8 @@ void AI_FoundTarget (edict_t *self)
 
 	self->show_hostile = level.time + 1;		// wake up other monsters
 
-	VectorCopy3(self->enemy->s.origin, self->monsterinfo.last_sighting);
-	self->monsterinfo.trail_time = level.time;
+	VectorCopy3(self->enemy->s.origin, self->monsterinfo->last_sighting);
+	self->monsterinfo->trail_time = level.time;
 
 	if (!self->combattarget)
 	{
@@ -406,14 +406,14 @@ void AI_FoundTarget (edict_t *self)
 
 	// clear out our combattarget, these are a one shot deal
 	self->combattarget = NULL;
-	self->monsterinfo.aiflags |= AI_COMBAT_POINT;
+	self->monsterinfo->aiflags |= AI_COMBAT_POINT;
 
 	// clear the targetname, that point is ours!
-	self->movetarget->targetname = NULL;
-	self->monsterinfo.pausetime = 0;
+	Edict_SetTargetname(self->movetarget, NULL);
+	self->monsterinfo->pausetime = 0;
 
 	// run for it
-	self->monsterinfo.run (self);
+	self->monsterinfo->run (self);
 }
 
 
@@ -429,22 +429,23 @@ When a player fires a missile, the point of impact becomes a fakeplayer so
 that monsters that see the impact will respond as if they had seen the
 player.
 
-To avoid spending too much time, only a single client (or fakeclient) is
-checked each frame.  This means multi player games will have slightly
-slower noticing monsters.
+The clients the monster can see come from the sight pass (AI_UpdateSight).
+If it ran out of budget before reaching this monster, only a single client
+(or fakeclient) is checked, which means multi player games will have
+slightly slower noticing monsters.
 ============
 */
 bool AI_FindTarget (edict_t *self)
 {
 	edict_t*	client;
-	bool		heardit;
+	bool		heardit, sighted;
 	int32_t		r;
 
-	if (self->monsterinfo.aiflags & AI_GOOD_GUY)
+	if (self->monsterinfo->aiflags & AI_GOOD_GUY)
 	{
-		if (self->goalentity && self->goalentity->inuse && self->goalentity->classname)
+		if (self->goalentity && self->goalentity->inuse)
 		{
-			if (strcmp(self->goalentity->classname, "target_actor") == 0)
+			if (self->goalentity->classid == CLASS_TARGET_ACTOR)
 				return false;
 		}
 
@@ -453,7 +454,7 @@ bool AI_FindTarget (edict_t *self)
 	}
 
 	// if we're going to a combat point, just proceed
-	if (self->monsterinfo.aiflags & AI_COMBAT_POINT)
+	if (self->monsterinfo->aiflags & AI_COMBAT_POINT)
 		return false;
 
 // if the first spawnflag bit is set, the monster will only wake up on
@@ -464,6 +465,7 @@ bool AI_FindTarget (edict_t *self)
 // but not weapon impact/explosion noises
 
 	heardit = false;
+	sighted = false;
 	if ((level.sight_entity_framenum >= (level.framenum - 1)) && !(self->spawnflags & 1) )
 	{
 		client = level.sight_entity;
@@ -484,7 +486,11 @@ bool AI_FindTarget (edict_t *self)
 	}
 	else
 	{
-		client = level.sight_client;
+		client = AI_PickSightClient(self, &sighted);
+
+		if (!sighted)
+			client = level.sight_client;
+
 		if (!client)
 			return false;	// no clients to get mad at
 	}
@@ -525,42 +531,46 @@ bool AI_FindTarget (edict_t *self)
 
 	if (!heardit)
 	{
-		r = AI_GetRange (self, client);
-
-		if (r == RANGE_FAR)
-			return false;
+		// the sight pass has already made these checks
+		if (!sighted)
+		{
+			r = AI_GetRange (self, client);
 
-		// this is where we would check invisibility
+			if (r == RANGE_FAR)
+				return false;
 
-		// is client in an spot too dark to be seen?
-		if (client->light_level <= 5)
-			return false;
+			// this is where we would check invisibility
 
-		if (!Edict_CanSee (self, client))
-		{
-			return false;
-		}
+			// is client in an spot too dark to be seen?
+			if (client->light_level <= 5)
+				return false;
 
-		if (r == RANGE_NEAR)
-		{
-			if (client->show_hostile < level.time && !Edict_IsInFront (self, client))
+			if (!Edict_CanSee (self, client))
 			{
 				return false;
 			}
-		}
-		else if (r == RANGE_MID)
-		{
-			if (!Edict_IsInFront (self, client))
+
+			if (r == RANGE_NEAR)
 			{
-				return false;
+				if (client->show_hostile < level.time && !Edict_IsInFront (self, client))
+				{
+					return false;
+				}
+			}
+			else if (r == RANGE_MID)
+			{
+				if (!Edict_IsInFront (self, client))
+				{
+					return false;
+				}
 			}
 		}
 
 		self->enemy = client;
 
-		if (strcmp(self->enemy->classname, "player_noise") != 0)
+		if (self->enemy->classid != CLASS_PLAYER_NOISE)
 		{
-			self->monsterinfo.aiflags &= ~AI_SOUND_TARGET;
+			self->monsterinfo->aiflags &= ~AI_SOUND_TARGET;
 
 			if (!self->enemy->client)
 			{
@@ -604,7 +614,7 @@ bool AI_FindTarget (edict_t *self)
 		AI_ChangeYaw (self);
 
 		// hunt the sound for a bit; hopefully find the real player
-		self->monsterinfo.aiflags |= AI_SOUND_TARGET;
+		self->monsterinfo->aiflags |= AI_SOUND_TARGET;
 		self->enemy = client;
 	}
 
@@ -613,8 +623,8 @@ bool AI_FindTarget (edict_t *self)
 //
 	AI_FoundTarget (self);
 
-	if (!(self->monsterinfo.aiflags & AI_SOUND_TARGET) && (self->monsterinfo.sight))
-		self->monsterinfo.sight (self, self->enemy);
+	if (!(self->monsterinfo->aiflags & AI_SOUND_TARGET) && (self->monsterinfo->sight))
+		self->monsterinfo->sight (self, self->enemy);
 
 	return true;
 }
@@ -655,7 +665,7 @@ bool AI_CheckAttack (edict_t *self)
 		VectorCopy3 (self->enemy->s.origin, spot2);
 		spot2[2] += self->enemy->viewheight;
 
-		tr = gi.trace (spot1, NULL, NULL, spot2, self, CONTENTS_SOLID|CONTENTS_MONSTER|CONTENTS_SLIME|CONTENTS_LAVA|CONTENTS_WINDOW);
+		tr = Game_Trace (spot1, NULL, NULL, spot2, self, CONTENTS_SOLID|CONTENTS_MONSTER|CONTENTS_SLIME|CONTENTS_LAVA|CONTENTS_WINDOW);
 
 		// do we have a clear shot?
 		if (tr.ent != self->enemy)
@@ -668,24 +678,24 @@ bool AI_CheckAttack (edict_t *self)
 		// don't always melee in easy mode
 		if (skill->value == 0 && (rand()&3) )
 			return false;
-		if (self->monsterinfo.melee)
-			self->monsterinfo.attack_state = AS_MELEE;
+		if (self->monsterinfo->melee)
+			self->monsterinfo->attack_state = AS_MELEE;
 		else
-			self->monsterinfo.attack_state = AS_MISSILE;
+			self->monsterinfo->attack_state = AS_MISSILE;
 		return true;
 	}
 	
 // missile attack
-	if (!self->monsterinfo.attack)
+	if (!self->monsterinfo->attack)
 		return false;
 		
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < self->monsterinfo->attack_finished)
 		return false;
 		
 	if (enemy_range == RANGE_FAR)
 		return false;
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		chance = 0.4;
 	}
@@ -713,17 +723,17 @@ bool AI_CheckAttack (edict_t *self)
 
 	if (random () < chance)
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
-		self->monsterinfo.attack_finished = level.time + 2*random();
+		self->monsterinfo->attack_state = AS_MISSILE;
+		self->monsterinfo->attack_finished = level.time + 2*random();
 		return true;
 	}
 
 	if (self->flags & FL_FLY)
 	{
 		if (random() < 0.3)
-			self->monsterinfo.attack_state = AS_SLIDING;
+			self->monsterinfo->attack_state = AS_SLIDING;
 		else
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+			self->monsterinfo->attack_state = AS_STRAIGHT;
 	}
 
 	return false;
@@ -744,8 +754,8 @@ void AI_RunMelee(edict_t *self)
 
 	if (AI_FacingIdeal(self))
 	{
-		self->monsterinfo.melee (self);
-		self->monsterinfo.attack_state = AS_STRAIGHT;
+		self->monsterinfo->melee (self);
+		self->monsterinfo->attack_state = AS_STRAIGHT;
 	}
 }
 
@@ -764,8 +774,8 @@ void AI_RunMissile(edict_t *self)
 
 	if (AI_FacingIdeal(self))
 	{
-		self->monsterinfo.attack (self);
-		self->monsterinfo.attack_state = AS_STRAIGHT;
+		self->monsterinfo->attack (self);
+		self->monsterinfo->attack_state = AS_STRAIGHT;
 	}
 };
 
@@ -784,7 +794,7 @@ void AI_RunSlide(edict_t *self, float distance)
 	self->ideal_yaw = enemy_yaw;
 	AI_ChangeYaw (self);
 
-	if (self->monsterinfo.lefty)
+	if (self->monsterinfo->lefty)
 		ofs = 90;
 	else
 		ofs = -90;
@@ -792,7 +802,7 @@ void AI_RunSlide(edict_t *self, float distance)
 	if (AI_MoveWalk (self, self->ideal_yaw + ofs, distance))
 		return;
 		
-	self->monsterinfo.lefty = 1 - self->monsterinfo.lefty;
+	self->monsterinfo->lefty = 1 - self->monsterinfo->lefty;
 	AI_MoveWalk (self, self->ideal_yaw - ofs, distance);
 }
 
@@ -813,10 +823,10 @@ bool AI_CheckForAttack (edict_t *self, float dist)
 // this causes monsters to run blindly to the combat point w/o firing
 	if (self->goalentity)
 	{
-		if (self->monsterinfo.aiflags & AI_COMBAT_POINT)
+		if (self->monsterinfo->aiflags & AI_COMBAT_POINT)
 			return false;
 
-		if (self->monsterinfo.aiflags & AI_SOUND_TARGET)
+		if (self->monsterinfo->aiflags & AI_SOUND_TARGET)
 		{
 			if ((level.time - self->enemy->teleport_time) > 5.0)
 			{
@@ -825,9 +835,9 @@ bool AI_CheckForAttack (edict_t *self, float dist)
 						self->goalentity = self->movetarget;
 					else
 						self->goalentity = NULL;
-				self->monsterinfo.aiflags &= ~AI_SOUND_TARGET;
-				if (self->monsterinfo.aiflags & AI_TEMP_STAND_GROUND)
-					self->monsterinfo.aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
+				self->monsterinfo->aiflags &= ~AI_SOUND_TARGET;
+				if (self->monsterinfo->aiflags & AI_TEMP_STAND_GROUND)
+					self->monsterinfo->aiflags &= ~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
 			}
 			else
 			{
@@ -845,17 +855,17 @@ bool AI_CheckForAttack (edict_t *self, float dist)
 	{
 		hesDeadJim = true;
 	}
-	else if (self->monsterinfo.aiflags & AI_MEDIC)
+	else if (self->monsterinfo->aiflags & AI_MEDIC)
 	{
 		if (self->enemy->health > 0)
 		{
 			hesDeadJim = true;
-			self->monsterinfo.aiflags &= ~AI_MEDIC;
+			self->monsterinfo->aiflags &= ~AI_MEDIC;
 		}
 	}
 	else
 	{
-		if (self->monsterinfo.aiflags & AI_BRUTAL)
+		if (self->monsterinfo->aiflags & AI_BRUTAL)
 		{
 			if (self->enemy->health <= -80)
 				hesDeadJim = true;
@@ -882,7 +892,7 @@ bool AI_CheckForAttack (edict_t *self, float dist)
 			if (self->movetarget)
 			{
 				self->goalentity = self->movetarget;
-				self->monsterinfo.walk (self);
+				self->monsterinfo->walk (self);
 			}
 			else
 			{
@@ -890,8 +900,8 @@ bool AI_CheckForAttack (edict_t *self, float dist)
 				// will just revert to walking with no target and
 				// the monsters will wonder around aimlessly trying
 				// to hunt the world entity
-				self->monsterinfo.pausetime = level.time + 100000000;
-				self->monsterinfo.stand (self);
+				self->monsterinfo->pausetime = level.time + 100000000;
+				self->monsterinfo->stand (self);
 			}
 			return true;
 		}
@@ -903,12 +913,12 @@ bool AI_CheckForAttack (edict_t *self, float dist)
 	enemy_vis = Edict_CanSee(self, self->enemy);
 	if (enemy_vis)
 	{
-		self->monsterinfo.search_time = level.time + 5;
-		VectorCopy3 (self->enemy->s.origin, self->monsterinfo.last_sighting);
+		self->monsterinfo->search_time = level.time + 5;
+		VectorCopy3 (self->enemy->s.origin, self->monsterinfo->last_sighting);
 	}
 
 // look for other coop players here
-//	if (coop && self->monsterinfo.search_time < level.time)
+//	if (coop && self->monsterinfo->search_time < level.time)
 //	{
 //		if (FindTarget (self))
 //			return true;
@@ -921,12 +931,12 @@ bool AI_CheckForAttack (edict_t *self, float dist)
 
 	// JDC self->ideal_yaw = enemy_yaw;
 
-	if (self->monsterinfo.attack_state == AS_MISSILE)
+	if (self->monsterinfo->attack_state == AS_MISSILE)
 	{
 		AI_RunMissile (self);
 		return true;
 	}
-	if (self->monsterinfo.attack_state == AS_MELEE)
+	if (self->monsterinfo->attack_state == AS_MELEE)
 	{
 		AI_RunMelee (self);
 		return true;
@@ -936,7 +946,7 @@ bool AI_CheckForAttack (edict_t *self, float dist)
 	if (!enemy_vis)
 		return false;
 
-	return self->monsterinfo.checkattack (self);
+	return self->monsterinfo->checkattack (self);
 }
 
 
@@ -959,21 +969,22 @@ void AI_Run (edict_t *self, float dist)
 	vec3_t		v_forward, v_right;
 	float		left, center, right;
 	vec3_t		left_target, right_target;
+	vec3_t		waypoint;
 
 	// if we're going to a combat point, just proceed
-	if (self->monsterinfo.aiflags & AI_COMBAT_POINT)
+	if (self->monsterinfo->aiflags & AI_COMBAT_POINT)
 	{
 		AI_MoveToGoal (self, dist);
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_SOUND_TARGET)
+	if (self->monsterinfo->aiflags & AI_SOUND_TARGET)
 	{
 		VectorSubtract3 (self->s.origin, self->enemy->s.origin, v);
 		if (VectorLength3(v) < 64)
 		{
-			self->monsterinfo.aiflags |= (AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
-			self->monsterinfo.stand (self);
+			self->monsterinfo->aiflags |= (AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
+			self->monsterinfo->stand (self);
 			return;
 		}
 
@@ -986,7 +997,7 @@ void AI_Run (edict_t *self, float dist)
 	if (AI_CheckForAttack (self, dist))
 		return;
 
-	if (self->monsterinfo.attack_state == AS_SLIDING)
+	if (self->monsterinfo->attack_state == AS_SLIDING)
 	{
 		AI_RunSlide (self, dist);
 		return;
@@ -997,17 +1008,17 @@ void AI_Run (edict_t *self, float dist)
 //		if (self.aiflags & AI_LOST_SIGHT)
 //			dprint("regained sight\n");
 		AI_MoveToGoal (self, dist);
-		self->monsterinfo.aiflags &= ~AI_LOST_SIGHT;
-		VectorCopy3 (self->enemy->s.origin, self->monsterinfo.last_sighting);
-		self->monsterinfo.trail_time = level.time;
+		self->monsterinfo->aiflags &= ~AI_LOST_SIGHT;
+		VectorCopy3 (self->enemy->s.origin, self->monsterinfo->last_sighting);
+		self->monsterinfo->trail_time = level.time;
 		return;
 	}
 
 
-	if ((self->monsterinfo.search_time) && (level.time > (self->monsterinfo.search_time + 20)))
+	if ((self->monsterinfo->search_time) && (level.time > (self->monsterinfo->search_time + 20)))
 	{
 		AI_MoveToGoal (self, dist);
-		self->monsterinfo.search_time = 0;
+		self->monsterinfo->search_time = 0;
 //		dprint("search timeout\n");
 		return;
 	}
@@ -1018,34 +1029,34 @@ void AI_Run (edict_t *self, float dist)
 
 	new = false;
 
-	if (!(self->monsterinfo.aiflags & AI_LOST_SIGHT))
+	if (!(self->monsterinfo->aiflags & AI_LOST_SIGHT))
 	{
 		// just lost sight of the player, decide where to go first
 //		dprint("lost sight of player, last seen at "); dprint(vtos(self.last_sighting)); dprint("\n");
-		self->monsterinfo.aiflags |= (AI_LOST_SIGHT | AI_PURSUIT_LAST_SEEN);
-		self->monsterinfo.aiflags &= ~(AI_PURSUE_NEXT | AI_PURSUE_TEMP);
+		self->monsterinfo->aiflags |= (AI_LOST_SIGHT | AI_PURSUIT_LAST_SEEN);
+		self->monsterinfo->aiflags &= ~(AI_PURSUE_NEXT | AI_PURSUE_TEMP);
 		new = true;
 	}
 
-	if (self->monsterinfo.aiflags & AI_PURSUE_NEXT)
+	if (self->monsterinfo->aiflags & AI_PURSUE_NEXT)
 	{
-		self->monsterinfo.aiflags &= ~AI_PURSUE_NEXT;
+		self->monsterinfo->aiflags &= ~AI_PURSUE_NEXT;
 //		dprint("reached current goal: "); dprint(vtos(self.origin)); dprint(" "); dprint(vtos(self.last_sighting)); dprint(" "); dprint(ftos(vlen(self.origin - self.last_sighting))); dprint("\n");
 
 		// give ourself more time since we got this far
-		self->monsterinfo.search_time = level.time + 5;
+		self->monsterinfo->search_time = level.time + 5;
 
-		if (self->monsterinfo.aiflags & AI_PURSUE_TEMP)
+		if (self->monsterinfo->aiflags & AI_PURSUE_TEMP)
 		{
 //			dprint("was temp goal; retrying original\n");
-			self->monsterinfo.aiflags &= ~AI_PURSUE_TEMP;
+			self->monsterinfo->aiflags &= ~AI_PURSUE_TEMP;
 			marker = NULL;
-			VectorCopy3 (self->monsterinfo.saved_goal, self->monsterinfo.last_sighting);
+			VectorCopy3 (self->monsterinfo->saved_goal, self->monsterinfo->last_sighting);
 			new = true;
 		}
-		else if (self->monsterinfo.aiflags & AI_PURSUIT_LAST_SEEN)
+		else if (self->monsterinfo->aiflags & AI_PURSUIT_LAST_SEEN)
 		{
-			self->monsterinfo.aiflags &= ~AI_PURSUIT_LAST_SEEN;
+			self->monsterinfo->aiflags &= ~AI_PURSUIT_LAST_SEEN;
 			marker = PlayerTrail_PickFirst (self);
 		}
 		else
@@ -1055,8 +1066,8 @@ void AI_Run (edict_t *self, float dist)
 
 		if (marker)
 		{
-			VectorCopy3 (marker->s.origin, self->monsterinfo.last_sighting);
-			self->monsterinfo.trail_time = marker->timestamp;
+			VectorCopy3 (marker->s.origin, self->monsterinfo->last_sighting);
+			self->monsterinfo->trail_time = marker->timestamp;
 			self->s.angles[YAW] = self->ideal_yaw = marker->s.angles[YAW];
 //			dprint("heading is "); dprint(ftos(self.ideal_yaw)); dprint("\n");
 
@@ -1065,21 +1076,30 @@ void AI_Run (edict_t *self, float dist)
 		}
 	}
 
-	VectorSubtract3 (self->s.origin, self->monsterinfo.last_sighting, v);
+	VectorSubtract3 (self->s.origin, self->monsterinfo->last_sighting, v);
 	d1 = VectorLength3(v);
 	if (d1 <= dist)
 	{
-		self->monsterinfo.aiflags |= AI_PURSUE_NEXT;
+		self->monsterinfo->aiflags |= AI_PURSUE_NEXT;
 		dist = d1;
 	}
 
-	VectorCopy3 (self->monsterinfo.last_sighting, self->goalentity->s.origin);
+	VectorCopy3 (self->monsterinfo->last_sighting, self->goalentity->s.origin);
+
+	// walk the navigation graph there if there is one, rather than feel for a way round
+	if (Nav_SteerTowards (self, self->monsterinfo->last_sighting, waypoint))
+	{
+		VectorCopy3 (waypoint, self->goalentity->s.origin);
+		VectorSubtract3 (waypoint, self->s.origin, v);
+		self->ideal_yaw = vectoyaw(v);
+		new = false;
+	}
 
 	if (new)
 	{
 //		gi.dprintf("checking for course correction\n");
 
-		tr = gi.trace(self->s.origin, self->mins, self->maxs, self->monsterinfo.last_sighting, self, MASK_PLAYERSOLID);
+		tr = Game_Trace(self->s.origin, self->mins, self->maxs, self->monsterinfo->last_sighting, self, MASK_PLAYERSOLID);
 		if (tr.fraction < 1)
 		{
 			VectorSubtract3 (self->goalentity->s.origin, self->s.origin, v);
@@ -1091,12 +1111,12 @@ void AI_Run (edict_t *self, float dist)
 
 			VectorSet3(v, d2, -16, 0);
 			Game_ProjectSource (self->s.origin, v, v_forward, v_right, left_target);
-			tr = gi.trace(self->s.origin, self->mins, self->maxs, left_target, self, MASK_PLAYERSOLID);
+			tr = Game_Trace(self->s.origin, self->mins, self->maxs, left_target, self, MASK_PLAYERSOLID);
 			left = tr.fraction;
 
 			VectorSet3(v, d2, 16, 0);
 			Game_ProjectSource (self->s.origin, v, v_forward, v_right, right_target);
-			tr = gi.trace(self->s.origin, self->mins, self->maxs, right_target, self, MASK_PLAYERSOLID);
+			tr = Game_Trace(self->s.origin, self->mins, self->maxs, right_target, self, MASK_PLAYERSOLID);
 			right = tr.fraction;
 
 			center = (d1*center)/d2;
@@ -1108,10 +1128,10 @@ void AI_Run (edict_t *self, float dist)
 					Game_ProjectSource (self->s.origin, v, v_forward, v_right, left_target);
 //					gi.dprintf("incomplete path, go part way and adjust again\n");
 				}
-				VectorCopy3 (self->monsterinfo.last_sighting, self->monsterinfo.saved_goal);
-				self->monsterinfo.aiflags |= AI_PURSUE_TEMP;
+				VectorCopy3 (self->monsterinfo->last_sighting, self->monsterinfo->saved_goal);
+				self->monsterinfo->aiflags |= AI_PURSUE_TEMP;
 				VectorCopy3 (left_target, self->goalentity->s.origin);
-				VectorCopy3 (left_target, self->monsterinfo.last_sighting);
+				VectorCopy3 (left_target, self->monsterinfo->last_sighting);
 				VectorSubtract3 (self->goalentity->s.origin, self->s.origin, v);
 				self->s.angles[YAW] = self->ideal_yaw = vectoyaw(v);
 //				gi.dprintf("adjusted left\n");
@@ -1125,10 +1145,10 @@ void AI_Run (edict_t *self, float dist)
 					Game_ProjectSource (self->s.origin, v, v_forward, v_right, right_target);
 //					gi.dprintf("incomplete path, go part way and adjust again\n");
 				}
-				VectorCopy3 (self->monsterinfo.last_sighting, self->monsterinfo.saved_goal);
-				self->monsterinfo.aiflags |= AI_PURSUE_TEMP;
+				VectorCopy3 (self->monsterinfo->last_sighting, self->monsterinfo->saved_goal);
+				self->monsterinfo->aiflags |= AI_PURSUE_TEMP;
 				VectorCopy3 (right_target, self->goalentity->s.origin);
-				VectorCopy3 (right_target, self->monsterinfo.last_sighting);
+				VectorCopy3 (right_target, self->monsterinfo->last_sighting);
 				VectorSubtract3 (self->goalentity->s.origin, self->s.origin, v);
 				self->s.angles[YAW] = self->ideal_yaw = vectoyaw(v);
 //				gi.dprintf("adjusted right\n");
@@ -0,0 +1,231 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// ai_lod.c : How often each monster thinks
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+AI LOD
+
+==============================================================================
+
+Monsters a long way from every client don't need to think every tick. Each
+monster has a tier, monsterinfo->lod, that AI_MonsterMove uses to pick when it
+next thinks: every tick, every 2nd or every 4th (AI_LOD_TICKS), with the
+distance each frame moves it scaled up to match so it covers the same ground.
+Quarter rate monsters step two animation frames a think so their animations
+and attacks keep the same pace. A dormant monster doesn't animate or think at all, it only looks again every
+AI_LOD_DORMANT_TIME seconds.
+
+The tier comes from the distance to the nearest client against sv_ailod_half,
+sv_ailod_quarter and sv_ailod_dormant. It drops a tier if no client has the
+monster in its PVS, and goes dormant if its area isn't connected to any
+client's (a closed door or area portal in between). A monster that has an
+enemy keeps at least quarter rate so fights away from the players still
+finish.
+
+AI_UpdateLOD looks at 1 in AI_LOD_PERIOD monsters a frame, and wakes any that
+moved up a tier straight away. sv_ailod 0 puts every monster back to full
+rate.
+*/
+
+#define AI_LOD_PERIOD			8		// frames to look at every monster once
+#define AI_LOD_DORMANT_TIME		1.0f	// seconds between dormant monsters checking in
+
+static const char* ai_lod_names[AI_NUM_LODS] =
+{
+	"full",
+	"half",
+	"quarter",
+	"dormant",
+};
+
+static int32_t	ai_lod_counting[AI_NUM_LODS];	// the cycle in progress
+static int32_t	ai_lod_counts[AI_NUM_LODS];		// the last whole cycle
+
+static edict_t*	ai_lod_clients[MAX_CLIENTS];
+static int32_t	ai_lod_num_clients;
+
+/*
+=============
+AI_PickLOD
+
+Works out the tier self should think at
+=============
+*/
+static int32_t AI_PickLOD(edict_t* self)
+{
+	edict_t*	client;
+	vec3_t		v;
+	float		dist, best_dist;
+	bool		visible, connected;
+	int32_t		i, lod;
+
+	if (sv_ailod->value <= 0
+		|| self->health <= 0)
+		return AI_LOD_FULL;
+
+	best_dist = 0;
+	visible = connected = false;
+
+	for (i = 0; i < ai_lod_num_clients; i++)
+	{
+		client = ai_lod_clients[i];
+
+		VectorSubtract3(client->s.origin, self->s.origin, v);
+		dist = VectorLength3(v);
+
+		if (!i || dist < best_dist)
+			best_dist = dist;
+
+		if (!visible
+			&& gi.inPVS(self->s.origin, client->s.origin))
+			visible = true;
+
+		if (!connected
+			&& (gi.AreasConnected(self->areanum, client->areanum)
+				|| (self->areanum2 && gi.AreasConnected(self->areanum2, client->areanum))))
+			connected = true;
+	}
+
+	if (best_dist < sv_ailod_half->value)
+		lod = AI_LOD_FULL;
+	else if (best_dist < sv_ailod_quarter->value)
+		lod = AI_LOD_HALF;
+	else if (best_dist < sv_ailod_dormant->value)
+		lod = AI_LOD_QUARTER;
+	else
+		lod = AI_LOD_DORMANT;
+
+	if (!visible
+		&& lod < AI_LOD_DORMANT)
+		lod++;
+
+	if (!connected)
+		lod = AI_LOD_DORMANT;
+
+	if (self->enemy
+		&& lod > AI_LOD_QUARTER)
+		lod = AI_LOD_QUARTER;
+
+	return lod;
+}
+
+/*
+=============
+AI_UpdateLOD
+
+Called once each frame before AI_UpdateSight
+=============
+*/
+void AI_UpdateLOD()
+{
+	edict_t*	ent;
+	float		wake;
+	int32_t		i, lod;
+
+	ai_lod_num_clients = 0;
+
+	for (i = 1; i <= game.maxclients; i++)
+	{
+		ent = &g_edicts[i];
+
+		if (ent->inuse
+			&& ent->client
+			&& ent->client->pers.connected)
+			ai_lod_clients[ai_lod_num_clients++] = ent;
+	}
+
+	if (!(level.framenum % AI_LOD_PERIOD))
+	{
+		memcpy(ai_lod_counts, ai_lod_counting, sizeof(ai_lod_counts));
+		memset(ai_lod_counting, 0, sizeof(ai_lod_counting));
+	}
+
+	for (i = game.maxclients + 1 + (level.framenum % AI_LOD_PERIOD); i < globals.num_edicts; i += AI_LOD_PERIOD)
+	{
+		ent = &g_edicts[i];
+
+		if (!ent->inuse
+			|| !(ent->svflags & SVF_MONSTER)
+			|| ent->think != AI_MonsterThink)
+			continue;
+
+		// nobody here yet, leave it as it was
+		if (ai_lod_num_clients)
+		{
+			lod = AI_PickLOD(ent);
+
+			// moved up a tier, don't make it wait out the old interval
+			if (lod < ent->monsterinfo->lod)
+			{
+				wake = level.time + TICK_TIME;
+
+				if (ent->nextthink > wake)
+					Edict_SetNextThink(ent, wake);
+			}
+
+			ent->monsterinfo->lod = lod;
+		}
+
+		ai_lod_counting[ent->monsterinfo->lod]++;
+	}
+}
+
+/*
+=============
+AI_LODThink
+
+Called by AI_MonsterMove before it animates self. Returns false if self is
+dormant and shouldn't animate or think at all this time.
+=============
+*/
+bool AI_LODThink(edict_t* self)
+{
+	if (self->monsterinfo->lod == AI_LOD_DORMANT)
+	{
+		// AI_UpdateLOD wakes it sooner if a client comes near
+		Edict_SetNextThink(self, level.time + AI_LOD_DORMANT_TIME);
+		return false;
+	}
+
+	Edict_SetNextThink(self, level.time + TICK_TIME * AI_LOD_TICKS(self));
+	return true;
+}
+
+/*
+=============
+AI_PrintLODStats
+
+Prints how many monsters were in each tier over the last AI_LOD_PERIOD frames
+=============
+*/
+void AI_PrintLODStats()
+{
+	int32_t	i;
+
+	gi.cprintf(NULL, PRINT_HIGH, "ai lod%s:", (sv_ailod->value > 0) ? "" : " (off)");
+
+	for (i = 0; i < AI_NUM_LODS; i++)
+		gi.cprintf(NULL, PRINT_HIGH, " %i %s%s", ai_lod_counts[i], ai_lod_names[i], (i < AI_NUM_LODS - 1) ? "," : "\n");
+}
@@ -36,7 +36,7 @@ static void AI_TurnOnFliesEffect(edict_t* self)
 	self->s.effects |= EF_FLIES;
 	self->s.sound = gi.soundindex("infantry/inflies1.wav");
 	self->think = AI_TurnOffFliesEffect;
-	self->nextthink = level.time + 60;
+	Edict_SetNextThink(self, level.time + 60);
 }
 
 void AI_CheckFliesEffect(edict_t* self)
@@ -48,12 +48,12 @@ void AI_CheckFliesEffect(edict_t* self)
 		return;
 
 	self->think = AI_TurnOnFliesEffect;
-	self->nextthink = level.time + 5 + 10 * random();
+	Edict_SetNextThink(self, level.time + 5 + 10 * random());
 }
 
 void AI_AttackFinished(edict_t* self, float time)
 {
-	self->monsterinfo.attack_finished = level.time + time;
+	self->monsterinfo->attack_finished = level.time + time;
 }
 
 
@@ -76,7 +76,7 @@ void AI_CheckGround(edict_t* ent)
 	point[1] = ent->s.origin[1];
 	point[2] = ent->s.origin[2] - 0.25;
 
-	trace = gi.trace(ent->s.origin, ent->mins, ent->maxs, point, ent, MASK_MONSTERSOLID);
+	trace = Game_Trace(ent->s.origin, ent->mins, ent->maxs, point, ent, MASK_MONSTERSOLID);
 
 	// check steepness
 	if (trace.plane.normal[2] < 0.7 && !trace.startsolid)
@@ -106,7 +106,7 @@ void AI_CategorizePosition(edict_t* ent)
 	point[0] = ent->s.origin[0];
 	point[1] = ent->s.origin[1];
 	point[2] = ent->s.origin[2] + ent->mins[2] + 1;
-	cont = gi.pointcontents(point);
+	cont = Game_PointContents(point);
 
 	if (!(cont & MASK_WATER))
 	{
@@ -118,13 +118,13 @@ void AI_CategorizePosition(edict_t* ent)
 	ent->watertype = cont;
 	ent->waterlevel = 1;
 	point[2] += 26;
-	cont = gi.pointcontents(point);
+	cont = Game_PointContents(point);
 	if (!(cont & MASK_WATER))
 		return;
 
 	ent->waterlevel = 2;
 	point[2] += 22;
-	cont = gi.pointcontents(point);
+	cont = Game_PointContents(point);
 	if (cont & MASK_WATER)
 		ent->waterlevel = 3;
 }
@@ -231,14 +231,14 @@ void AI_MonsterDropToFloor(edict_t* ent)
 	VectorCopy3(ent->s.origin, end);
 	end[2] -= 256;
 
-	trace = gi.trace(ent->s.origin, ent->mins, ent->maxs, end, ent, MASK_MONSTERSOLID);
+	trace = Game_Trace(ent->s.origin, ent->mins, ent->maxs, end, ent, MASK_MONSTERSOLID);
 
 	if (trace.fraction == 1 || trace.allsolid)
 		return;
 
 	VectorCopy3(trace.endpos, ent->s.origin);
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 	AI_CheckGround(ent);
 	AI_CategorizePosition(ent);
 }
@@ -249,7 +249,7 @@ void AI_MonsterSetEffects(edict_t* ent)
 	ent->s.effects &= ~(EF_COLOR_SHELL);
 	ent->s.renderfx &= ~(RF_SHELL_RED | RF_SHELL_GREEN | RF_SHELL_BLUE);
 
-	if (ent->monsterinfo.aiflags & AI_RESURRECTING)
+	if (ent->monsterinfo->aiflags & AI_RESURRECTING)
 	{
 		ent->s.effects |= EF_COLOR_SHELL;
 		ent->s.renderfx |= RF_SHELL_RED;
@@ -259,25 +259,31 @@ void AI_MonsterSetEffects(edict_t* ent)
 		return;
 
 	if (ent->powerarmor_time > level.time
-		&& ent->monsterinfo.power_armor_type == POWER_ARMOR_SHIELD)
+		&& ent->monsterinfo->power_armor_type == POWER_ARMOR_SHIELD)
 	{
 		ent->s.effects |= EF_COLOR_SHELL;
 		ent->s.renderfx |= RF_SHELL_GREEN;
 	}
 }
 
-void AI_MonsterMove(edict_t* self)
+/*
+================
+AI_MonsterStepFrame
+
+Moves self on to the next frame of its current move, returns false if the
+move's endfunc killed it
+================
+*/
+static bool AI_MonsterStepFrame(edict_t* self)
 {
 	mmove_t* move;
-	int32_t	index;
 
-	move = self->monsterinfo.currentmove;
-	self->nextthink = level.time + TICK_TIME;
+	move = self->monsterinfo->currentmove;
 
-	if ((self->monsterinfo.nextframe) && (self->monsterinfo.nextframe >= move->firstframe) && (self->monsterinfo.nextframe <= move->lastframe))
+	if ((self->monsterinfo->nextframe) && (self->monsterinfo->nextframe >= move->firstframe) && (self->monsterinfo->nextframe <= move->lastframe))
 	{
-		self->s.frame = self->monsterinfo.nextframe;
-		self->monsterinfo.nextframe = 0;
+		self->s.frame = self->monsterinfo->nextframe;
+		self->monsterinfo->nextframe = 0;
 	}
 	else
 	{
@@ -288,26 +294,27 @@ void AI_MonsterMove(edict_t* self)
 				move->endfunc(self);
 
 				// regrab move, endfunc is very likely to change it
-				move = self->monsterinfo.currentmove;
+				move = self->monsterinfo->currentmove;
 
 				// check for death
 				if (self->svflags & SVF_DEADMONSTER)
-					return;
+					return false;
 			}
 		}
 
 		if (self->s.frame < move->firstframe || self->s.frame > move->lastframe)
 		{
-			self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+			self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 			self->s.frame = move->firstframe;
 		}
 		else
 		{
-			if (!(self->monsterinfo.aiflags & AI_HOLD_FRAME))
+			if (!(self->monsterinfo->aiflags & AI_HOLD_FRAME))
 			{
 				// hack until new animation system
-				if (level.framenum
-					& (int32_t)(0.1f / TICK_TIME))
+				// monsters thinking less often step every think, see AI_MonsterMove
+				if (AI_LOD_TICKS(self) > 1
+					|| level.framenum & (int32_t)(0.1f / TICK_TIME))
 				{
 					self->s.frame++;
 					if (self->s.frame > move->lastframe)
@@ -318,10 +325,52 @@ void AI_MonsterMove(edict_t* self)
 		}
 	}
 
+	return true;
+}
+
+void AI_MonsterMove(edict_t* self)
+{
+	mmove_t* move;
+	int32_t	index, steps;
+
+	// picks the next think from its lod tier, dormant monsters skip the rest
+	if (!AI_LODThink(self))
+		return;
+
+	// full rate steps a frame on half its ticks, so a monster thinking every
+	// AI_LOD_TICKS steps half that many frames to keep time, running the thinkfuncs
+	// of the ones it passes over
+	steps = AI_LOD_TICKS(self) / 2;
+
+	if (steps < 1)
+		steps = 1;
+
+	while (1)
+	{
+		if (!AI_MonsterStepFrame(self))
+			return;
+
+		if (--steps <= 0
+			|| (self->monsterinfo->aiflags & AI_HOLD_FRAME))
+			break;
+
+		move = self->monsterinfo->currentmove;
+		index = self->s.frame - move->firstframe;
+
+		if (move->frame[index].thinkfunc)
+			move->frame[index].thinkfunc(self);
+
+		if (!self->inuse
+			|| (self->svflags & SVF_DEADMONSTER))
+			return;
+	}
+
+	move = self->monsterinfo->currentmove;
+
 	index = self->s.frame - move->firstframe;
 	if (move->frame[index].aifunc)
-		if (!(self->monsterinfo.aiflags & AI_HOLD_FRAME))
-			move->frame[index].aifunc(self, move->frame[index].dist * self->monsterinfo.scale);
+		if (!(self->monsterinfo->aiflags & AI_HOLD_FRAME))
+			move->frame[index].aifunc(self, move->frame[index].dist * self->monsterinfo->scale * AI_LOD_TICKS(self));
 		else
 			move->frame[index].aifunc(self, 0);
 
@@ -332,17 +381,21 @@ void AI_MonsterMove(edict_t* self)
 
 void AI_MonsterThink(edict_t* self)
 {
+	Trace_Begin("AI_MonsterThink", self - g_edicts);
+
 	AI_MonsterMove(self);
 
-	if (self->linkcount != self->monsterinfo.linkcount)
+	if (self->linkcount != self->monsterinfo->linkcount)
 	{
-		self->monsterinfo.linkcount = self->linkcount;
+		self->monsterinfo->linkcount = self->linkcount;
 		AI_CheckGround(self);
 	}
 
 	AI_CategorizePosition(self);
 	AI_MonsterWorldEffects(self);
 	AI_MonsterSetEffects(self);
+
+	Trace_End();
 }
 
 /*
@@ -360,7 +413,7 @@ void AI_MonsterActivate(edict_t* self, edict_t* other, edict_t* activator)
 		return;
 	if (activator->flags & FL_NOTARGET)
 		return;
-	if (!(activator->client) && !(activator->monsterinfo.aiflags & AI_GOOD_GUY))
+	if (!(activator->client) && !(activator->monsterinfo && (activator->monsterinfo->aiflags & AI_GOOD_GUY)))
 		return;
 
 	// delay reaction so if the monster is teleported, its sound is still heard
@@ -380,7 +433,7 @@ void AI_MonsterTriggeredSpawn(edict_t* self)
 	self->movetype = MOVETYPE_STEP;
 	self->svflags &= ~SVF_NOCLIENT;
 	self->air_finished = level.time + 12;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 
 	AI_MonsterStartGo(self);
 
@@ -398,7 +451,7 @@ void AI_MonsterTriggeredSpawnUse(edict_t* self, edict_t* other, edict_t* activat
 {
 	// we have a one frame delay here so we don't telefrag the guy who activated us
 	self->think = AI_MonsterTriggeredSpawn;
-	self->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(self, level.time + TICK_TIME);
 	if (activator->client)
 		self->enemy = activator;
 	self->use = AI_MonsterActivate;
@@ -409,7 +462,7 @@ void AI_MonsterTriggeredStart(edict_t* self)
 	self->solid = SOLID_NOT;
 	self->movetype = MOVETYPE_NONE;
 	self->svflags |= SVF_NOCLIENT;
-	self->nextthink = 0;
+	Edict_SetNextThink(self, 0);
 	self->use = AI_MonsterTriggeredSpawnUse;
 }
 
@@ -425,7 +478,7 @@ enemy as activator.
 void AI_MonsterStartUse(edict_t* self)
 {
 	self->flags &= ~(FL_FLY | FL_SWIM);
-	self->monsterinfo.aiflags &= AI_GOOD_GUY;
+	self->monsterinfo->aiflags &= AI_GOOD_GUY;
 
 	if (self->item)
 	{
@@ -447,17 +500,17 @@ void AI_MonsterStartUse(edict_t* self)
 
 bool AI_MonsterStart(edict_t* self)
 {
-	if ((self->spawnflags & 4) && !(self->monsterinfo.aiflags & AI_GOOD_GUY))
+	if ((self->spawnflags & 4) && !(self->monsterinfo->aiflags & AI_GOOD_GUY))
 	{
 		self->spawnflags &= ~4;
 		self->spawnflags |= 1;
 		//		gi.dprintf("fixed spawnflags on %s at %s\n", self->classname, vtos(self->s.origin));
 	}
 
-	if (!(self->monsterinfo.aiflags & AI_GOOD_GUY))
+	if (!(self->monsterinfo->aiflags & AI_GOOD_GUY))
 		level.total_monsters++;
 
-	self->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(self, level.time + TICK_TIME);
 	self->svflags |= SVF_MONSTER;
 	self->s.renderfx |= RF_FRAMELERP;
 	self->takedamage = DAMAGE_AIM;
@@ -470,8 +523,8 @@ bool AI_MonsterStart(edict_t* self)
 	self->deadflag = DEAD_NO;
 	self->svflags &= ~SVF_DEADMONSTER;
 
-	if (!self->monsterinfo.checkattack)
-		self->monsterinfo.checkattack = AI_CheckAttack;
+	if (!self->monsterinfo->checkattack)
+		self->monsterinfo->checkattack = AI_CheckAttack;
 	VectorCopy3(self->s.origin, self->s.old_origin);
 
 	if (st.item)
@@ -482,8 +535,8 @@ bool AI_MonsterStart(edict_t* self)
 	}
 
 	// randomize what frame they start on
-	if (self->monsterinfo.currentmove)
-		self->s.frame = self->monsterinfo.currentmove->firstframe + (rand() % (self->monsterinfo.currentmove->lastframe - self->monsterinfo.currentmove->firstframe + 1));
+	if (self->monsterinfo->currentmove)
+		self->s.frame = self->monsterinfo->currentmove->firstframe + (rand() % (self->monsterinfo->currentmove->lastframe - self->monsterinfo->currentmove->firstframe + 1));
 
 	return true;
 }
@@ -505,9 +558,9 @@ void AI_MonsterStartGo(edict_t* self)
 		target = NULL;
 		notcombat = false;
 		fixup = false;
-		while ((target = Game_FindEdictByValue(target, FOFS(targetname), self->target)) != NULL)
+		while ((target = Edict_FindByTargetname(target, self->target)) != NULL)
 		{
-			if (strcmp(target->classname, "point_combat") == 0)
+			if (target->classid == CLASS_POINT_COMBAT)
 			{
 				self->combattarget = self->target;
 				fixup = true;
@@ -529,9 +582,9 @@ void AI_MonsterStartGo(edict_t* self)
 		edict_t* target;
 
 		target = NULL;
-		while ((target = Game_FindEdictByValue(target, FOFS(targetname), self->combattarget)) != NULL)
+		while ((target = Edict_FindByTargetname(target, self->combattarget)) != NULL)
 		{
-			if (strcmp(target->classname, "point_combat") != 0)
+			if (target->classid != CLASS_POINT_COMBAT)
 			{
 				gi.dprintf("%s at (%i %i %i) has a bad combattarget %s : %s at (%i %i %i)\n",
 					self->classname, (int32_t)self->s.origin[0], (int32_t)self->s.origin[1], (int32_t)self->s.origin[2],
@@ -548,31 +601,31 @@ void AI_MonsterStartGo(edict_t* self)
 		{
 			gi.dprintf("%s can't find target %s at %s\n", self->classname, self->target, vtos(self->s.origin));
 			self->target = NULL;
-			self->monsterinfo.pausetime = 100000000;
-			self->monsterinfo.stand(self);
+			self->monsterinfo->pausetime = 100000000;
+			self->monsterinfo->stand(self);
 		}
-		else if (strcmp(self->movetarget->classname, "path_corner") == 0)
+		else if (self->movetarget->classid == CLASS_PATH_CORNER)
 		{
 			VectorSubtract3(self->goalentity->s.origin, self->s.origin, v);
 			self->ideal_yaw = self->s.angles[YAW] = vectoyaw(v);
-			self->monsterinfo.walk(self);
+			self->monsterinfo->walk(self);
 			self->target = NULL;
 		}
 		else
 		{
 			self->goalentity = self->movetarget = NULL;
-			self->monsterinfo.pausetime = 100000000;
-			self->monsterinfo.stand(self);
+			self->monsterinfo->pausetime = 100000000;
+			self->monsterinfo->stand(self);
 		}
 	}
 	else
 	{
-		self->monsterinfo.pausetime = 100000000;
-		self->monsterinfo.stand(self);
+		self->monsterinfo->pausetime = 100000000;
+		self->monsterinfo->stand(self);
 	}
 
 	self->think = AI_MonsterThink;
-	self->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(self, level.time + TICK_TIME);
 }
 
 
@@ -671,11 +724,11 @@ void AI_MonsterCheckDodge(edict_t* self, vec3_t start, vec3_t dir, int32_t speed
 			return;
 	}
 	VectorMA3(start, 8192, dir, end);
-	tr = gi.trace(start, NULL, NULL, end, self, MASK_SHOT);
-	if ((tr.ent) && (tr.ent->svflags & SVF_MONSTER) && (tr.ent->health > 0) && (tr.ent->monsterinfo.dodge) && Edict_IsInFront(tr.ent, self))
+	tr = Game_Trace(start, NULL, NULL, end, self, MASK_SHOT);
+	if ((tr.ent) && (tr.ent->svflags & SVF_MONSTER) && (tr.ent->health > 0) && (tr.ent->monsterinfo->dodge) && Edict_IsInFront(tr.ent, self))
 	{
 		VectorSubtract3(tr.endpos, start, v);
 		eta = (VectorLength3(v) - tr.ent->maxs[0]) / speed;
-		tr.ent->monsterinfo.dodge(tr.ent, self, eta);
+		tr.ent->monsterinfo->dodge(tr.ent, self, eta);
 	}
 }
@@ -0,0 +1,1249 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// ai_nav.c : Waypoint graph and path finding for monsters
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+NAVIGATION GRAPH
+
+==============================================================================
+
+When a level is spawned the floor is sampled on a NAV_SPACING grid around
+the entities in it. Every column is traced down through all of its floors,
+and a node is made wherever a monster would fit and has ground under all of
+its corners, same as M_CheckBottom wants. Nodes in neighbouring columns are
+linked if a monster could walk between them. Only the world and brush models
+are traced, so a closed door splits the graph.
+
+Building it takes a few traces per column, so the graph is written to
+<game>/<mapname>.nav and read back next time, as long as the entity string
+hasn't changed.
+
+AI_Run uses Nav_SteerTowards to head for last_sighting when it has lost
+sight of its enemy. Paths are found with A* run backwards from the goal, so
+the search leaves every node it settled pointing at the goal, and any
+monster after the same goal (usually the same player) just reads its next
+node from there. A monster starting somewhere the search hasn't reached yet
+carries on the same search.
+*/
+
+#define NAV_FILE_IDENT		(('1'<<24)+('V'<<16)+('A'<<8)+'N')
+#define NAV_FILE_VERSION	1
+
+#define NAV_SPACING			64			// between columns
+#define NAV_MAX_NODES		16384
+#define NAV_MAX_FLOORS		8			// per column
+#define NAV_STEP			18			// STEPSIZE, the most a monster steps up
+#define NAV_MAX_RISE		(NAV_STEP * 2)	// height difference a link can cover, a stair flight is several steps
+#define NAV_MARGIN			512			// sampled past the outermost entities
+#define NAV_WORLD_LIMIT		4096
+#define NAV_HASH_SIZE		4096		// must be a power of two
+#define NAV_MAX_TREES		8
+#define NAV_TREE_LIFETIME	5.0f		// seconds a search is kept for other monsters
+#define NAV_REACHED			24			// nodes closer than this are passed over
+#define NAV_MAX_FIELDS		16
+#define NAV_FIELD_LIFETIME	2.0f		// seconds a field is kept after nobody follows it
+#define NAV_FIELD_REPAIR	512			// how far round a target that has moved a little its field is worked out again
+
+// what monsters can't walk through, leaving out other monsters
+#define NAV_MASK			(CONTENTS_SOLID | CONTENTS_WINDOW | CONTENTS_MONSTERCLIP)
+
+enum
+{
+	NAV_UNSEEN,
+	NAV_OPEN,
+	NAV_CLOSED
+};
+
+typedef struct nav_node_s
+{
+	vec3_t		origin;					// where a monster standing there would have its origin
+	int32_t		links[8];				// node in each neighbouring column, -1 for none
+} nav_node_t;
+
+typedef struct nav_header_s
+{
+	int32_t		ident;
+	int32_t		version;
+	uint32_t	checksum;				// of the entity string
+	int32_t		spacing;
+	int32_t		num_nodes;
+} nav_header_t;
+
+// one backwards search, shared by every monster heading for the same goal
+typedef struct nav_tree_s
+{
+	int32_t		goal;					// -1 if unused
+	float		time;					// level.time it was started
+	int32_t		open;					// nodes in the open state
+	float*		cost;					// to the goal
+	int32_t*	next;					// next node towards the goal
+	uint8_t*	state;
+} nav_tree_t;
+
+typedef struct nav_heap_entry_s
+{
+	float		f;
+	float		cost;					// cost when pushed, to spot stale entries
+	int32_t		node;
+} nav_heap_entry_t;
+
+typedef struct nav_heap_s
+{
+	nav_heap_entry_t*	entries;
+	int32_t				count;
+} nav_heap_t;
+
+// what every monster chasing target follows, see Nav_UpdateFields
+typedef struct nav_field_s
+{
+	edict_t*	target;					// NULL if unused
+	int32_t		target_node;			// node the target was last found on
+	int32_t		goal;					// node next leads to, -1 until it is first worked out
+	int32_t		whole_goal;				// goal the last time the whole field was worked out
+	float		used;					// level.time a monster last asked for it
+	int32_t*	next;					// next node towards goal, -1 if it can't be reached
+	float*		cost;					// along next to goal, or to an older goal further out
+} nav_field_t;
+
+typedef struct nav_stats_s
+{
+	int32_t		links;
+	float		build_ms;
+	bool		loaded;					// read from the cache file
+	int64_t		queries;
+	int64_t		reused;					// answered from a search another monster started
+	int64_t		searches;
+	int64_t		expanded;
+	int64_t		field_builds;
+	int64_t		field_settled;			// nodes settled building fields
+	int64_t		field_samples;
+	int64_t		field_steered;			// samples that gave a direction
+	int32_t		frame_settled;			// last frame
+} nav_stats_t;
+
+// the monster hull nodes are made for
+static vec3_t			nav_mins = { -16, -16, -24 };
+static vec3_t			nav_maxs = { 16, 16, 32 };
+
+// column offset of each link
+static int32_t			nav_dirs[8][2] = { { 1, 0 }, { 1, 1 }, { 0, 1 }, { -1, 1 }, { -1, 0 }, { -1, -1 }, { 0, -1 }, { 1, -1 } };
+
+static nav_node_t*		nav_nodes;
+static int32_t			nav_num_nodes;
+static int32_t*			nav_node_next;			// next node in the same hash bucket
+static int32_t			nav_hash[NAV_HASH_SIZE];
+
+static nav_tree_t		nav_trees[NAV_MAX_TREES];
+static nav_heap_t		nav_heap;
+
+static nav_field_t		nav_fields[NAV_MAX_FIELDS];
+static nav_field_t*		nav_build_field;		// field being rebuilt, NULL if none
+static int32_t			nav_build_goal;
+static float*			nav_build_cost;
+static int32_t*			nav_build_next;
+static uint8_t*			nav_build_state;
+static int32_t*			nav_build_closed;		// nodes settled, copied to the field once it is done
+static int32_t			nav_build_num_closed;
+static float			nav_build_limit;		// cost past which nodes are left as they were
+static nav_heap_t		nav_build_heap;			// kept between frames
+static int32_t			nav_field_cursor;		// field looked at first for the next build
+
+static nav_stats_t		nav_stats;
+
+static int32_t Nav_Column(float v)
+{
+	return (int32_t)floorf(v / NAV_SPACING + 0.5f);
+}
+
+static int32_t Nav_Bucket(int32_t x, int32_t y)
+{
+	return ((uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u) & (NAV_HASH_SIZE - 1);
+}
+
+static float Nav_Distance(vec3_t a, vec3_t b)
+{
+	vec3_t v;
+
+	VectorSubtract3(a, b, v);
+	return VectorLength3(v);
+}
+
+/*
+=============
+Nav_Clear
+
+Forgets the graph, its memory went with the rest of TAG_LEVEL. Called when a
+level is spawned, with its entity string, and when one is loaded, with NULL
+since level.nav_checksum comes back with the rest of the level.
+=============
+*/
+void Nav_Clear(char* entities)
+{
+	nav_nodes = NULL;
+	nav_node_next = NULL;
+	memset(&nav_heap, 0, sizeof(nav_heap));
+	nav_num_nodes = 0;
+	memset(nav_trees, 0, sizeof(nav_trees));
+	memset(nav_fields, 0, sizeof(nav_fields));
+	memset(&nav_build_heap, 0, sizeof(nav_build_heap));
+	nav_build_field = NULL;
+	memset(&nav_stats, 0, sizeof(nav_stats));
+
+	if (!entities)
+		return;
+
+	// the cache file is only good for the same entity string
+	level.nav_checksum = Q_HashString(entities);
+}
+
+/*
+=============
+Nav_Finish
+
+Files the nodes by column and sets up the searches once the nodes are known
+=============
+*/
+static void Nav_Finish()
+{
+	int32_t	i, bucket;
+
+	nav_node_next = gi.TagMalloc(nav_num_nodes * sizeof(nav_node_next[0]), TAG_LEVEL);
+
+	for (i = 0; i < NAV_HASH_SIZE; i++)
+		nav_hash[i] = -1;
+
+	// backwards so each bucket lists its nodes in order
+	for (i = nav_num_nodes - 1; i >= 0; i--)
+	{
+		bucket = Nav_Bucket(Nav_Column(nav_nodes[i].origin[0]), Nav_Column(nav_nodes[i].origin[1]));
+		nav_node_next[i] = nav_hash[bucket];
+		nav_hash[bucket] = i;
+	}
+
+	// every relaxation can push, and reopening a search pushes every open node again
+	nav_heap.entries = gi.TagMalloc((nav_num_nodes * 9 + 1) * sizeof(nav_heap.entries[0]), TAG_LEVEL);
+	nav_build_heap.entries = gi.TagMalloc((nav_num_nodes * 9 + 1) * sizeof(nav_build_heap.entries[0]), TAG_LEVEL);
+	nav_build_cost = gi.TagMalloc(nav_num_nodes * sizeof(float), TAG_LEVEL);
+	nav_build_next = gi.TagMalloc(nav_num_nodes * sizeof(int32_t), TAG_LEVEL);
+	nav_build_state = gi.TagMalloc(nav_num_nodes * sizeof(uint8_t), TAG_LEVEL);
+	nav_build_closed = gi.TagMalloc(nav_num_nodes * sizeof(int32_t), TAG_LEVEL);
+
+	for (i = 0; i < NAV_MAX_FIELDS; i++)
+	{
+		nav_fields[i].next = gi.TagMalloc(nav_num_nodes * sizeof(int32_t), TAG_LEVEL);
+		nav_fields[i].cost = gi.TagMalloc(nav_num_nodes * sizeof(float), TAG_LEVEL);
+	}
+
+	for (i = 0; i < NAV_MAX_TREES; i++)
+	{
+		nav_trees[i].goal = -1;
+		nav_trees[i].cost = gi.TagMalloc(nav_num_nodes * sizeof(float), TAG_LEVEL);
+		nav_trees[i].next = gi.TagMalloc(nav_num_nodes * sizeof(int32_t), TAG_LEVEL);
+		nav_trees[i].state = gi.TagMalloc(nav_num_nodes * sizeof(uint8_t), TAG_LEVEL);
+	}
+}
+
+/*
+==============================================================================
+
+BUILDING
+
+==============================================================================
+*/
+
+/*
+=============
+Nav_CanStand
+
+True if a monster fits at origin with ground under every corner
+=============
+*/
+static bool Nav_CanStand(vec3_t origin)
+{
+	vec3_t	start, end;
+	trace_t	trace;
+	int32_t	x, y;
+
+	// outside the map is solid to pointcontents but has no brushes to trace against
+	if (Game_PointContents(origin) & (NAV_MASK | CONTENTS_LAVA | CONTENTS_SLIME))
+		return false;
+
+	trace = Game_Trace(origin, nav_mins, nav_maxs, origin, NULL, NAV_MASK);
+
+	if (trace.startsolid)
+		return false;
+
+	// the same test M_CheckBottom makes, every corner has ground within a step
+	for (x = 0; x <= 1; x++)
+	{
+		for (y = 0; y <= 1; y++)
+		{
+			start[0] = end[0] = origin[0] + (x ? nav_maxs[0] : nav_mins[0]);
+			start[1] = end[1] = origin[1] + (y ? nav_maxs[1] : nav_mins[1]);
+			start[2] = origin[2] + nav_mins[2] + NAV_STEP;
+			end[2] = origin[2] + nav_mins[2] - NAV_STEP;
+
+			trace = Game_Trace(start, NULL, NULL, end, NULL, NAV_MASK);
+
+			if (trace.fraction == 1.0f || trace.allsolid)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+=============
+Nav_SampleColumn
+
+Adds a node for every floor in the column a monster could stand on
+=============
+*/
+static void Nav_SampleColumn(int32_t x, int32_t y, float bottom, float top)
+{
+	nav_node_t*	node;
+	vec3_t		start, end, origin;
+	trace_t		trace;
+	int32_t		floors;
+
+	VectorSet3(start, (float)(x * NAV_SPACING), (float)(y * NAV_SPACING), top);
+	VectorSet3(end, start[0], start[1], bottom);
+
+	// come down out of whatever the top of the column is buried in
+	while (start[2] > bottom
+		&& (Game_PointContents(start) & NAV_MASK))
+		start[2] -= NAV_STEP;
+
+	for (floors = 0; floors < NAV_MAX_FLOORS && start[2] > bottom; floors++)
+	{
+		trace = Game_Trace(start, NULL, NULL, end, NULL, NAV_MASK);
+
+		if (trace.fraction == 1.0f
+			|| trace.allsolid
+			|| (trace.startsolid && trace.fraction == 0.0f))
+			return;
+
+		VectorSet3(origin, start[0], start[1], trace.endpos[2] - nav_mins[2] + 1);
+
+		if (trace.plane.normal[2] >= 0.7f
+			&& Nav_CanStand(origin))
+		{
+			if (nav_num_nodes == NAV_MAX_NODES)
+				return;
+
+			node = &nav_nodes[nav_num_nodes++];
+			VectorCopy3(origin, node->origin);
+			memset(node->links, -1, sizeof(node->links));
+		}
+
+		start[2] = trace.endpos[2] - 1;
+	}
+}
+
+/*
+=============
+Nav_CanWalk
+
+True if a monster can walk from one node to the other
+=============
+*/
+static bool Nav_CanWalk(nav_node_t* from, nav_node_t* to)
+{
+	vec3_t	start, end;
+	trace_t	trace;
+	int32_t	i;
+
+	// stepped up, so stairs don't block it
+	VectorCopy3(from->origin, start);
+	VectorCopy3(to->origin, end);
+	start[2] += NAV_STEP;
+	end[2] += NAV_STEP;
+
+	trace = Game_Trace(start, nav_mins, nav_maxs, end, NULL, NAV_MASK);
+
+	if (trace.fraction < 1.0f || trace.startsolid)
+		return false;
+
+	// and there is no gap in between
+	for (i = 0; i < 3; i++)
+		start[i] = end[i] = (from->origin[i] + to->origin[i]) * 0.5f;
+
+	start[2] += NAV_STEP;
+	end[2] += nav_mins[2] - NAV_MAX_RISE;
+
+	trace = Game_Trace(start, NULL, NULL, end, NULL, NAV_MASK);
+
+	return (trace.fraction < 1.0f && !trace.allsolid);
+}
+
+/*
+=============
+Nav_FindInColumn
+
+The node in the column nearest height z, within the given height
+=============
+*/
+static int32_t Nav_FindInColumn(int32_t x, int32_t y, float z, float range)
+{
+	int32_t	i, best;
+	float	dz, best_dz;
+
+	best = -1;
+	best_dz = range;
+
+	for (i = nav_hash[Nav_Bucket(x, y)]; i >= 0; i = nav_node_next[i])
+	{
+		if (Nav_Column(nav_nodes[i].origin[0]) != x
+			|| Nav_Column(nav_nodes[i].origin[1]) != y)
+			continue;
+
+		dz = fabsf(nav_nodes[i].origin[2] - z);
+
+		if (dz <= best_dz)
+		{
+			best = i;
+			best_dz = dz;
+		}
+	}
+
+	return best;
+}
+
+/*
+=============
+Nav_Build
+
+Samples the floor around every entity in the level and links it up
+=============
+*/
+static void Nav_Build()
+{
+	edict_t*	ent;
+	nav_node_t*	node;
+	vec3_t		mins, maxs;
+	int32_t		i, x, y, dir, other;
+
+	// the level is wherever its entities are
+	VectorSet3(mins, NAV_WORLD_LIMIT, NAV_WORLD_LIMIT, NAV_WORLD_LIMIT);
+	VectorSet3(maxs, -NAV_WORLD_LIMIT, -NAV_WORLD_LIMIT, -NAV_WORLD_LIMIT);
+
+	for (ent = EdictList_Next(g_edicts); ent; ent = EdictList_Next(ent))
+	{
+		for (i = 0; i < 3; i++)
+		{
+			if (ent->s.origin[i] < mins[i])
+				mins[i] = ent->s.origin[i];
+
+			if (ent->s.origin[i] > maxs[i])
+				maxs[i] = ent->s.origin[i];
+		}
+	}
+
+	if (mins[0] > maxs[0])
+		return;
+
+	mins[0] -= NAV_MARGIN;
+	mins[1] -= NAV_MARGIN;
+	mins[2] -= NAV_MARGIN / 2;
+	maxs[0] += NAV_MARGIN;
+	maxs[1] += NAV_MARGIN;
+	maxs[2] += NAV_MARGIN;
+
+	for (i = 0; i < 3; i++)
+	{
+		mins[i] = (mins[i] < -NAV_WORLD_LIMIT) ? -NAV_WORLD_LIMIT : mins[i];
+		maxs[i] = (maxs[i] > NAV_WORLD_LIMIT) ? NAV_WORLD_LIMIT : maxs[i];
+	}
+
+	nav_nodes = gi.TagMalloc(NAV_MAX_NODES * sizeof(nav_nodes[0]), TAG_LEVEL);
+
+	for (x = Nav_Column(mins[0]); x <= Nav_Column(maxs[0]); x++)
+	{
+		for (y = Nav_Column(mins[1]); y <= Nav_Column(maxs[1]); y++)
+			Nav_SampleColumn(x, y, mins[2], maxs[2]);
+	}
+
+	if (nav_num_nodes == NAV_MAX_NODES)
+		gi.dprintf("Nav_Build: more than %i nodes, part of the level is left out\n", NAV_MAX_NODES);
+
+	Nav_Finish();
+
+	// link each pair once, both ways
+	for (i = 0; i < nav_num_nodes; i++)
+	{
+		node = &nav_nodes[i];
+
+		for (dir = 0; dir < 4; dir++)
+		{
+			other = Nav_FindInColumn(Nav_Column(node->origin[0]) + nav_dirs[dir][0], Nav_Column(node->origin[1]) + nav_dirs[dir][1],
+				node->origin[2], NAV_MAX_RISE);
+
+			if (other < 0
+				|| !Nav_CanWalk(node, &nav_nodes[other]))
+				continue;
+
+			node->links[dir] = other;
+			nav_nodes[other].links[dir + 4] = i;
+			nav_stats.links++;
+		}
+	}
+}
+
+/*
+=============
+Nav_ReadFile
+
+Reads the graph back from the cache file, if it was made for this level
+=============
+*/
+static bool Nav_ReadFile(char* filename)
+{
+	nav_header_t	header;
+	FILE*			f;
+	int32_t			i, dir;
+
+	f = fopen(filename, "rb");
+
+	if (!f)
+		return false;
+
+	if (fread(&header, sizeof(header), 1, f) != 1
+		|| header.ident != NAV_FILE_IDENT
+		|| header.version != NAV_FILE_VERSION
+		|| header.checksum != level.nav_checksum
+		|| header.spacing != NAV_SPACING
+		|| header.num_nodes <= 0
+		|| header.num_nodes > NAV_MAX_NODES)
+	{
+		fclose(f);
+		return false;
+	}
+
+	nav_nodes = gi.TagMalloc(header.num_nodes * sizeof(nav_nodes[0]), TAG_LEVEL);
+	nav_num_nodes = header.num_nodes;
+
+	if (fread(nav_nodes, sizeof(nav_nodes[0]), nav_num_nodes, f) != (size_t)nav_num_nodes)
+	{
+		fclose(f);
+		Nav_Clear(NULL);
+		return false;
+	}
+
+	fclose(f);
+
+	for (i = 0; i < nav_num_nodes; i++)
+	{
+		for (dir = 0; dir < 8; dir++)
+		{
+			if (nav_nodes[i].links[dir] >= nav_num_nodes)
+			{
+				gi.dprintf("%s is damaged, rebuilding it\n", filename);
+				Nav_Clear(NULL);
+				return false;
+			}
+
+			if (dir < 4 && nav_nodes[i].links[dir] >= 0)
+				nav_stats.links++;
+		}
+	}
+
+	Nav_Finish();
+	return true;
+}
+
+static void Nav_WriteFile(char* filename)
+{
+	nav_header_t	header;
+	FILE*			f;
+
+	f = fopen(filename, "wb");
+
+	if (!f)
+	{
+		gi.dprintf("Couldn't write %s\n", filename);
+		return;
+	}
+
+	header.ident = NAV_FILE_IDENT;
+	header.version = NAV_FILE_VERSION;
+	header.checksum = level.nav_checksum;
+	header.spacing = NAV_SPACING;
+	header.num_nodes = nav_num_nodes;
+
+	fwrite(&header, sizeof(header), 1, f);
+	fwrite(nav_nodes, sizeof(nav_nodes[0]), nav_num_nodes, f);
+	fclose(f);
+}
+
+/*
+=============
+Nav_Init
+
+Loads or builds the graph for the level, called once it is spawned or loaded
+=============
+*/
+void Nav_Init()
+{
+	char	filename[MAX_OSPATH];
+	cvar_t*	game;
+	int64_t	start;
+
+	if (!sv_nav->value)
+		return;
+
+	start = Sys_Nanoseconds();
+	game = gi.Cvar_Get("game_asset_path", "", 0);
+	Com_sprintf(filename, sizeof(filename), "%s/%s.nav", game->string[0] ? game->string : GAME_NAME, level.mapname);
+
+	nav_stats.loaded = Nav_ReadFile(filename);
+
+	if (!nav_stats.loaded)
+	{
+		Nav_Build();
+
+		if (nav_num_nodes)
+			Nav_WriteFile(filename);
+	}
+
+	nav_stats.build_ms = (Sys_Nanoseconds() - start) / 1000000.0f;
+
+	gi.dprintf("%i navigation nodes, %i links %s in %.2f ms\n", nav_num_nodes, nav_stats.links,
+		nav_stats.loaded ? "read" : "built", nav_stats.build_ms);
+}
+
+/*
+==============================================================================
+
+PATH FINDING
+
+==============================================================================
+*/
+
+/*
+=============
+Nav_FindNode
+
+The node nearest origin, searching its own column and the ones around it
+=============
+*/
+int32_t Nav_FindNode(vec3_t origin)
+{
+	int32_t	x, y, cx, cy, i, best;
+	float	dist, best_dist;
+
+	if (!nav_num_nodes)
+		return -1;
+
+	cx = Nav_Column(origin[0]);
+	cy = Nav_Column(origin[1]);
+	best = -1;
+	best_dist = NAV_SPACING * 2;
+
+	for (x = cx - 1; x <= cx + 1; x++)
+	{
+		for (y = cy - 1; y <= cy + 1; y++)
+		{
+			for (i = nav_hash[Nav_Bucket(x, y)]; i >= 0; i = nav_node_next[i])
+			{
+				if (fabsf(nav_nodes[i].origin[2] - origin[2]) > NAV_MAX_RISE * 2)
+					continue;
+
+				dist = Nav_Distance(nav_nodes[i].origin, origin);
+
+				if (dist < best_dist)
+				{
+					best = i;
+					best_dist = dist;
+				}
+			}
+		}
+	}
+
+	return best;
+}
+
+static void Nav_HeapPush(nav_heap_t* heap, float f, float cost, int32_t node)
+{
+	nav_heap_entry_t	entry;
+	int32_t				i, parent;
+
+	entry.f = f;
+	entry.cost = cost;
+	entry.node = node;
+
+	for (i = heap->count++; i > 0; i = parent)
+	{
+		parent = (i - 1) / 2;
+
+		if (heap->entries[parent].f <= f)
+			break;
+
+		heap->entries[i] = heap->entries[parent];
+	}
+
+	heap->entries[i] = entry;
+}
+
+static nav_heap_entry_t Nav_HeapPop(nav_heap_t* heap)
+{
+	nav_heap_entry_t	top, last;
+	int32_t				i, child;
+
+	top = heap->entries[0];
+	last = heap->entries[--heap->count];
+
+	for (i = 0; (child = i * 2 + 1) < heap->count; i = child)
+	{
+		if (child + 1 < heap->count && heap->entries[child + 1].f < heap->entries[child].f)
+			child++;
+
+		if (last.f <= heap->entries[child].f)
+			break;
+
+		heap->entries[i] = heap->entries[child];
+	}
+
+	heap->entries[i] = last;
+	return top;
+}
+
+/*
+=============
+Nav_Search
+
+Carries on the tree's search until it settles start. The heuristic aims at
+start, the nodes it already settled have their true cost whatever it aimed
+at before, so only the open nodes have to be sorted again.
+=============
+*/
+static bool Nav_Search(nav_tree_t* tree, int32_t start)
+{
+	nav_heap_entry_t	entry;
+	nav_node_t*			node;
+	int32_t				i, dir, other;
+	float				cost;
+
+	nav_stats.searches++;
+	nav_heap.count = 0;
+
+	for (i = 0; i < nav_num_nodes && nav_heap.count < tree->open; i++)
+	{
+		if (tree->state[i] == NAV_OPEN)
+			Nav_HeapPush(&nav_heap, tree->cost[i] + Nav_Distance(nav_nodes[i].origin, nav_nodes[start].origin), tree->cost[i], i);
+	}
+
+	while (nav_heap.count)
+	{
+		entry = Nav_HeapPop(&nav_heap);
+
+		// pushed again since with a lower cost
+		if (tree->state[entry.node] == NAV_CLOSED
+			|| entry.cost != tree->cost[entry.node])
+			continue;
+
+		tree->state[entry.node] = NAV_CLOSED;
+		tree->open--;
+		nav_stats.expanded++;
+
+		node = &nav_nodes[entry.node];
+
+		for (dir = 0; dir < 8; dir++)
+		{
+			other = node->links[dir];
+
+			if (other < 0
+				|| tree->state[other] == NAV_CLOSED)
+				continue;
+
+			cost = tree->cost[entry.node] + Nav_Distance(node->origin, nav_nodes[other].origin);
+
+			if (tree->state[other] == NAV_OPEN
+				&& cost >= tree->cost[other])
+				continue;
+
+			if (tree->state[other] == NAV_UNSEEN)
+				tree->open++;
+
+			tree->state[other] = NAV_OPEN;
+			tree->cost[other] = cost;
+			tree->next[other] = entry.node;
+			Nav_HeapPush(&nav_heap, cost + Nav_Distance(nav_nodes[other].origin, nav_nodes[start].origin), cost, other);
+		}
+
+		// expanded before stopping, a later search carrying on from here relies on every closed node having been
+		if (entry.node == start)
+			return true;
+	}
+
+	// can't get there from here
+	return false;
+}
+
+/*
+=============
+Nav_FindTree
+
+The search towards goal, started if nobody has asked for it lately
+=============
+*/
+static nav_tree_t* Nav_FindTree(int32_t goal)
+{
+	nav_tree_t*	tree;
+	nav_tree_t*	oldest;
+	int32_t		i;
+
+	oldest = &nav_trees[0];
+
+	for (i = 0; i < NAV_MAX_TREES; i++)
+	{
+		tree = &nav_trees[i];
+
+		if (tree->goal == goal
+			&& level.time - tree->time < NAV_TREE_LIFETIME
+			&& tree->time <= level.time)
+			return tree;
+
+		if (tree->goal < 0 || tree->time < oldest->time)
+			oldest = tree;
+	}
+
+	tree = oldest;
+	tree->goal = goal;
+	tree->time = level.time;
+	memset(tree->state, NAV_UNSEEN, nav_num_nodes * sizeof(tree->state[0]));
+	tree->state[goal] = NAV_OPEN;
+	tree->cost[goal] = 0;
+	tree->next[goal] = goal;
+	tree->open = 1;
+
+	return tree;
+}
+
+/*
+=============
+Nav_SteerTowards
+
+Fills in waypoint with where self should head next to get to goal along the
+graph. Returns false if there is no graph, either end is off it, or they are
+on the same node, and the caller should head straight for goal.
+=============
+*/
+bool Nav_SteerTowards(edict_t* self, vec3_t goal, vec3_t waypoint)
+{
+	nav_tree_t*	tree;
+	int32_t		start, end, node;
+
+	if (!nav_num_nodes
+		|| !sv_nav->value)
+		return false;
+
+	start = Nav_FindNode(self->s.origin);
+	end = Nav_FindNode(goal);
+
+	if (start < 0 || end < 0 || start == end)
+		return false;
+
+	nav_stats.queries++;
+	tree = Nav_FindTree(end);
+
+	if (tree->state[start] == NAV_CLOSED)
+		nav_stats.reused++;
+	else if (!tree->open
+		|| !Nav_Search(tree, start))
+		return false;
+
+	// don't turn back for a node it is already on top of
+	node = tree->next[start];
+
+	while (node != end
+		&& Nav_Distance(nav_nodes[node].origin, self->s.origin) < NAV_REACHED)
+		node = tree->next[node];
+
+	if (node == end)
+		VectorCopy3(goal, waypoint);
+	else
+		VectorCopy3(nav_nodes[node].origin, waypoint);
+
+	return true;
+}
+
+/*
+==============================================================================
+
+FLOW FIELDS
+
+==============================================================================
+
+A horde chasing one player would otherwise each feel their own way there
+with SV_NewChaseDir, which only knows which way the player is and tries up
+to ten directions a step to get round whatever is in the way. Instead every
+target that is being chased gets a field: for every node, the next node on
+the shortest way to the node the target is on. When a monster chasing it
+can't go straight at it, SV_NewChaseDir tries the way from the monster's
+node to the next one first, and following the field costs the same however
+many monsters follow it.
+
+When the target moves to another node the field is worked out again, a
+Dijkstra out from the new node, only as far as it needs to go if the target
+hasn't gone far (see Nav_StartField). Only sv_flowbudget nodes are settled
+a frame over all the fields, so a rebuild can take a few frames, and until
+it is done monsters keep following the old field, which still leads to where
+the target just was. sv_flowbudget 0 turns the fields off.
+*/
+
+/*
+=============
+Nav_StartField
+
+Starts working the field out again for where its target is now. If the
+target is still close to where it was when the whole field was last worked
+out, only the nodes around it are done again. Further out the old field
+still leads into them, and from there the new one leads on to the target,
+so nobody walks in circles. That only holds if the old goal is among them,
+otherwise it would be left leading nowhere but itself, so Nav_ContinueField
+starts again with the whole field if it isn't.
+=============
+*/
+static void Nav_StartField(nav_field_t* field, bool repair)
+{
+	int32_t	goal;
+
+	goal = field->target_node;
+	nav_build_field = field;
+	nav_build_goal = goal;
+	nav_build_limit = -1;
+
+	// the further the target gets from there, the further out the old field leads monsters astray
+	if (repair
+		&& field->goal >= 0
+		&& field->next[goal] >= 0
+		&& field->cost[goal] <= NAV_FIELD_REPAIR / 2
+		&& Nav_Distance(nav_nodes[goal].origin, nav_nodes[field->whole_goal].origin) <= NAV_FIELD_REPAIR / 2)
+		nav_build_limit = NAV_FIELD_REPAIR;
+
+	memset(nav_build_state, NAV_UNSEEN, nav_num_nodes * sizeof(nav_build_state[0]));
+
+	nav_build_state[goal] = NAV_OPEN;
+	nav_build_cost[goal] = 0;
+	nav_build_next[goal] = goal;
+	nav_build_num_closed = 0;
+	nav_build_heap.count = 0;
+	Nav_HeapPush(&nav_build_heap, 0, 0, goal);
+}
+
+/*
+=============
+Nav_ContinueField
+
+Settles up to budget nodes of the field being built, and hands it over once
+they are all done. Returns the number settled.
+=============
+*/
+static int32_t Nav_ContinueField(int32_t budget)
+{
+	nav_heap_entry_t	entry;
+	nav_node_t*			node;
+	nav_field_t*		field;
+	int32_t				settled, dir, other, i;
+	float				cost;
+
+	settled = 0;
+
+	while (nav_build_heap.count && settled < budget)
+	{
+		entry = Nav_HeapPop(&nav_build_heap);
+
+		if (nav_build_state[entry.node] == NAV_CLOSED
+			|| entry.cost != nav_build_cost[entry.node])
+			continue;
+
+		// far enough, everything left keeps following the old field
+		if (nav_build_limit >= 0
+			&& entry.cost > nav_build_limit)
+		{
+			nav_build_heap.count = 0;
+			break;
+		}
+
+		nav_build_state[entry.node] = NAV_CLOSED;
+		nav_build_closed[nav_build_num_closed++] = entry.node;
+		settled++;
+		node = &nav_nodes[entry.node];
+
+		for (dir = 0; dir < 8; dir++)
+		{
+			other = node->links[dir];
+
+			if (other < 0
+				|| nav_build_state[other] == NAV_CLOSED)
+				continue;
+
+			cost = entry.cost + Nav_Distance(node->origin, nav_nodes[other].origin);
+
+			if (nav_build_state[other] == NAV_OPEN
+				&& cost >= nav_build_cost[other])
+				continue;
+
+			nav_build_state[other] = NAV_OPEN;
+			nav_build_cost[other] = cost;
+			nav_build_next[other] = entry.node;
+			Nav_HeapPush(&nav_build_heap, cost, cost, other);
+		}
+	}
+
+	nav_stats.field_settled += settled;
+
+	if (!nav_build_heap.count)
+	{
+		field = nav_build_field;
+
+		if (nav_build_limit >= 0
+			&& nav_build_state[field->goal] != NAV_CLOSED)
+		{
+			Nav_StartField(field, false);
+			return settled;
+		}
+
+		// a whole new field, anything it didn't reach can't be reached
+		if (nav_build_limit < 0)
+		{
+			memset(field->next, -1, nav_num_nodes * sizeof(field->next[0]));
+			field->whole_goal = nav_build_goal;
+		}
+
+		for (i = 0; i < nav_build_num_closed; i++)
+		{
+			other = nav_build_closed[i];
+			field->next[other] = nav_build_next[other];
+			field->cost[other] = nav_build_cost[other];
+		}
+
+		field->goal = nav_build_goal;
+		nav_build_field = NULL;
+		nav_stats.field_builds++;
+	}
+
+	return settled;
+}
+
+static void Nav_DropField(nav_field_t* field)
+{
+	if (nav_build_field == field)
+		nav_build_field = NULL;
+
+	field->target = NULL;
+}
+
+/*
+=============
+Nav_UpdateFields
+
+Called once each frame before anything thinks, drops fields nobody is
+following and carries on rebuilding the ones whose target has moved
+=============
+*/
+void Nav_UpdateFields()
+{
+	nav_field_t*	field;
+	int32_t			i, node, budget;
+
+	nav_stats.frame_settled = 0;
+
+	if (!nav_num_nodes
+		|| sv_flowbudget->value <= 0)
+		return;
+
+	for (i = 0; i < NAV_MAX_FIELDS; i++)
+	{
+		field = &nav_fields[i];
+
+		if (!field->target)
+			continue;
+
+		if (!field->target->inuse
+			|| level.time - field->used > NAV_FIELD_LIFETIME)
+		{
+			Nav_DropField(field);
+			continue;
+		}
+
+		// keep the last node while the target is off the graph, jumping or falling
+		node = Nav_FindNode(field->target->s.origin);
+
+		if (node >= 0)
+			field->target_node = node;
+	}
+
+	budget = sv_flowbudget->value;
+
+	while (budget > 0)
+	{
+		if (!nav_build_field)
+		{
+			// take turns, so one player running about can't hold the rest up
+			for (i = 0; i < NAV_MAX_FIELDS; i++)
+			{
+				field = &nav_fields[(nav_field_cursor + i) % NAV_MAX_FIELDS];
+
+				if (field->target
+					&& field->target_node >= 0
+					&& field->target_node != field->goal)
+					break;
+			}
+
+			if (i == NAV_MAX_FIELDS)
+				break;
+
+			nav_field_cursor = (nav_field_cursor + i + 1) % NAV_MAX_FIELDS;
+			Nav_StartField(field, true);
+		}
+
+		i = Nav_ContinueField(budget);
+		budget -= i;
+		nav_stats.frame_settled += i;
+	}
+}
+
+/*
+=============
+Nav_FindField
+
+The field for target, a new one if nobody has chased it lately
+=============
+*/
+static nav_field_t* Nav_FindField(edict_t* target)
+{
+	nav_field_t*	field;
+	nav_field_t*	oldest;
+	int32_t			i;
+
+	oldest = &nav_fields[0];
+
+	for (i = 0; i < NAV_MAX_FIELDS; i++)
+	{
+		field = &nav_fields[i];
+
+		if (field->target == target)
+			return field;
+
+		if (!field->target
+			|| (oldest->target && field->used < oldest->used))
+			oldest = field;
+	}
+
+	field = oldest;
+	Nav_DropField(field);
+	field->target = target;
+	field->target_node = Nav_FindNode(target->s.origin);
+	field->goal = -1;
+	field->used = level.time;
+
+	return field;
+}
+
+/*
+=============
+Nav_FlowDirection
+
+Fills in dir with the way self should walk to chase target along target's
+field, a step between two nodes so monsters side by side keep apart rather
+than all heading for the same node. Returns false if it has no field yet,
+self is off the graph or can't get there along it, or target is on the next
+node already and self should go straight for it.
+=============
+*/
+bool Nav_FlowDirection(edict_t* self, edict_t* target, vec3_t dir)
+{
+	nav_field_t*	field;
+	int32_t			node, next;
+
+	if (!nav_num_nodes
+		|| sv_flowbudget->value <= 0)
+		return false;
+
+	field = Nav_FindField(target);
+	field->used = level.time;
+	nav_stats.field_samples++;
+
+	if (field->goal < 0)
+		return false;
+
+	node = Nav_FindNode(self->s.origin);
+
+	if (node < 0
+		|| node == field->goal)
+		return false;
+
+	next = field->next[node];
+
+	if (next < 0
+		|| next == field->goal)
+		return false;
+
+	VectorSubtract3(nav_nodes[next].origin, nav_nodes[node].origin, dir);
+	nav_stats.field_steered++;
+
+	return true;
+}
+
+/*
+=============
+Nav_PrintStats
+
+sv nav
+=============
+*/
+void Nav_PrintStats()
+{
+	int32_t	i, count;
+
+	if (!nav_num_nodes)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "No navigation graph%s\n", sv_nav->value ? "" : ", sv_nav is 0");
+		return;
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "Navigation graph: %i nodes, %i links, %s in %.2f ms\n", nav_num_nodes, nav_stats.links,
+		nav_stats.loaded ? "read" : "built", nav_stats.build_ms);
+	gi.cprintf(NULL, PRINT_HIGH, "  %lli paths asked for, %lli (%.1f%%) already known\n", (long long)nav_stats.queries, (long long)nav_stats.reused,
+		nav_stats.queries ? 100.0 * nav_stats.reused / nav_stats.queries : 0.0);
+	gi.cprintf(NULL, PRINT_HIGH, "  %lli searches, %.1f nodes expanded each\n", (long long)nav_stats.searches,
+		nav_stats.searches ? (double)nav_stats.expanded / nav_stats.searches : 0.0);
+
+	count = 0;
+
+	for (i = 0; i < NAV_MAX_FIELDS; i++)
+	{
+		if (nav_fields[i].target)
+			count++;
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "Flow fields:%s\n", (sv_flowbudget->value > 0) ? "" : " (off)");
+	gi.cprintf(NULL, PRINT_HIGH, "  %i in use, %lli built, %.1f nodes settled a frame, %i last frame\n", count, (long long)nav_stats.field_builds,
+		level.framenum ? (double)nav_stats.field_settled / level.framenum : 0.0, nav_stats.frame_settled);
+	gi.cprintf(NULL, PRINT_HIGH, "  %lli samples, %lli (%.1f%%) gave a direction\n", (long long)nav_stats.field_samples, (long long)nav_stats.field_steered,
+		nav_stats.field_samples ? 100.0 * nav_stats.field_steered / nav_stats.field_samples : 0.0);
+}
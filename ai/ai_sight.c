@@ -0,0 +1,303 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// ai_sight.c : Which clients each monster can see
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+SIGHT PASS
+
+==============================================================================
+
+AI_FindTarget used to look at level.sight_client only, one client a frame,
+so with 16 players a monster could take 16 frames to notice the one in front
+of it. Once a frame, before anything thinks, AI_UpdateSight works out which
+clients every monster that is looking for a target could see, and
+AI_FindTarget picks the best of them straight away.
+
+A client is visible if it passes the same tests AI_FindTarget makes: alive,
+targetable, lit, on another team (unless friendly fire is on), closer than
+RANGE_FAR, in the PVS and not blocked (Edict_CanSee). Which way the monster
+is facing is left to AI_FindTarget, it can turn before then.
+
+The traces are capped at sv_sightbudget a frame. Monsters are visited round
+robin, and any that weren't reached this frame fall back to checking
+level.sight_client. sv_sightbudget 0 turns the pass off.
+*/
+
+#define AI_SIGHT_WORDS		(MAX_CLIENTS / 32)
+
+typedef struct ai_sight_s
+{
+	uint32_t	visible[AI_SIGHT_WORDS];	// bit per client, client 1 is bit 0
+	int32_t		pass;						// ai_sight_pass when visible was filled in
+} ai_sight_t;
+
+typedef struct ai_sight_stats_s
+{
+	int32_t		monsters;		// monsters visited
+	int32_t		skipped;		// monsters looking for a target that the budget didn't reach
+	int32_t		pvs_rejects;
+	int32_t		traces;
+	int32_t		visible;		// monster/client pairs that can see each other
+} ai_sight_stats_t;
+
+static ai_sight_t		ai_sight[MAX_EDICTS];
+static int32_t			ai_sight_pass;				// never reset, so old rows are never mistaken for new ones
+static int32_t			ai_sight_cursor;			// edict the next pass starts at
+static ai_sight_stats_t	ai_sight_stats;				// last pass
+
+static edict_t*			ai_sight_clients[MAX_CLIENTS];
+static int32_t			ai_sight_num_clients;
+
+/*
+=============
+AI_WantsTarget
+
+True if AI_FindTarget would look at level.sight_client for this monster
+=============
+*/
+static bool AI_WantsTarget(edict_t* self)
+{
+	if (!(self->svflags & SVF_MONSTER)
+		|| self->health <= 0
+		|| self->think_asleep)
+		return false;
+
+	// not thinking this frame, ai_lod.c has slowed it down
+	if (self->nextthink > level.time + 0.001)
+		return false;
+
+	if (self->monsterinfo->aiflags & (AI_GOOD_GUY | AI_COMBAT_POINT))
+		return false;
+
+	return (!self->enemy || (self->monsterinfo->aiflags & AI_SOUND_TARGET));
+}
+
+static bool AI_SightClientValid(edict_t* client)
+{
+	return (client->inuse
+		&& client->health > 0
+		&& !(client->flags & FL_NOTARGET)
+		&& client->light_level > 5);
+}
+
+static void AI_UpdateMonsterSight(edict_t* self)
+{
+	ai_sight_t*	sight;
+	edict_t*	client;
+	vec3_t		spot1, spot2;
+	int32_t		i, bit;
+
+	sight = &ai_sight[self - g_edicts];
+	memset(sight->visible, 0, sizeof(sight->visible));
+	sight->pass = ai_sight_pass;
+
+	VectorCopy3(self->s.origin, spot1);
+	spot1[2] += self->viewheight;
+
+	for (i = 0; i < ai_sight_num_clients; i++)
+	{
+		client = ai_sight_clients[i];
+
+		if (self->team == client->team
+			&& !((int32_t)gameflags->value & GF_ITEM_FRIENDLY_FIRE))
+			continue;
+
+		if (AI_GetRange(self, client) == RANGE_FAR)
+			continue;
+
+		VectorCopy3(client->s.origin, spot2);
+		spot2[2] += client->viewheight;
+
+		if (!gi.inPVS(spot1, spot2))
+		{
+			ai_sight_stats.pvs_rejects++;
+			continue;
+		}
+
+		ai_sight_stats.traces++;
+
+		if (!Edict_CanSee(self, client))
+			continue;
+
+		bit = (client - g_edicts) - 1;
+		sight->visible[bit >> 5] |= 1u << (bit & 31);
+		ai_sight_stats.visible++;
+	}
+}
+
+/*
+=============
+AI_UpdateSight
+
+Called once each frame after AI_SetSightClient
+=============
+*/
+void AI_UpdateSight()
+{
+	edict_t*	ent;
+	int32_t		i, first, index, count, num_edicts;
+
+	ai_sight_pass++;
+	memset(&ai_sight_stats, 0, sizeof(ai_sight_stats));
+
+	if (sv_sightbudget->value <= 0)
+		return;
+
+	ai_sight_num_clients = 0;
+
+	for (i = 1; i <= game.maxclients; i++)
+	{
+		ent = &g_edicts[i];
+
+		if (AI_SightClientValid(ent))
+			ai_sight_clients[ai_sight_num_clients++] = ent;
+	}
+
+	if (!ai_sight_num_clients)
+		return;
+
+	// start where the last pass ran out of budget, so every monster gets its turn
+	first = game.maxclients + 1;
+	num_edicts = globals.num_edicts - first;
+
+	if (num_edicts <= 0)
+		return;
+
+	if (ai_sight_cursor < first || ai_sight_cursor >= globals.num_edicts)
+		ai_sight_cursor = first;
+
+	index = ai_sight_cursor;
+
+	for (count = 0; count < num_edicts; count++)
+	{
+		ent = &g_edicts[index];
+
+		if (ent->inuse
+			&& AI_WantsTarget(ent))
+		{
+			if (ai_sight_stats.traces + ai_sight_num_clients > sv_sightbudget->value)
+			{
+				// the next pass starts with the first monster this one didn't get to
+				if (!ai_sight_stats.skipped)
+					ai_sight_cursor = index;
+
+				ai_sight_stats.skipped++;
+			}
+			else
+			{
+				AI_UpdateMonsterSight(ent);
+				ai_sight_stats.monsters++;
+			}
+		}
+
+		if (++index >= globals.num_edicts)
+			index = first;
+	}
+}
+
+/*
+=============
+AI_PickSightClient
+
+Returns the client self should go after from this frame's sight pass, the
+closest one it can see that it is also facing if it has to be. Sets
+*checked if the pass saw to self this frame, otherwise the caller has to
+fall back to level.sight_client.
+=============
+*/
+edict_t* AI_PickSightClient(edict_t* self, bool* checked)
+{
+	ai_sight_t*	sight;
+	edict_t*	client;
+	edict_t*	best;
+	vec3_t		v;
+	float		dist, best_dist;
+	uint32_t	word;
+	int32_t		i, bit, r;
+
+	sight = &ai_sight[self - g_edicts];
+	*checked = (sv_sightbudget->value > 0 && sight->pass == ai_sight_pass);
+
+	if (!*checked)
+		return NULL;
+
+	best = NULL;
+	best_dist = 0;
+
+	for (i = 0; i < AI_SIGHT_WORDS; i++)
+	{
+		for (word = sight->visible[i]; word; word &= word - 1)
+		{
+			// lowest set bit
+			for (bit = 0; !(word & (1u << bit)); bit++)
+				;
+
+			client = &g_edicts[i * 32 + bit + 1];
+
+			// something earlier this frame may have killed it
+			if (!AI_SightClientValid(client))
+				continue;
+
+			// same rules as AI_FindTarget, show_hostile lets a near client be noticed from behind
+			r = AI_GetRange(self, client);
+
+			if (r == RANGE_FAR)
+				continue;
+
+			if (r == RANGE_MID
+				|| (r == RANGE_NEAR && client->show_hostile < level.time))
+			{
+				if (!Edict_IsInFront(self, client))
+					continue;
+			}
+
+			VectorSubtract3(client->s.origin, self->s.origin, v);
+			dist = VectorLength3(v);
+
+			if (!best || dist < best_dist)
+			{
+				best = client;
+				best_dist = dist;
+			}
+		}
+	}
+
+	return best;
+}
+
+/*
+=============
+AI_PrintSightStats
+
+Prints the last sight pass for sv stats
+=============
+*/
+void AI_PrintSightStats()
+{
+	gi.cprintf(NULL, PRINT_HIGH, "Sight:%s\n", (sv_sightbudget->value > 0) ? "" : " (off)");
+	gi.cprintf(NULL, PRINT_HIGH, "  last frame  %5i monsters, %i left for later, %i traces of %g, %i pvs rejects, %i can see\n",
+		ai_sight_stats.monsters, ai_sight_stats.skipped, ai_sight_stats.traces, sv_sightbudget->value,
+		ai_sight_stats.pvs_rejects, ai_sight_stats.visible);
+}
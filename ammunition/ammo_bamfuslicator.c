@@ -24,6 +24,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 
 #define BAMFUSLICATOR_MIN_DISTANCE		64		// so you don't get stuck
 #define BAMFUSLICATOR_MAX_DISTANCE		768
+#define BAMFUSLICATOR_MAX_OVERLAPS		64		// edicts looked at around the player and the new monster
 
 /* Bamfuslicator */
 void Ammo_Bamfuslicator(edict_t* self, vec3_t start, vec3_t aimdir, zombie_type zombie_type)
@@ -31,8 +32,9 @@ void Ammo_Bamfuslicator(edict_t* self, vec3_t start, vec3_t aimdir, zombie_type
 	// Sorry for anyone reading this code
 	
 	edict_t*	monster = { 0 };
-	edict_t*	within_player_bounds[MAX_EDICTS] = { 0 };
-	edict_t*	within_monster_bounds[MAX_EDICTS] = { 0 };
+	edict_t**	within_player_bounds;
+	edict_t**	within_monster_bounds;
+	int32_t		mark;
 	trace_t		trace = { 0 };
 	vec3_t		trace_start = { 0 };
 	vec3_t		trace_end = { 0 };
@@ -51,7 +53,7 @@ void Ammo_Bamfuslicator(edict_t* self, vec3_t start, vec3_t aimdir, zombie_type
 
 	// raycast from where we fired the weapon
 	// check if we hit somethoing
-	trace = gi.trace(trace_start, NULL, NULL, trace_end, self, CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_SLIME | CONTENTS_LAVA | CONTENTS_WINDOW | CONTENTS_WATER); // zombies don't like water!
+	trace = Game_Trace(trace_start, NULL, NULL, trace_end, self, CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_SLIME | CONTENTS_LAVA | CONTENTS_WINDOW | CONTENTS_WATER); // zombies don't like water!
 
 	// rollback the raycast by a tiny amount because the visual hitbox and the hitbox required to have fun are not the same
 	// horrifying hacks
@@ -136,9 +138,13 @@ void Ammo_Bamfuslicator(edict_t* self, vec3_t start, vec3_t aimdir, zombie_type
 	VectorSubtract3(self->absmin, min_dist, vec_absmin);
 	VectorAdd3(self->absmax, min_dist, vec_absmax);
 
+	mark = FrameArena_Mark();
+	within_player_bounds = FrameArena_Array(edict_t*, BAMFUSLICATOR_MAX_OVERLAPS);
+	within_monster_bounds = FrameArena_Array(edict_t*, BAMFUSLICATOR_MAX_OVERLAPS);
+
 	// see if we are trying to spawn inside of the player
 	// 64 to limit time this function takes as it's recursive (also would there really be more than 64 in a 64x64 box around the player???)
-	int32_t num_within_player_bounds = gi.BoxEdicts( vec_absmin, vec_absmax, &within_player_bounds, 64, AREA_SOLID);
+	int32_t num_within_player_bounds = Spatial_BoxEdicts(vec_absmin, vec_absmax, within_player_bounds, BAMFUSLICATOR_MAX_OVERLAPS, AREA_SOLID);
 
 	for (int32_t edict = 0; edict < num_within_player_bounds; edict++)
 	{
@@ -147,6 +153,7 @@ void Ammo_Bamfuslicator(edict_t* self, vec3_t start, vec3_t aimdir, zombie_type
 			gi.sound(self, CHAN_VOICE, gi.soundindex("weapons/bamfuslicator/spawn_failed.wav"), 1, ATTN_NORM, 0);
 			//todo: push out
 			Edict_Free(monster);
+			FrameArena_Release(mark);
 			return;
 		}
 	}
@@ -156,7 +163,7 @@ void Ammo_Bamfuslicator(edict_t* self, vec3_t start, vec3_t aimdir, zombie_type
 	VectorAdd3(monster->absmax, min_dist, vec_absmax);
 
 	// now see if we are trying to spawn the zombie within another entity...
-	int32_t num_within_monster_bounds = gi.BoxEdicts(vec_absmin, vec_absmax, &within_monster_bounds, 64, AREA_SOLID);
+	int32_t num_within_monster_bounds = Spatial_BoxEdicts(vec_absmin, vec_absmax, within_monster_bounds, BAMFUSLICATOR_MAX_OVERLAPS, AREA_SOLID);
 
 	for (int32_t edict = 0; edict < num_within_monster_bounds; edict++)
 	{
@@ -164,10 +171,13 @@ void Ammo_Bamfuslicator(edict_t* self, vec3_t start, vec3_t aimdir, zombie_type
 		{
 			gi.sound(self, CHAN_VOICE, gi.soundindex("weapons/bamfuslicator/spawn_failed.wav"), 1, ATTN_NORM, 0);
 			Edict_Free(monster);
+			FrameArena_Release(mark);
 			return;
 		}
 	}
 
+	FrameArena_Release(mark);
+
 	// we finally succeded
 	// spawn some nice particles
 	gi.WriteByte(svc_temp_entity);
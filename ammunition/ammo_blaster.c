@@ -70,6 +70,23 @@ void Ammo_Blaster_touch(edict_t* self, edict_t* other, cplane_t* plane, csurface
 	Edict_Free(self);
 }
 
+static projectile_template_t bolt_template =
+{
+	"bolt",
+	"models/objects/laser/tris.md2",
+	"misc/lasfly.wav",
+	MOVETYPE_FLYMISSILE,
+	0,
+	// yes, I know it looks weird that projectiles are deadmonsters
+	// what this means is that when prediction is used against the object
+	// (blaster/hyperblaster shots), the player won't be solid clipped against
+	// the object.  Right now trying to run into a firing hyperblaster
+	// is very jerky since you are predicted 'against' the shots.
+	SVF_DEADMONSTER,
+	Ammo_Blaster_touch,
+	Edict_Free,
+};
+
 void Ammo_Blaster(edict_t* self, vec3_t start, vec3_t dir, int32_t damage, int32_t speed, int32_t effect, bool hyper)
 {
 	edict_t* bolt;
@@ -77,41 +94,22 @@ void Ammo_Blaster(edict_t* self, vec3_t start, vec3_t dir, int32_t damage, int32
 
 	VectorNormalize3(dir);
 
-	bolt = Edict_Spawn();
-	bolt->svflags = SVF_DEADMONSTER;
-	// yes, I know it looks weird that projectiles are deadmonsters
-	// what this means is that when prediction is used against the object
-	// (blaster/hyperblaster shots), the player won't be solid clipped against
-	// the object.  Right now trying to run into a firing hyperblaster
-	// is very jerky since you are predicted 'against' the shots.
-	VectorCopy3(start, bolt->s.origin);
-	VectorCopy3(start, bolt->s.old_origin);
+	bolt = Projectile_Spawn(&bolt_template, self, start);
 	vectoangles(dir, bolt->s.angles);
 	VectorScale3(dir, speed, bolt->velocity);
-	bolt->movetype = MOVETYPE_FLYMISSILE;
-	bolt->clipmask = MASK_SHOT;
-	bolt->solid = SOLID_BBOX;
 	bolt->s.effects |= effect;
-	VectorClear3(bolt->mins);
-	VectorClear3(bolt->maxs);
-	bolt->s.modelindex = gi.modelindex("models/objects/laser/tris.md2");
-	bolt->s.sound = gi.soundindex("misc/lasfly.wav");
-	bolt->owner = self;
-	bolt->touch = Ammo_Blaster_touch;
-	bolt->nextthink = level.time + 2;
-	bolt->think = Edict_Free;
+	Edict_SetNextThink(bolt, level.time + 2);
 	bolt->dmg = damage;
-	bolt->classname = "bolt";
 
 	if (hyper)
 		bolt->spawnflags = 1;
 
-	gi.Edict_Link(bolt);
+	Edict_Link(bolt);
 
 	if (self->client)
 		AI_MonsterCheckDodge(self, bolt->s.origin, dir, speed);
 
-	tr = gi.trace(self->s.origin, NULL, NULL, bolt->s.origin, bolt, MASK_SHOT);
+	tr = Game_Trace(self->s.origin, NULL, NULL, bolt->s.origin, bolt, MASK_SHOT);
 	if (tr.fraction < 1.0)
 	{
 		VectorMA3(bolt->s.origin, -10, dir, bolt->s.origin);
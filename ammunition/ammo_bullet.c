@@ -42,7 +42,7 @@ static void Ammo_Bullet_generic(edict_t* self, vec3_t start, vec3_t aimdir, int3
 	bool	water = false;
 	int			content_mask = MASK_SHOT | MASK_WATER;
 
-	tr = gi.trace(self->s.origin, NULL, NULL, start, self, MASK_SHOT);
+	tr = Game_Trace(self->s.origin, NULL, NULL, start, self, MASK_SHOT);
 	if (!(tr.fraction < 1.0))
 	{
 		vectoangles(aimdir, dir);
@@ -54,14 +54,14 @@ static void Ammo_Bullet_generic(edict_t* self, vec3_t start, vec3_t aimdir, int3
 		VectorMA3(end, r, right, end);
 		VectorMA3(end, u, up, end);
 
-		if (gi.pointcontents(start) & MASK_WATER)
+		if (Game_PointContents(start) & MASK_WATER)
 		{
 			water = true;
 			VectorCopy3(start, water_start);
 			content_mask &= ~MASK_WATER;
 		}
 
-		tr = gi.trace(start, NULL, NULL, end, self, content_mask);
+		tr = Game_Trace(start, NULL, NULL, end, self, content_mask);
 
 		// see if we hit water
 		if (tr.contents & MASK_WATER)
@@ -110,7 +110,7 @@ static void Ammo_Bullet_generic(edict_t* self, vec3_t start, vec3_t aimdir, int3
 			}
 
 			// re-trace ignoring water this time
-			tr = gi.trace(water_start, NULL, NULL, end, self, MASK_SHOT);
+			tr = Game_Trace(water_start, NULL, NULL, end, self, MASK_SHOT);
 		}
 	}
 
@@ -148,10 +148,10 @@ static void Ammo_Bullet_generic(edict_t* self, vec3_t start, vec3_t aimdir, int3
 		VectorSubtract3(tr.endpos, water_start, dir);
 		VectorNormalize3(dir);
 		VectorMA3(tr.endpos, -2, dir, pos);
-		if (gi.pointcontents(pos) & MASK_WATER)
+		if (Game_PointContents(pos) & MASK_WATER)
 			VectorCopy3(pos, tr.endpos);
 		else
-			tr = gi.trace(pos, NULL, NULL, water_start, tr.ent, MASK_WATER);
+			tr = Game_Trace(pos, NULL, NULL, water_start, tr.ent, MASK_WATER);
 
 		VectorAdd3(water_start, tr.endpos, pos);
 		VectorScale3(pos, 0.5, pos);
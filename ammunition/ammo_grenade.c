@@ -118,6 +118,30 @@ static void Ammo_Grenade_touch(edict_t* ent, edict_t* other, cplane_t* plane, cs
 	Ammo_Grenade_explode(ent);
 }
 
+static projectile_template_t grenade_template =
+{
+	"grenade",
+	"models/objects/grenade/tris.md2",
+	NULL,
+	MOVETYPE_BOUNCE,
+	EF_GRENADE,
+	0,
+	Ammo_Grenade_touch,
+	Ammo_Grenade_explode,
+};
+
+static projectile_template_t hgrenade_template =
+{
+	"hgrenade",
+	"models/objects/grenade2/tris.md2",
+	"weapons/hgrenc1b.wav",
+	MOVETYPE_BOUNCE,
+	EF_GRENADE,
+	0,
+	Ammo_Grenade_touch,
+	Ammo_Grenade_explode,
+};
+
 void Ammo_Grenade(edict_t* self, vec3_t start, vec3_t aimdir, int32_t damage, int32_t speed, float timer, float damage_radius)
 {
 	edict_t*	grenade;
@@ -127,28 +151,16 @@ void Ammo_Grenade(edict_t* self, vec3_t start, vec3_t aimdir, int32_t damage, in
 	vectoangles(aimdir, dir);
 	AngleVectors(dir, forward, right, up);
 
-	grenade = Edict_Spawn();
-	VectorCopy3(start, grenade->s.origin);
+	grenade = Projectile_Spawn(&grenade_template, self, start);
 	VectorScale3(aimdir, speed, grenade->velocity);
 	VectorMA3(grenade->velocity, 200 + crandom() * 10.0f, up, grenade->velocity);
 	VectorMA3(grenade->velocity, crandom() * 10.0f, right, grenade->velocity);
 	VectorSet3(grenade->avelocity, 300, 300, 300);
-	grenade->movetype = MOVETYPE_BOUNCE;
-	grenade->clipmask = MASK_SHOT;
-	grenade->solid = SOLID_BBOX;
-	grenade->s.effects |= EF_GRENADE;
-	VectorClear3(grenade->mins);
-	VectorClear3(grenade->maxs);
-	grenade->s.modelindex = gi.modelindex("models/objects/grenade/tris.md2");
-	grenade->owner = self;
-	grenade->touch = Ammo_Grenade_touch;
-	grenade->nextthink = level.time + timer;
-	grenade->think = Ammo_Grenade_explode;
+	Edict_SetNextThink(grenade, level.time + timer);
 	grenade->dmg = damage;
 	grenade->dmg_radius = damage_radius;
-	grenade->classname = "grenade";
 
-	gi.Edict_Link(grenade);
+	Edict_Link(grenade);
 }
 
 void Ammo_Grenade2(edict_t* self, vec3_t start, vec3_t aimdir, int32_t damage, int32_t speed, float timer, float damage_radius, bool held)
@@ -160,38 +172,25 @@ void Ammo_Grenade2(edict_t* self, vec3_t start, vec3_t aimdir, int32_t damage, i
 	vectoangles(aimdir, dir);
 	AngleVectors(dir, forward, right, up);
 
-	grenade = Edict_Spawn();
-	VectorCopy3(start, grenade->s.origin);
+	grenade = Projectile_Spawn(&hgrenade_template, self, start);
 	VectorScale3(aimdir, speed, grenade->velocity);
 	VectorMA3(grenade->velocity, 200 + crandom() * 10.0f, up, grenade->velocity);
 	VectorMA3(grenade->velocity, crandom() * 10.0f, right, grenade->velocity);
 	VectorSet3(grenade->avelocity, 300, 300, 300);
-	grenade->movetype = MOVETYPE_BOUNCE;
-	grenade->clipmask = MASK_SHOT;
-	grenade->solid = SOLID_BBOX;
-	grenade->s.effects |= EF_GRENADE;
-	VectorClear3(grenade->mins);
-	VectorClear3(grenade->maxs);
-	grenade->s.modelindex = gi.modelindex("models/objects/grenade2/tris.md2");
-	grenade->owner = self;
-	grenade->touch = Ammo_Grenade_touch;
-	grenade->nextthink = level.time + timer;
-	grenade->think = Ammo_Grenade_explode;
+	Edict_SetNextThink(grenade, level.time + timer);
 	grenade->dmg = damage;
 	grenade->dmg_radius = damage_radius;
-	grenade->classname = "hgrenade";
 	if (held)
 		grenade->spawnflags = 3;
 	else
 		grenade->spawnflags = 1;
-	grenade->s.sound = gi.soundindex("weapons/hgrenc1b.wav");
 
 	if (timer <= 0.0)
 		Ammo_Grenade_explode(grenade);
 	else
 	{
 		gi.sound(self, CHAN_WEAPON, gi.soundindex("weapons/hgrent1a.wav"), 1, ATTN_NORM, 0);
-		gi.Edict_Link(grenade);
+		Edict_Link(grenade);
 	}
 }
 
@@ -0,0 +1,264 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+#include <game_local.h>
+
+// ammo_pool.c: Edicts set aside for rockets, grenades and blaster bolts
+
+/*
+==============================================================================
+
+PROJECTILE POOL
+
+==============================================================================
+
+Once a level has spawned, ProjectilePool_Init sets aside a slab of up to
+PROJECTILE_POOL_SIZE edicts after the last map entity. Edict_Spawn never
+hands them out; Projectile_Spawn takes them from its own free queue, oldest
+freed first, and Edict_Free gives them back to it. The slab is kept in level
+so it stays put across saves.
+
+Each kind of projectile has a projectile_template_t with everything its
+fields start as, so a shot only has to fill in where it is going and how
+much it hurts. Model and sound indexes are looked up the first time a
+template is used on a level.
+
+G_RunFrame leaves pooled projectiles out of the entity loop and
+ProjectilePool_RunFrame runs the slab in one pass after it. If the slab is
+full, Projectile_Spawn falls back to Edict_Spawn and the projectile is run
+like any other entity.
+*/
+
+#define PROJECTILE_POOL_SIZE	256
+
+typedef struct projectile_pool_stats_s
+{
+	int32_t		spawned;
+	int32_t		overflowed;		// slab was full, went to Edict_Spawn
+	int32_t		peak;			// most live at once
+} projectile_pool_stats_t;
+
+static int32_t					projectile_free[PROJECTILE_POOL_SIZE];
+static int32_t					projectile_free_head;
+static int32_t					projectile_free_count;
+static int32_t					projectile_live;
+static int32_t					projectile_serial;		// bumped every level, template indexes from older ones are stale
+
+static projectile_pool_stats_t	projectile_stats;
+
+static void ProjectilePool_Push(edict_t* ent)
+{
+	if (projectile_free_count >= PROJECTILE_POOL_SIZE)
+		return;
+
+	projectile_free[(projectile_free_head + projectile_free_count) % PROJECTILE_POOL_SIZE] = ent - g_edicts;
+	projectile_free_count++;
+}
+
+/*
+=============
+ProjectilePool_Owns
+
+True if ent is one of the slab's edicts
+=============
+*/
+bool ProjectilePool_Owns(edict_t* ent)
+{
+	int32_t	index;
+
+	index = ent - g_edicts;
+	return (index >= level.projectile_base && index < level.projectile_base + level.projectile_count);
+}
+
+/*
+=============
+ProjectilePool_Rebuild
+
+Refills the free queue from the slab, after a level spawn or load
+=============
+*/
+void ProjectilePool_Rebuild()
+{
+	edict_t*	ent;
+	int32_t		i;
+
+	projectile_free_head = projectile_free_count = 0;
+	projectile_live = 0;
+	projectile_serial++;
+
+	// the load only brings back edicts up to the last one in use
+	if (globals.num_edicts < level.projectile_base + level.projectile_count)
+		globals.num_edicts = level.projectile_base + level.projectile_count;
+
+	for (i = 0; i < level.projectile_count; i++)
+	{
+		ent = &g_edicts[level.projectile_base + i];
+
+		if (ent->inuse)
+			projectile_live++;
+		else
+			ProjectilePool_Push(ent);
+	}
+}
+
+/*
+=============
+ProjectilePool_Init
+
+Sets aside the slab at the end of the edicts, called once the level's
+entities have spawned
+=============
+*/
+void ProjectilePool_Init()
+{
+	int32_t	count;
+
+	// leave most of what is left to everything else
+	count = (game.maxentities - globals.num_edicts) / 4;
+
+	if (count > PROJECTILE_POOL_SIZE)
+		count = PROJECTILE_POOL_SIZE;
+
+	level.projectile_base = globals.num_edicts;
+	level.projectile_count = count;
+	globals.num_edicts += count;
+
+	ProjectilePool_Rebuild();
+}
+
+/*
+=============
+ProjectilePool_Release
+
+Called by Edict_Free for the slab's edicts instead of queueing them with
+everything else
+=============
+*/
+void ProjectilePool_Release(edict_t* ent)
+{
+	projectile_live--;
+	ProjectilePool_Push(ent);
+}
+
+/*
+=============
+Projectile_Spawn
+
+Returns a projectile of the template's kind owned by owner at start. The
+caller sets its velocity, angles, think time and damage, then links it.
+=============
+*/
+edict_t* Projectile_Spawn(projectile_template_t* proj, edict_t* owner, vec3_t start)
+{
+	edict_t*	ent;
+	bool		recent;
+
+	ent = NULL;
+	recent = false;
+
+	if (projectile_free_count)
+	{
+		ent = &g_edicts[projectile_free[projectile_free_head]];
+		projectile_free_head = (projectile_free_head + 1) % PROJECTILE_POOL_SIZE;
+		projectile_free_count--;
+
+		// the same reuse delay G_Spawn gives everything else, but it's a fixed slab so
+		// rather than wait, tell the client not to lerp it from the last projectile here
+		recent = (ent->freetime >= 2 && level.time - ent->freetime <= 0.5);
+
+		Edict_Init(ent);
+		ent->projectile_pooled = true;
+
+		projectile_live++;
+
+		if (projectile_live > projectile_stats.peak)
+			projectile_stats.peak = projectile_live;
+	}
+	else
+	{
+		ent = Edict_Spawn();
+		projectile_stats.overflowed++;
+	}
+
+	projectile_stats.spawned++;
+
+	if (proj->cached != projectile_serial)
+	{
+		proj->modelindex = gi.modelindex(proj->model);
+		proj->soundindex = proj->sound ? gi.soundindex(proj->sound) : 0;
+		proj->cached = projectile_serial;
+	}
+
+	Edict_SetClassname(ent, proj->classname);
+	VectorCopy3(start, ent->s.origin);
+	VectorCopy3(start, ent->s.old_origin);
+	ent->s.modelindex = proj->modelindex;
+	ent->s.sound = proj->soundindex;
+	ent->s.effects = proj->effects;
+	ent->svflags = proj->svflags;
+	ent->movetype = proj->movetype;
+	ent->clipmask = MASK_SHOT;
+	ent->solid = SOLID_BBOX;
+	ent->touch = proj->touch;
+	ent->think = proj->think;
+	ent->owner = owner;
+
+	if (recent)
+		ent->s.event = EV_OTHER_TELEPORT;
+
+	return ent;
+}
+
+/*
+=============
+ProjectilePool_RunFrame
+
+Runs every projectile in the slab, called by G_RunFrame after the entity loop
+=============
+*/
+void ProjectilePool_RunFrame()
+{
+	edict_t*	ent;
+	int32_t		i;
+
+	for (i = 0; i < level.projectile_count; i++)
+	{
+		ent = &g_edicts[level.projectile_base + i];
+
+		if (!ent->inuse)
+			continue;
+
+		Physics_RunProjectile(ent);
+	}
+}
+
+/*
+=============
+ProjectilePool_PrintStats
+
+Prints the slab's occupancy for sv stats
+=============
+*/
+void ProjectilePool_PrintStats()
+{
+	gi.cprintf(NULL, PRINT_HIGH, "Projectiles:\n");
+	gi.cprintf(NULL, PRINT_HIGH, "  live        %5i of %i (peak %i)\n", projectile_live, level.projectile_count, projectile_stats.peak);
+	gi.cprintf(NULL, PRINT_HIGH, "  spawned     %5i (%i with the slab full)\n", projectile_stats.spawned, projectile_stats.overflowed);
+}
@@ -43,7 +43,7 @@ void Ammo_Rail(edict_t* self, vec3_t start, vec3_t aimdir, int32_t damage, int32
 	mask = MASK_SHOT | CONTENTS_SLIME | CONTENTS_LAVA;
 	while (ignore)
 	{
-		tr = gi.trace(from, NULL, NULL, end, ignore, mask);
+		tr = Game_Trace(from, NULL, NULL, end, ignore, mask);
 
 		if (tr.contents & (CONTENTS_SLIME | CONTENTS_LAVA))
 		{
@@ -77,36 +77,35 @@ void Ammo_Rocket_touch(edict_t* ent, edict_t* other, cplane_t* plane, csurface_t
 	Edict_Free(ent);
 }
 
+static projectile_template_t rocket_template =
+{
+	"rocket",
+	"models/objects/rocket/tris.md2",
+	"weapons/rockfly.wav",
+	MOVETYPE_FLYMISSILE,
+	EF_ROCKET,
+	0,
+	Ammo_Rocket_touch,
+	Edict_Free,
+};
+
 void Ammo_Rocket(edict_t* self, vec3_t start, vec3_t dir, int32_t damage, int32_t speed, float damage_radius, int32_t radius_damage)
 {
 	edict_t* rocket;
 
-	rocket = Edict_Spawn();
-	VectorCopy3(start, rocket->s.origin);
+	rocket = Projectile_Spawn(&rocket_template, self, start);
 	VectorCopy3(dir, rocket->movedir);
 	vectoangles(dir, rocket->s.angles);
 	VectorScale3(dir, speed, rocket->velocity);
-	rocket->movetype = MOVETYPE_FLYMISSILE;
-	rocket->clipmask = MASK_SHOT;
-	rocket->solid = SOLID_BBOX;
-	rocket->s.effects |= EF_ROCKET;
-	VectorClear3(rocket->mins);
-	VectorClear3(rocket->maxs);
-	rocket->s.modelindex = gi.modelindex("models/objects/rocket/tris.md2");
-	rocket->owner = self;
-	rocket->touch = Ammo_Rocket_touch;
-	rocket->nextthink = level.time + ROCKET_MAX_DISTANCE / speed;
-	rocket->think = Edict_Free;
+	Edict_SetNextThink(rocket, level.time + ROCKET_MAX_DISTANCE / speed);
 	rocket->dmg = damage;
 	rocket->radius_dmg = radius_damage;
 	rocket->dmg_radius = damage_radius;
-	rocket->s.sound = gi.soundindex("weapons/rockfly.wav");
-	rocket->classname = "rocket";
 
 	if (self->client)
 		AI_MonsterCheckDodge(self, rocket->s.origin, dir, speed);
 
-	gi.Edict_Link(rocket);
+	Edict_Link(rocket);
 }
 
 void Ammo_Rocket_monster(edict_t* self, vec3_t start, vec3_t dir, int32_t damage, int32_t speed, int32_t flashtype)
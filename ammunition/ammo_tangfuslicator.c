@@ -102,13 +102,13 @@ void Ammo_Tangfuslicator(edict_t* self, vec3_t trace_start, vec3_t aimdir)
 	trace_end[2] = trace_start[2] + aimdir[2] * TANGFUSLICATOR_MAX_DISTANCE;
 
 	// trace
-	trace_result = gi.trace(trace_start, NULL, NULL, trace_end, self, CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_SLIME | CONTENTS_LAVA | CONTENTS_WINDOW | CONTENTS_WATER); // maybe remove water?
+	trace_result = Game_Trace(trace_start, NULL, NULL, trace_end, self, CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_SLIME | CONTENTS_LAVA | CONTENTS_WINDOW | CONTENTS_WATER); // maybe remove water?
 
 	// spawn the (invisible) bolt
 	lightning_bolt = Edict_Spawn();
-	lightning_bolt->classname = "ammo_tangfuslicator";
+	Edict_SetClassname(lightning_bolt, "ammo_tangfuslicator");
 	lightning_bolt->movetype = MOVETYPE_FLYMISSILE; // is this good?
-	lightning_bolt->nextthink = level.time + (TANGFUSLICATOR_MAX_DISTANCE / lightning_velocity);
+	Edict_SetNextThink(lightning_bolt, level.time + (TANGFUSLICATOR_MAX_DISTANCE / lightning_velocity));
 	lightning_bolt->think = Edict_Free;
 	lightning_bolt->clipmask = MASK_SHOT;
 	lightning_bolt->s.effects |= EF_LIGHTNING; // see cl_ents.c
@@ -133,5 +133,5 @@ void Ammo_Tangfuslicator(edict_t* self, vec3_t trace_start, vec3_t aimdir)
 	do_not_zombify = self;
 
 	// go
-	gi.Edict_Link(lightning_bolt);
+	Edict_Link(lightning_bolt);
 }
\ No newline at end of file
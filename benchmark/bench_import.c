@@ -0,0 +1,1326 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+
+// bench_import.c -- a fake game_import_t for running the game without the engine
+//
+// The world is an empty box with the floor at z = 0. Collision is done against
+// the box and the bounding boxes of every linked edict, there is no BSP, no PVS
+// and nothing is ever sent anywhere.
+
+#include "bench_local.h"
+#include <time.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+bench_stats_t	bench_stats;
+bool			bench_verbose;
+
+static int32_t	bench_engine_depth;		// so nested calls (Player_Move -> trace) are only timed once
+static int64_t	bench_engine_start;
+
+static int64_t	bench_live_allocations;
+static int64_t	bench_live_bytes;
+
+int64_t Bench_Nanoseconds()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+#ifdef __linux__
+static int32_t	bench_cache_fd = -1;
+#endif
+
+// Starts counting last level cache misses, false if the kernel won't give us the counter
+bool Bench_StartCacheMisses()
+{
+#ifdef __linux__
+	struct perf_event_attr	attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_CACHE_MISSES;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+
+	bench_cache_fd = (int32_t)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+
+	if (bench_cache_fd < 0)
+		return false;
+
+	ioctl(bench_cache_fd, PERF_EVENT_IOC_RESET, 0);
+	ioctl(bench_cache_fd, PERF_EVENT_IOC_ENABLE, 0);
+	return true;
+#else
+	return false;
+#endif
+}
+
+// Stops the counter and returns the misses since Bench_StartCacheMisses, -1 if it isn't running
+int64_t Bench_StopCacheMisses()
+{
+#ifdef __linux__
+	int64_t	count;
+
+	if (bench_cache_fd < 0)
+		return -1;
+
+	ioctl(bench_cache_fd, PERF_EVENT_IOC_DISABLE, 0);
+
+	if (read(bench_cache_fd, &count, sizeof(count)) != sizeof(count))
+		count = -1;
+
+	close(bench_cache_fd);
+	bench_cache_fd = -1;
+	return count;
+#else
+	return -1;
+#endif
+}
+
+static void Bench_EnterEngine()
+{
+	if (bench_engine_depth++ == 0)
+		bench_engine_start = Bench_Nanoseconds();
+}
+
+static void Bench_LeaveEngine()
+{
+	if (--bench_engine_depth == 0)
+		bench_stats.engine_ns += Bench_Nanoseconds() - bench_engine_start;
+}
+
+/*
+==============================================================================
+
+PRINTING
+
+==============================================================================
+*/
+
+static void Bench_Print(char* fmt, va_list argptr)
+{
+	if (bench_verbose)
+		vprintf(fmt, argptr);
+}
+
+static void Bench_bprintf(int32_t printlevel, char* fmt, ...)
+{
+	va_list argptr;
+
+	va_start(argptr, fmt);
+	Bench_Print(fmt, argptr);
+	va_end(argptr);
+}
+
+static void Bench_dprintf(char* fmt, ...)
+{
+	va_list argptr;
+
+	va_start(argptr, fmt);
+	Bench_Print(fmt, argptr);
+	va_end(argptr);
+}
+
+// cprintf to the console is how sv commands answer, so that always gets printed
+static void Bench_cprintf(edict_t* ent, int32_t printlevel, char* fmt, ...)
+{
+	va_list argptr;
+
+	va_start(argptr, fmt);
+
+	if (!ent)
+		vprintf(fmt, argptr);
+	else
+		Bench_Print(fmt, argptr);
+
+	va_end(argptr);
+}
+
+static void Bench_centerprintf(edict_t* ent, char* fmt, ...)
+{
+	va_list argptr;
+
+	va_start(argptr, fmt);
+	Bench_Print(fmt, argptr);
+	va_end(argptr);
+}
+
+static void Bench_Text_Draw(edict_t* ent, const char* font, int32_t x, int32_t y, const char* text, ...)
+{
+}
+
+static void Bench_error(char* fmt, ...)
+{
+	va_list argptr;
+
+	va_start(argptr, fmt);
+	fprintf(stderr, "Game error: ");
+	vfprintf(stderr, fmt, argptr);
+	fprintf(stderr, "\n");
+	va_end(argptr);
+
+	exit(1);
+}
+
+/*
+==============================================================================
+
+CONFIGSTRINGS, SOUNDS
+
+==============================================================================
+*/
+
+#define BENCH_MAX_INDEXES	1024
+
+typedef struct bench_index_s
+{
+	char*		names[BENCH_MAX_INDEXES];
+	int32_t		count;
+} bench_index_t;
+
+static bench_index_t	bench_models, bench_sounds, bench_images;
+
+static int32_t Bench_FindIndex(bench_index_t* index, char* name)
+{
+	int32_t i;
+
+	if (!name || !name[0])
+		return 0;
+
+	for (i = 1; i <= index->count; i++)
+	{
+		if (!strcmp(index->names[i], name))
+			return i;
+	}
+
+	if (index->count == BENCH_MAX_INDEXES - 1)
+		Bench_error("Index overflow at %s", name);
+
+	index->names[++index->count] = strdup(name);
+	return index->count;
+}
+
+static int32_t Bench_modelindex(char* name)
+{
+	return Bench_FindIndex(&bench_models, name);
+}
+
+static int32_t Bench_soundindex(char* name)
+{
+	return Bench_FindIndex(&bench_sounds, name);
+}
+
+static int32_t Bench_imageindex(char* name)
+{
+	return Bench_FindIndex(&bench_images, name);
+}
+
+static void Bench_setmodel(edict_t* ent, char* name)
+{
+	if (!name)
+		Bench_error("Bench_setmodel: NULL");
+
+	ent->s.modelindex = Bench_modelindex(name);
+}
+
+static void Bench_configstring(int32_t num, char* string)
+{
+}
+
+static void Bench_sound(edict_t* ent, int32_t channel, int32_t soundindex, float volume, float attenuation, float timeofs)
+{
+}
+
+static void Bench_positioned_sound(vec3_t origin, edict_t* ent, int32_t channel, int32_t soundindex, float volume, float attenuation, float timeofs)
+{
+}
+
+/*
+==============================================================================
+
+WORLD
+
+==============================================================================
+*/
+
+#define BENCH_DIST_EPSILON	0.03125f	// same as the engine, keeps boxes off the surfaces they hit
+
+#define EDICT_FROM_AREA(l) ((edict_t *)((uint8_t *)l - (intptr_t)&(((edict_t *)0)->area)))
+
+static link_t	bench_solid_edicts;
+static link_t	bench_trigger_edicts;
+static csurface_t bench_null_surface;
+
+// solid edicts are also filed in columns over the arena, so a trace only
+// has to look at the edicts near it (the real engine has its area nodes)
+#define BENCH_COLUMN_SIZE	128
+#define BENCH_COLUMNS		(BENCH_ARENA_SIZE * 2 / BENCH_COLUMN_SIZE)
+
+typedef struct bench_column_s
+{
+	edict_t**	edicts;
+	int32_t		count;
+	int32_t		size;
+} bench_column_t;
+
+static bench_column_t	bench_columns[BENCH_COLUMNS][BENCH_COLUMNS];
+
+// extra world brushes, each a box
+#define BENCH_MAX_WALLS		16
+
+static vec3_t			bench_walls[BENCH_MAX_WALLS][2];
+static int32_t			bench_num_walls;
+static int32_t			bench_edict_columns[MAX_EDICTS][4];		// x0, y0, x1, y1 or x0 = -1 if not filed
+static int32_t			bench_edict_stamp[MAX_EDICTS];			// so an edict in several columns is only checked once
+static int32_t			bench_stamp;
+
+static int32_t Bench_Column(float v)
+{
+	int32_t column;
+
+	column = (int32_t)floorf((v + BENCH_ARENA_SIZE) / BENCH_COLUMN_SIZE);
+
+	if (column < 0)
+		return 0;
+	if (column >= BENCH_COLUMNS)
+		return BENCH_COLUMNS - 1;
+
+	return column;
+}
+
+static void Bench_ColumnsForBox(vec3_t mins, vec3_t maxs, int32_t* rect)
+{
+	rect[0] = Bench_Column(mins[0]);
+	rect[1] = Bench_Column(mins[1]);
+	rect[2] = Bench_Column(maxs[0]);
+	rect[3] = Bench_Column(maxs[1]);
+}
+
+static void Bench_AddToColumns(edict_t* ent)
+{
+	bench_column_t*	column;
+	int32_t*		rect;
+	int32_t			x, y;
+
+	rect = bench_edict_columns[ent - g_edicts];
+	Bench_ColumnsForBox(ent->absmin, ent->absmax, rect);
+
+	for (x = rect[0]; x <= rect[2]; x++)
+	{
+		for (y = rect[1]; y <= rect[3]; y++)
+		{
+			column = &bench_columns[x][y];
+
+			if (column->count == column->size)
+			{
+				column->size = column->size ? column->size * 2 : 16;
+				column->edicts = realloc(column->edicts, column->size * sizeof(column->edicts[0]));
+			}
+
+			column->edicts[column->count++] = ent;
+		}
+	}
+}
+
+static void Bench_RemoveFromColumns(edict_t* ent)
+{
+	bench_column_t*	column;
+	int32_t*		rect;
+	int32_t			x, y, i;
+
+	rect = bench_edict_columns[ent - g_edicts];
+
+	if (rect[0] < 0)
+		return;
+
+	for (x = rect[0]; x <= rect[2]; x++)
+	{
+		for (y = rect[1]; y <= rect[3]; y++)
+		{
+			column = &bench_columns[x][y];
+
+			for (i = 0; i < column->count; i++)
+			{
+				if (column->edicts[i] == ent)
+				{
+					column->edicts[i] = column->edicts[--column->count];
+					break;
+				}
+			}
+		}
+	}
+
+	rect[0] = -1;
+}
+
+/*
+==================
+Bench_SolidEdictsInBox
+
+Fills list with the solid edicts filed in the columns under a box, the
+caller still has to check their bounds
+==================
+*/
+static int32_t Bench_SolidEdictsInBox(vec3_t mins, vec3_t maxs, edict_t** list)
+{
+	bench_column_t*	column;
+	edict_t*		check;
+	int32_t			rect[4];
+	int32_t			x, y, i, count;
+
+	Bench_ColumnsForBox(mins, maxs, rect);
+	bench_stamp++;
+	count = 0;
+
+	for (x = rect[0]; x <= rect[2]; x++)
+	{
+		for (y = rect[1]; y <= rect[3]; y++)
+		{
+			column = &bench_columns[x][y];
+
+			for (i = 0; i < column->count; i++)
+			{
+				check = column->edicts[i];
+
+				if (bench_edict_stamp[check - g_edicts] == bench_stamp)
+					continue;
+
+				bench_edict_stamp[check - g_edicts] = bench_stamp;
+				list[count++] = check;
+			}
+		}
+	}
+
+	return count;
+}
+
+static void Bench_ClearLink(link_t* l)
+{
+	l->prev = l->next = l;
+}
+
+static void Bench_InsertLinkBefore(link_t* l, link_t* before)
+{
+	l->next = before;
+	l->prev = before->prev;
+	l->prev->next = l;
+	l->next->prev = l;
+}
+
+static void Bench_RemoveLink(link_t* l)
+{
+	l->next->prev = l->prev;
+	l->prev->next = l->next;
+}
+
+static void Bench_Edict_Unlink(edict_t* ent)
+{
+	if (!ent->area.prev)
+		return;
+
+	Bench_RemoveLink(&ent->area);
+	ent->area.prev = ent->area.next = NULL;
+	Bench_RemoveFromColumns(ent);
+}
+
+static void Bench_Edict_Link(edict_t* ent)
+{
+	float	max, v;
+	int32_t	i;
+
+	bench_stats.links++;
+
+	if (ent->area.prev)
+		Bench_Edict_Unlink(ent);
+
+	// the world is never linked, and neither is anything not in use
+	if (ent == globals.edicts
+		|| !ent->inuse)
+		return;
+
+	VectorSubtract3(ent->maxs, ent->mins, ent->size);
+
+	if (ent->solid == SOLID_BSP
+		&& (ent->s.angles[0] || ent->s.angles[1] || ent->s.angles[2]))
+	{
+		// expand for rotation
+		max = 0;
+
+		for (i = 0; i < 3; i++)
+		{
+			v = fabsf(ent->mins[i]);
+			if (v > max)
+				max = v;
+			v = fabsf(ent->maxs[i]);
+			if (v > max)
+				max = v;
+		}
+
+		for (i = 0; i < 3; i++)
+		{
+			ent->absmin[i] = ent->s.origin[i] - max;
+			ent->absmax[i] = ent->s.origin[i] + max;
+		}
+	}
+	else
+	{
+		VectorAdd3(ent->s.origin, ent->mins, ent->absmin);
+		VectorAdd3(ent->s.origin, ent->maxs, ent->absmax);
+	}
+
+	// because movement is clipped an epsilon away from an actual edge,
+	// we must fully check even when bounding boxes don't quite touch
+	for (i = 0; i < 3; i++)
+	{
+		ent->absmin[i] -= 1;
+		ent->absmax[i] += 1;
+	}
+
+	ent->linkcount++;
+
+	if (ent->solid == SOLID_NOT)
+		return;
+
+	if (ent->solid == SOLID_TRIGGER)
+		Bench_InsertLinkBefore(&ent->area, &bench_trigger_edicts);
+	else
+	{
+		Bench_InsertLinkBefore(&ent->area, &bench_solid_edicts);
+		Bench_AddToColumns(ent);
+	}
+}
+
+static int32_t Bench_BoxEdicts(vec3_t mins, vec3_t maxs, edict_t** list, int32_t maxcount, int32_t areatype)
+{
+	static edict_t*	solids[MAX_EDICTS];
+	link_t*			l;
+	edict_t*		check;
+	int32_t			count, num_solids, i;
+
+	Bench_EnterEngine();
+	bench_stats.box_edicts++;
+
+	count = 0;
+
+	if (areatype == AREA_SOLID)
+	{
+		num_solids = Bench_SolidEdictsInBox(mins, maxs, solids);
+
+		for (i = 0; i < num_solids && count < maxcount; i++)
+		{
+			check = solids[i];
+
+			if (check->absmin[0] > maxs[0]
+				|| check->absmin[1] > maxs[1]
+				|| check->absmin[2] > maxs[2]
+				|| check->absmax[0] < mins[0]
+				|| check->absmax[1] < mins[1]
+				|| check->absmax[2] < mins[2])
+				continue;
+
+			list[count++] = check;
+		}
+	}
+	else
+	{
+		for (l = bench_trigger_edicts.next; l != &bench_trigger_edicts && count < maxcount; l = l->next)
+		{
+			check = EDICT_FROM_AREA(l);
+
+			if (check->absmin[0] > maxs[0]
+				|| check->absmin[1] > maxs[1]
+				|| check->absmin[2] > maxs[2]
+				|| check->absmax[0] < mins[0]
+				|| check->absmax[1] < mins[1]
+				|| check->absmax[2] < mins[2])
+				continue;
+
+			list[count++] = check;
+		}
+	}
+
+	Bench_LeaveEngine();
+	return count;
+}
+
+/*
+==================
+Bench_AddWall
+
+Adds a solid box to the world, the harness sets them up before the level is spawned
+==================
+*/
+void Bench_AddWall(vec3_t mins, vec3_t maxs)
+{
+	if (bench_num_walls == BENCH_MAX_WALLS)
+		Bench_error("Bench_AddWall: too many walls");
+
+	VectorCopy3(mins, bench_walls[bench_num_walls][0]);
+	VectorCopy3(maxs, bench_walls[bench_num_walls][1]);
+	bench_num_walls++;
+}
+
+static int32_t Bench_PointContentsInternal(vec3_t point)
+{
+	int32_t i;
+
+	if (point[0] < -BENCH_ARENA_SIZE || point[0] > BENCH_ARENA_SIZE
+		|| point[1] < -BENCH_ARENA_SIZE || point[1] > BENCH_ARENA_SIZE
+		|| point[2] < 0 || point[2] > BENCH_ARENA_HEIGHT)
+		return CONTENTS_SOLID;
+
+	for (i = 0; i < bench_num_walls; i++)
+	{
+		if (point[0] > bench_walls[i][0][0] && point[0] < bench_walls[i][1][0]
+			&& point[1] > bench_walls[i][0][1] && point[1] < bench_walls[i][1][1]
+			&& point[2] > bench_walls[i][0][2] && point[2] < bench_walls[i][1][2])
+			return CONTENTS_SOLID;
+	}
+
+	return 0;
+}
+
+static int32_t Bench_pointcontents(vec3_t point)
+{
+	int32_t contents;
+
+	Bench_EnterEngine();
+	bench_stats.pointcontents++;
+	contents = Bench_PointContentsInternal(point);
+	Bench_LeaveEngine();
+	return contents;
+}
+
+/*
+==================
+Bench_ClipToWorld
+
+Clips a box moving from start to end against the inside of the arena
+==================
+*/
+static void Bench_ClipToWorld(trace_t* trace, vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end)
+{
+	vec3_t	inside_mins = { -BENCH_ARENA_SIZE, -BENCH_ARENA_SIZE, 0 };
+	vec3_t	inside_maxs = { BENCH_ARENA_SIZE, BENCH_ARENA_SIZE, BENCH_ARENA_HEIGHT };
+	float	d, frac;
+	int32_t	i;
+	bool	start_out, end_out;
+
+	// shrink the arena by the box so the box can be treated as a point
+	start_out = end_out = false;
+
+	for (i = 0; i < 3; i++)
+	{
+		inside_mins[i] -= mins[i];
+		inside_maxs[i] -= maxs[i];
+
+		if (start[i] < inside_mins[i] || start[i] > inside_maxs[i])
+			start_out = true;
+		if (end[i] < inside_mins[i] || end[i] > inside_maxs[i])
+			end_out = true;
+	}
+
+	if (start_out)
+	{
+		trace->startsolid = true;
+
+		if (end_out)
+		{
+			trace->allsolid = true;
+			trace->fraction = 0;
+			trace->contents = CONTENTS_SOLID;
+			trace->ent = globals.edicts;
+		}
+
+		return;
+	}
+
+	if (!end_out)
+		return;
+
+	for (i = 0; i < 3; i++)
+	{
+		d = end[i] - start[i];
+
+		if (end[i] > inside_maxs[i])
+			frac = (inside_maxs[i] - start[i] - BENCH_DIST_EPSILON) / d;
+		else if (end[i] < inside_mins[i])
+			frac = (inside_mins[i] - start[i] + BENCH_DIST_EPSILON) / d;
+		else
+			continue;
+
+		if (frac < 0)
+			frac = 0;
+
+		if (frac < trace->fraction)
+		{
+			trace->fraction = frac;
+			VectorClear3(trace->plane.normal);
+			trace->plane.normal[i] = (end[i] > inside_maxs[i]) ? -1 : 1;
+			trace->plane.dist = (end[i] > inside_maxs[i]) ? -(inside_maxs[i] + maxs[i]) : inside_mins[i] + mins[i];
+			trace->contents = CONTENTS_SOLID;
+			trace->ent = globals.edicts;
+		}
+	}
+}
+
+/*
+==================
+Bench_ClipToBox
+
+Clips a box moving from start to end against the bounding box of an edict
+==================
+*/
+static void Bench_ClipToBox(trace_t* trace, vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, vec3_t absmin, vec3_t absmax, edict_t* touch, int32_t contents)
+{
+	vec3_t	box_mins, box_maxs;
+	float	enter, leave, d, t1, t2, frac;
+	int32_t	i, axis;
+	bool	start_in, end_in;
+
+	start_in = end_in = true;
+
+	// grow the edict by the box so the box can be treated as a point
+	for (i = 0; i < 3; i++)
+	{
+		box_mins[i] = absmin[i] - maxs[i];
+		box_maxs[i] = absmax[i] - mins[i];
+
+		if (start[i] <= box_mins[i] || start[i] >= box_maxs[i])
+			start_in = false;
+		if (end[i] <= box_mins[i] || end[i] >= box_maxs[i])
+			end_in = false;
+	}
+
+	if (start_in)
+	{
+		trace->startsolid = true;
+
+		if (end_in)
+		{
+			trace->allsolid = true;
+			trace->fraction = 0;
+			trace->contents = contents;
+			trace->ent = touch;
+		}
+
+		return;
+	}
+
+	enter = -1;
+	leave = 1;
+	axis = -1;
+
+	for (i = 0; i < 3; i++)
+	{
+		d = end[i] - start[i];
+
+		if (d == 0)
+		{
+			if (start[i] <= box_mins[i] || start[i] >= box_maxs[i])
+				return;
+
+			continue;
+		}
+
+		t1 = (box_mins[i] - start[i]) / d;
+		t2 = (box_maxs[i] - start[i]) / d;
+
+		if (t1 > t2)
+		{
+			frac = t1;
+			t1 = t2;
+			t2 = frac;
+		}
+
+		if (t1 > enter)
+		{
+			enter = t1;
+			axis = i;
+		}
+
+		if (t2 < leave)
+			leave = t2;
+	}
+
+	if (axis < 0
+		|| enter > leave
+		|| enter < 0
+		|| enter >= trace->fraction)
+		return;
+
+	d = end[axis] - start[axis];
+	frac = enter - BENCH_DIST_EPSILON / fabsf(d);
+
+	if (frac < 0)
+		frac = 0;
+
+	trace->fraction = frac;
+	VectorClear3(trace->plane.normal);
+	trace->plane.normal[axis] = (d > 0) ? -1 : 1;
+	trace->plane.dist = (d > 0) ? -(box_mins[axis] + maxs[axis]) : box_maxs[axis] + mins[axis];
+	trace->contents = contents;
+	trace->ent = touch;
+}
+
+static trace_t Bench_trace(vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, edict_t* passent, int32_t contentmask)
+{
+	static edict_t*	touches[MAX_EDICTS];
+	trace_t		trace;
+	edict_t*	touch;
+	vec3_t		move_mins, move_maxs, box_mins, box_maxs;
+	int32_t		contents, num_touch, i, j;
+
+	Bench_EnterEngine();
+	bench_stats.traces++;
+
+	if (!mins)
+		mins = vec3_origin;
+	if (!maxs)
+		maxs = vec3_origin;
+
+	memset(&trace, 0, sizeof(trace));
+	trace.fraction = 1;
+	trace.surface = &bench_null_surface;
+
+	if (contentmask & CONTENTS_SOLID)
+	{
+		Bench_ClipToWorld(&trace, start, mins, maxs, end);
+
+		for (i = 0; i < bench_num_walls && !trace.allsolid; i++)
+			Bench_ClipToBox(&trace, start, mins, maxs, end, bench_walls[i][0], bench_walls[i][1], globals.edicts, CONTENTS_SOLID);
+	}
+
+	for (i = 0; i < 3; i++)
+	{
+		move_mins[i] = ((start[i] < end[i]) ? start[i] : end[i]) + mins[i] - 1;
+		move_maxs[i] = ((start[i] > end[i]) ? start[i] : end[i]) + maxs[i] + 1;
+	}
+
+	num_touch = Bench_SolidEdictsInBox(move_mins, move_maxs, touches);
+
+	for (j = 0; j < num_touch && !trace.allsolid; j++)
+	{
+		touch = touches[j];
+
+		if (touch->absmin[0] > move_maxs[0]
+			|| touch->absmin[1] > move_maxs[1]
+			|| touch->absmin[2] > move_maxs[2]
+			|| touch->absmax[0] < move_mins[0]
+			|| touch->absmax[1] < move_mins[1]
+			|| touch->absmax[2] < move_mins[2])
+			continue;
+
+		if (touch == passent)
+			continue;
+
+		if (passent)
+		{
+			if (touch->owner == passent)
+				continue;	// don't clip against own missiles
+			if (passent->owner == touch)
+				continue;	// don't clip against owner
+		}
+
+		if ((touch->svflags & SVF_DEADMONSTER)
+			&& !(contentmask & CONTENTS_DEADMONSTER))
+			continue;
+
+		// bounding boxes are clipped as monsters, whatever is inside them
+		contents = (touch->solid == SOLID_BSP) ? CONTENTS_SOLID : CONTENTS_MONSTER;
+
+		if (!(contents & contentmask))
+			continue;
+
+		VectorAdd3(touch->s.origin, touch->mins, box_mins);
+		VectorAdd3(touch->s.origin, touch->maxs, box_maxs);
+		Bench_ClipToBox(&trace, start, mins, maxs, end, box_mins, box_maxs, touch, contents);
+	}
+
+	for (i = 0; i < 3; i++)
+		trace.endpos[i] = start[i] + trace.fraction * (end[i] - start[i]);
+
+	Bench_LeaveEngine();
+	return trace;
+}
+
+static bool Bench_inPVS(vec3_t p1, vec3_t p2)
+{
+	return true;
+}
+
+static bool Bench_inPHS(vec3_t p1, vec3_t p2)
+{
+	return true;
+}
+
+static void Bench_SetAreaPortalState(int32_t portalnum, bool open)
+{
+}
+
+static bool Bench_AreasConnected(int32_t area1, int32_t area2)
+{
+	return true;
+}
+
+/*
+==================
+Bench_Player_Move
+
+Not the real pmove, just enough walking, sliding and falling for the
+scripted players to get around the arena
+==================
+*/
+#define BENCH_PLAYER_SPEED	300
+#define BENCH_JUMP_SPEED	270
+
+static void Bench_Player_Move(pmove_t* pm)
+{
+	vec3_t	forward, right, angles, wishvel, end, down;
+	trace_t	trace;
+	float	frametime, time_left, backoff;
+	int32_t	i, bump;
+
+	Bench_EnterEngine();
+	bench_stats.player_moves++;
+
+	frametime = pm->cmd.msec / 1000.0f;
+
+	for (i = 0; i < 3; i++)
+		pm->viewangles[i] = SHORT2ANGLE(pm->cmd.angles[i] + pm->s.delta_angles[i]);
+
+	VectorSet3(pm->mins, -16, -16, -24);
+	VectorSet3(pm->maxs, 16, 16, 32);
+	pm->viewheight = 22;
+	pm->waterlevel = 0;
+	pm->watertype = 0;
+	pm->numtouch = 0;
+
+	// run straight off the yaw, like the real one
+	VectorSet3(angles, 0, pm->viewangles[YAW], 0);
+	AngleVectors(angles, forward, right, NULL);
+
+	if (pm->s.pm_type == PM_NORMAL)
+	{
+		for (i = 0; i < 2; i++)
+			wishvel[i] = forward[i] * pm->cmd.forwardmove + right[i] * pm->cmd.sidemove;
+
+		wishvel[2] = 0;
+
+		if (VectorLength3(wishvel) > BENCH_PLAYER_SPEED)
+			VectorScale3(wishvel, BENCH_PLAYER_SPEED / VectorLength3(wishvel), wishvel);
+
+		pm->s.velocity[0] = wishvel[0];
+		pm->s.velocity[1] = wishvel[1];
+
+		if (pm->cmd.upmove >= 10
+			&& (pm->s.pm_flags & PMF_ON_GROUND))
+			pm->s.velocity[2] = BENCH_JUMP_SPEED;
+	}
+	else
+	{
+		pm->s.velocity[0] = pm->s.velocity[1] = 0;
+	}
+
+	if (!(pm->s.pm_flags & PMF_ON_GROUND)
+		|| pm->s.velocity[2] > 0)
+		pm->s.velocity[2] -= pm->s.gravity * frametime;
+
+	// slide along whatever gets in the way
+	time_left = frametime;
+
+	for (bump = 0; bump < 4 && time_left > 0; bump++)
+	{
+		VectorMA3(pm->s.origin, time_left, pm->s.velocity, end);
+		trace = pm->trace(pm->s.origin, pm->mins, pm->maxs, end);
+
+		if (trace.allsolid)
+		{
+			pm->s.velocity[2] = 0;
+			break;
+		}
+
+		VectorCopy3(trace.endpos, pm->s.origin);
+
+		if (trace.fraction == 1)
+			break;
+
+		if (trace.ent
+			&& trace.ent != globals.edicts
+			&& pm->numtouch < MAXTOUCH)
+			pm->touchents[pm->numtouch++] = trace.ent;
+
+		time_left -= time_left * trace.fraction;
+
+		backoff = DotProduct3(pm->s.velocity, trace.plane.normal);
+
+		for (i = 0; i < 3; i++)
+			pm->s.velocity[i] -= trace.plane.normal[i] * backoff;
+	}
+
+	// check for the ground
+	VectorCopy3(pm->s.origin, down);
+	down[2] -= 0.25f;
+	trace = pm->trace(pm->s.origin, pm->mins, pm->maxs, down);
+
+	if (trace.fraction < 1
+		&& trace.plane.normal[2] > 0.7f
+		&& pm->s.velocity[2] <= 0)
+	{
+		pm->groundentity = trace.ent;
+		pm->s.pm_flags |= PMF_ON_GROUND;
+		pm->s.velocity[2] = 0;
+	}
+	else
+	{
+		pm->groundentity = NULL;
+		pm->s.pm_flags &= ~PMF_ON_GROUND;
+	}
+
+	VectorCopy3(pm->s.origin, pm->vieworigin);
+	pm->vieworigin[2] += pm->viewheight;
+
+	Bench_LeaveEngine();
+}
+
+/*
+==============================================================================
+
+MESSAGES
+
+==============================================================================
+*/
+
+static void Bench_multicast(vec3_t origin, multicast_t to)
+{
+}
+
+static void Bench_unicast(edict_t* ent, bool reliable)
+{
+}
+
+static int32_t Bench_ReadInt32() { return 0; }
+static float Bench_ReadFloat() { return 0; }
+static char* Bench_ReadString(char* s) { return ""; }
+static void Bench_ReadVector(vec3_t v) { VectorClear3(v); }
+static void Bench_ReadColor(color4_t color) { memset(color, 0, sizeof(color4_t)); }
+static float Bench_ReadAngle(float f) { return 0; }
+
+static void Bench_WriteInt32(int32_t c) { }
+static void Bench_WriteFloat(float f) { }
+static void Bench_WriteString(char* s) { }
+static void Bench_WriteVector(vec3_t v) { }
+static void Bench_WriteColor(color4_t color) { }
+
+/*
+==============================================================================
+
+MEMORY
+
+Every block is kept on one list so FreeTags can find them.
+
+==============================================================================
+*/
+
+typedef struct bench_block_s
+{
+	struct bench_block_s*	prev;
+	struct bench_block_s*	next;
+	int32_t					tag;
+	int32_t					size;
+} bench_block_t;
+
+static bench_block_t bench_blocks = { &bench_blocks, &bench_blocks };
+
+static void* Bench_TagMalloc(int32_t size, int32_t tag)
+{
+	bench_block_t* block;
+
+	block = calloc(1, sizeof(bench_block_t) + size);
+
+	if (!block)
+		Bench_error("Bench_TagMalloc: failed on allocation of %i bytes", size);
+
+	block->tag = tag;
+	block->size = size;
+	block->next = bench_blocks.next;
+	block->prev = &bench_blocks;
+	block->next->prev = block;
+	bench_blocks.next = block;
+
+	bench_stats.allocations++;
+	bench_stats.allocated_bytes += size;
+	bench_live_allocations++;
+	bench_live_bytes += size;
+
+	return block + 1;
+}
+
+static void Bench_TagFree(void* ptr)
+{
+	bench_block_t* block = (bench_block_t*)ptr - 1;
+
+	block->prev->next = block->next;
+	block->next->prev = block->prev;
+
+	bench_stats.frees++;
+	bench_live_allocations--;
+	bench_live_bytes -= block->size;
+
+	free(block);
+}
+
+static void Bench_FreeTags(int32_t tag)
+{
+	bench_block_t* block, * next;
+
+	for (block = bench_blocks.next; block != &bench_blocks; block = next)
+	{
+		next = block->next;
+
+		if (block->tag == tag)
+			Bench_TagFree(block + 1);
+	}
+}
+
+int64_t Bench_LiveAllocations()
+{
+	return bench_live_allocations;
+}
+
+int64_t Bench_LiveBytes()
+{
+	return bench_live_bytes;
+}
+
+/*
+==============================================================================
+
+CVARS AND COMMANDS
+
+==============================================================================
+*/
+
+static cvar_t*	bench_cvars;
+
+static cvar_t* Bench_Cvar_Find(char* var_name)
+{
+	cvar_t* var;
+
+	for (var = bench_cvars; var; var = var->next)
+	{
+		if (!strcmp(var->name, var_name))
+			return var;
+	}
+
+	return NULL;
+}
+
+static cvar_t* Bench_Cvar_ForceSet(char* var_name, char* value)
+{
+	cvar_t* var;
+
+	var = Bench_Cvar_Find(var_name);
+
+	if (!var)
+	{
+		var = calloc(1, sizeof(cvar_t));
+		var->name = strdup(var_name);
+		var->next = bench_cvars;
+		bench_cvars = var;
+	}
+	else
+	{
+		if (!strcmp(var->string, value))
+			return var;
+
+		free(var->string);
+	}
+
+	var->string = strdup(value);
+	var->value = (float)atof(value);
+	var->modified = true;
+	return var;
+}
+
+static cvar_t* Bench_Cvar_Get(char* var_name, char* value, int32_t flags)
+{
+	cvar_t* var;
+
+	var = Bench_Cvar_Find(var_name);
+
+	if (!var)
+		var = Bench_Cvar_ForceSet(var_name, value);
+
+	var->flags |= flags;
+	return var;
+}
+
+static int32_t	bench_argc;
+static char**	bench_argv;
+static char		bench_args[1024];
+
+void Bench_SetArgs(int32_t argc, char** argv)
+{
+	int32_t i;
+
+	bench_argc = argc;
+	bench_argv = argv;
+	bench_args[0] = 0;
+
+	for (i = 1; i < argc; i++)
+	{
+		strncat(bench_args, argv[i], sizeof(bench_args) - strlen(bench_args) - 1);
+
+		if (i < argc - 1)
+			strncat(bench_args, " ", sizeof(bench_args) - strlen(bench_args) - 1);
+	}
+}
+
+static int32_t Bench_Cmd_Argc()
+{
+	return bench_argc;
+}
+
+static char* Bench_Cmd_Argv(int32_t n)
+{
+	if (n < 0 || n >= bench_argc)
+		return "";
+
+	return bench_argv[n];
+}
+
+static char* Bench_Cmd_Args()
+{
+	return bench_args;
+}
+
+static void Bench_Cmd_AddCommand(char* name, void(*cmd)())
+{
+}
+
+static void Bench_Cmd_RemoveCommand(char* name)
+{
+}
+
+static void Bench_AddCommandString(char* text)
+{
+}
+
+static void Bench_DebugGraph(float value, int32_t r, int32_t g, int32_t b, int32_t a)
+{
+}
+
+/*
+=================
+Bench_InitImports
+
+Fills in the engine functions the game calls
+=================
+*/
+void Bench_InitImports(game_import_t* import)
+{
+	Bench_ClearLink(&bench_solid_edicts);
+	Bench_ClearLink(&bench_trigger_edicts);
+	memset(bench_edict_columns, -1, sizeof(bench_edict_columns));
+
+	memset(import, 0, sizeof(*import));
+
+	import->bprintf = Bench_bprintf;
+	import->dprintf = Bench_dprintf;
+	import->cprintf = Bench_cprintf;
+	import->Text_Draw = Bench_Text_Draw;
+	import->centerprintf = Bench_centerprintf;
+	import->sound = Bench_sound;
+	import->positioned_sound = Bench_positioned_sound;
+
+	import->configstring = Bench_configstring;
+	import->error = Bench_error;
+
+	import->modelindex = Bench_modelindex;
+	import->soundindex = Bench_soundindex;
+	import->imageindex = Bench_imageindex;
+	import->setmodel = Bench_setmodel;
+
+	import->trace = Bench_trace;
+	import->pointcontents = Bench_pointcontents;
+	import->inPVS = Bench_inPVS;
+	import->inPHS = Bench_inPHS;
+	import->SetAreaPortalState = Bench_SetAreaPortalState;
+	import->AreasConnected = Bench_AreasConnected;
+
+	import->Edict_Link = Bench_Edict_Link;
+	import->Edict_Unlink = Bench_Edict_Unlink;
+	import->BoxEdicts = Bench_BoxEdicts;
+	import->Player_Move = Bench_Player_Move;
+
+	import->multicast = Bench_multicast;
+	import->unicast = Bench_unicast;
+
+	import->ReadChar = Bench_ReadInt32;
+	import->ReadByte = Bench_ReadInt32;
+	import->ReadShort = Bench_ReadInt32;
+	import->ReadInt = Bench_ReadInt32;
+	import->ReadFloat = Bench_ReadFloat;
+	import->ReadString = Bench_ReadString;
+	import->ReadPos = Bench_ReadVector;
+	import->ReadDir = Bench_ReadVector;
+	import->ReadColor = Bench_ReadColor;
+	import->ReadAngle = Bench_ReadAngle;
+
+	import->WriteChar = Bench_WriteInt32;
+	import->WriteByte = Bench_WriteInt32;
+	import->WriteShort = Bench_WriteInt32;
+	import->WriteInt = Bench_WriteInt32;
+	import->WriteFloat = Bench_WriteFloat;
+	import->WriteString = Bench_WriteString;
+	import->WritePos = Bench_WriteVector;
+	import->WriteDir = Bench_WriteVector;
+	import->WriteColor = Bench_WriteColor;
+	import->WriteAngle = Bench_WriteFloat;
+
+	import->TagMalloc = Bench_TagMalloc;
+	import->TagFree = Bench_TagFree;
+	import->FreeTags = Bench_FreeTags;
+
+	import->Cvar_Get = Bench_Cvar_Get;
+	import->Cvar_Set = Bench_Cvar_ForceSet;
+	import->Cvar_ForceSet = Bench_Cvar_ForceSet;
+
+	import->Cmd_Argc = Bench_Cmd_Argc;
+	import->Cmd_Argv = Bench_Cmd_Argv;
+	import->Cmd_Args = Bench_Cmd_Args;
+	import->Cmd_AddCommand = Bench_Cmd_AddCommand;
+	import->Cmd_RemoveCommand = Bench_Cmd_RemoveCommand;
+
+	import->AddCommandString = Bench_AddCommandString;
+	import->DebugGraph = Bench_DebugGraph;
+}
@@ -0,0 +1,68 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+
+// bench_local.h -- headless game benchmark harness
+
+#include <game_local.h>
+
+// the arena is a closed box, the floor is at z = 0
+#define BENCH_ARENA_SIZE		2048		// half the width of the arena
+#define BENCH_ARENA_HEIGHT		512
+
+// -walls puts a ring of waist high walls around the players, low enough to see over
+#define BENCH_WALL_RING			768			// half the width of the ring
+#define BENCH_WALL_GAP			128			// half the width of the gap in each side
+#define BENCH_WALL_THICKNESS	32
+#define BENCH_WALL_HEIGHT		40
+
+//
+// counters kept by the fake engine
+//
+typedef struct bench_stats_s
+{
+	int64_t		engine_ns;			// time spent inside the fake engine
+	int64_t		traces;
+	int64_t		pointcontents;
+	int64_t		box_edicts;
+	int64_t		links;
+	int64_t		player_moves;
+	int64_t		allocations;		// TagMalloc calls
+	int64_t		allocated_bytes;
+	int64_t		frees;				// blocks freed by TagFree or FreeTags
+} bench_stats_t;
+
+extern bench_stats_t	bench_stats;
+extern bool				bench_verbose;
+
+// exported by game_main.c, the harness links the game in directly
+game_export_t* GetGameAPI(game_import_t* import);
+
+//
+// bench_import.c
+//
+void Bench_InitImports(game_import_t* import);
+void Bench_SetArgs(int32_t argc, char** argv);
+void Bench_AddWall(vec3_t mins, vec3_t maxs);
+int64_t Bench_Nanoseconds();
+bool Bench_StartCacheMisses();
+int64_t Bench_StopCacheMisses();
+int64_t Bench_LiveAllocations();
+int64_t Bench_LiveBytes();
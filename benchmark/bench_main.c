@@ -0,0 +1,412 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+
+// bench_main.c -- headless game benchmark
+//
+// Runs the game without an engine: N zombies chase M scripted players around
+// a flat arena for a fixed number of frames, then prints how long the frames
+// took and how much they asked of the engine. Everything is seeded so two runs
+// of the same build do the same work.
+//
+// gamebench [-zombies n] [-players n] [-frames n] [-warmup n] [-seed n] [-fire] [-walls] [-set cvar value] [-sv command] [-trace file] [-v]
+
+#include "bench_local.h"
+
+typedef struct bench_options_s
+{
+	int32_t		zombies;
+	int32_t		players;
+	int32_t		frames;
+	int32_t		warmup;			// frames run before anything is measured
+	int32_t		seed;
+	bool		fire;			// the players shoot back
+	bool		walls;			// the players are penned in by low walls
+	char*		command;		// sv command run at the end, e.g. "stats"
+	char*		trace;			// timeline of the measured frames is written here
+	char*		cvars[32];		// name, value pairs set before the game starts
+	int32_t		num_cvars;
+} bench_options_t;
+
+static bench_options_t bench_options = { 100, 4, 4000, 200, 1, false, false, NULL };
+
+static void Bench_Usage()
+{
+	printf("usage: gamebench [-zombies n] [-players n] [-frames n] [-warmup n] [-seed n] [-fire] [-walls] [-set cvar value] [-sv command] [-trace file] [-v]\n");
+	exit(1);
+}
+
+static void Bench_ParseOptions(int32_t argc, char** argv)
+{
+	int32_t i;
+
+	for (i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-fire"))
+			bench_options.fire = true;
+		else if (!strcmp(argv[i], "-walls"))
+			bench_options.walls = true;
+		else if (!strcmp(argv[i], "-v"))
+			bench_verbose = true;
+		else if (i + 1 >= argc)
+			Bench_Usage();
+		else if (!strcmp(argv[i], "-zombies"))
+			bench_options.zombies = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-players"))
+			bench_options.players = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-frames"))
+			bench_options.frames = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-warmup"))
+			bench_options.warmup = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-seed"))
+			bench_options.seed = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-sv"))
+			bench_options.command = argv[++i];
+		else if (!strcmp(argv[i], "-trace"))
+			bench_options.trace = argv[++i];
+		else if (!strcmp(argv[i], "-set")
+			&& i + 2 < argc
+			&& bench_options.num_cvars < 32)
+		{
+			bench_options.cvars[bench_options.num_cvars++] = argv[++i];
+			bench_options.cvars[bench_options.num_cvars++] = argv[++i];
+		}
+		else
+			Bench_Usage();
+	}
+
+	if (bench_options.players < 1
+		|| bench_options.players > MAX_CLIENTS
+		|| bench_options.zombies < 0
+		|| bench_options.frames < 1
+		|| bench_options.warmup < 0)
+		Bench_Usage();
+}
+
+/*
+=================
+Bench_BuildEntityString
+
+The players start in the middle of the arena, the zombies are spread over a
+grid around them
+=================
+*/
+static char* Bench_BuildEntityString()
+{
+	char*	entities;
+	char*	p;
+	int32_t	size, i, side, x, y;
+	float	spacing;
+
+	size = 256 + (bench_options.zombies + bench_options.players * 2) * 128;
+	entities = malloc(size);
+	p = entities;
+
+	p += sprintf(p, "{\n\"classname\" \"worldspawn\"\n}\n");
+
+	for (i = 0; i < bench_options.players; i++)
+	{
+		x = (i % 4) * 96 - 144;
+		y = (i / 4) * 96 - 144;
+
+		p += sprintf(p, "{\n\"classname\" \"info_player_start\"\n\"origin\" \"%i %i 25\"\n}\n", x, y);
+		p += sprintf(p, "{\n\"classname\" \"info_player_start_player\"\n\"origin\" \"%i %i 25\"\n}\n", x, y);
+	}
+
+	side = 1;
+
+	while (side * side < bench_options.zombies)
+		side++;
+
+	spacing = (BENCH_ARENA_SIZE * 2 - 256) / (float)(side + 1);
+
+	for (i = 0; i < bench_options.zombies; i++)
+	{
+		x = (int32_t)(-BENCH_ARENA_SIZE + 128 + spacing * (i % side + 1));
+		y = (int32_t)(-BENCH_ARENA_SIZE + 128 + spacing * (i / side + 1));
+
+		// keep the middle clear for the players
+		if (abs(x) < 256 && abs(y) < 256)
+			x = (x < 0) ? x - 512 : x + 512;
+
+		// and off the walls
+		if (bench_options.walls)
+		{
+			if (abs(abs(x) - BENCH_WALL_RING) < BENCH_WALL_THICKNESS + 24)
+				x += (x < 0) ? -64 : 64;
+			if (abs(abs(y) - BENCH_WALL_RING) < BENCH_WALL_THICKNESS + 24)
+				y += (y < 0) ? -64 : 64;
+		}
+
+		p += sprintf(p, "{\n\"classname\" \"monster_zombie\"\n\"origin\" \"%i %i 25\"\n\"angle\" \"%i\"\n}\n", x, y, (i * 37) % 360);
+	}
+
+	return entities;
+}
+
+/*
+=================
+Bench_AddWalls
+
+Puts a ring of walls around the middle of the arena, with a gap in the
+middle of each side. The zombies can see the players over them, but have
+to find their way round.
+=================
+*/
+static void Bench_AddWalls()
+{
+	vec3_t	mins, maxs;
+	int32_t	side, half, axis;
+	float	sign;
+
+	for (side = 0; side < 4; side++)
+	{
+		axis = side & 1;				// the wall runs along the other one
+		sign = (side & 2) ? -1.0f : 1.0f;
+
+		for (half = 0; half < 2; half++)
+		{
+			mins[axis] = sign * BENCH_WALL_RING - BENCH_WALL_THICKNESS / 2;
+			maxs[axis] = sign * BENCH_WALL_RING + BENCH_WALL_THICKNESS / 2;
+			mins[!axis] = half ? BENCH_WALL_GAP : -BENCH_WALL_RING - BENCH_WALL_THICKNESS / 2;
+			maxs[!axis] = half ? BENCH_WALL_RING + BENCH_WALL_THICKNESS / 2 : -BENCH_WALL_GAP;
+			mins[2] = 0;
+			maxs[2] = BENCH_WALL_HEIGHT;
+
+			Bench_AddWall(mins, maxs);
+		}
+	}
+}
+
+/*
+=================
+Bench_ConnectPlayers
+=================
+*/
+static void Bench_ConnectPlayers(game_export_t* ge)
+{
+	char		userinfo[MAX_INFO_STRING];
+	edict_t*	ent;
+	int32_t		i;
+
+	for (i = 0; i < bench_options.players; i++)
+	{
+		ent = &g_edicts[i + 1];
+
+		Com_sprintf(userinfo, sizeof(userinfo), "\\name\\bench%i\\skin\\male/grunt\\fov\\90\\ip\\loopback", i);
+
+		if (!ge->Client_Connect(ent, userinfo))
+			gi.error("Player %i was refused: %s", i, Info_ValueForKey(userinfo, "rejmsg"));
+
+		ge->Client_OnConnected(ent);
+		Client_SetTeam(ent, team_player);
+
+		// keep the run the same length no matter what the zombies do
+		ent->flags |= FL_GODMODE;
+	}
+}
+
+/*
+=================
+Bench_PlayerCommand
+
+Each player runs around its own circle, turning and strafing, and
+optionally firing every second or so
+=================
+*/
+static void Bench_PlayerCommand(int32_t player, int32_t frame, usercmd_t* cmd)
+{
+	int32_t	tick_msec;
+
+	tick_msec = (int32_t)(TICK_TIME * 1000);
+
+	memset(cmd, 0, sizeof(*cmd));
+	cmd->msec = tick_msec;
+	cmd->angles[YAW] = ANGLE2SHORT(player * 90 + frame * 2);
+	cmd->forwardmove = 300;
+	cmd->sidemove = ((frame / 80 + player) & 1) ? 150 : -150;
+	cmd->lightlevel = 128;		// monsters can't see anyone standing in the dark
+
+	if (frame % 120 == 0)
+		cmd->upmove = 200;
+
+	if (bench_options.fire
+		&& (frame + player * 7) % 40 < 2)
+		cmd->buttons |= BUTTON_ATTACK1;
+}
+
+/*
+=================
+Bench_ServerCommand
+
+Runs an sv command as if it was typed at the server console
+=================
+*/
+static void Bench_ServerCommand(game_export_t* ge, char* command)
+{
+	char*	argv[32];
+	char*	text;
+	int32_t	argc;
+
+	text = strdup(command);
+	argv[0] = "sv";
+	argc = 1;
+
+	for (argv[argc] = strtok(text, " "); argv[argc] && argc < 31; argv[argc] = strtok(NULL, " "))
+		argc++;
+
+	Bench_SetArgs(argc, argv);
+	ge->Server_Command();
+	Bench_SetArgs(0, NULL);
+
+	free(text);
+}
+
+static int Bench_CompareTimes(const void* a, const void* b)
+{
+	int64_t t1 = *(int64_t*)a;
+	int64_t t2 = *(int64_t*)b;
+
+	return (t1 > t2) - (t1 < t2);
+}
+
+static void Bench_Frame(game_export_t* ge, int32_t frame)
+{
+	usercmd_t	cmd;
+	int32_t		i;
+
+	for (i = 0; i < bench_options.players; i++)
+	{
+		Bench_PlayerCommand(i, frame, &cmd);
+		ge->Client_Think(&g_edicts[i + 1], &cmd);
+	}
+
+	ge->Game_RunFrame();
+}
+
+int main(int argc, char** argv)
+{
+	game_import_t	import;
+	game_export_t*	ge;
+	bench_stats_t	start_stats;
+	int64_t*		times;
+	int64_t			start, total, live_start, cache_misses;
+	char*			entities;
+	edict_t*		ent;
+	int32_t			i, frame, alive, edicts;
+
+	Bench_ParseOptions(argc, argv);
+
+	Bench_InitImports(&import);
+	ge = GetGameAPI(&import);
+
+	import.Cvar_ForceSet("sv_maxclients", va("%i", bench_options.players));
+	import.Cvar_ForceSet("gamemode", va("%i", GAMEMODE_TDM));
+
+	for (i = 0; i < bench_options.num_cvars; i += 2)
+		import.Cvar_ForceSet(bench_options.cvars[i], bench_options.cvars[i + 1]);
+
+	srand(bench_options.seed);
+
+	ge->Game_Init();
+
+	// a different map, so the navigation graph isn't read back from the other one's cache
+	if (bench_options.walls)
+		Bench_AddWalls();
+
+	entities = Bench_BuildEntityString();
+	ge->Game_SpawnEntities(bench_options.walls ? "gamebench_walls" : "gamebench", entities, "");
+	free(entities);
+
+	Bench_ConnectPlayers(ge);
+
+	for (frame = 0; frame < bench_options.warmup; frame++)
+		Bench_Frame(ge, frame);
+
+	if (bench_options.trace)
+		Bench_ServerCommand(ge, va("trace start 0 %s", bench_options.trace));
+
+	times = malloc(bench_options.frames * sizeof(times[0]));
+	start_stats = bench_stats;
+	live_start = Bench_LiveBytes();
+	total = 0;
+
+	Bench_StartCacheMisses();
+
+	for (i = 0; i < bench_options.frames; i++, frame++)
+	{
+		start = Bench_Nanoseconds();
+		Bench_Frame(ge, frame);
+		times[i] = Bench_Nanoseconds() - start;
+		total += times[i];
+	}
+
+	cache_misses = Bench_StopCacheMisses();
+
+	if (bench_options.trace)
+		Bench_ServerCommand(ge, "trace stop");
+
+	alive = edicts = 0;
+
+	for (ent = EdictList_Next(NULL); ent; ent = EdictList_Next(ent))
+	{
+		edicts++;
+
+		if ((ent->svflags & SVF_MONSTER) && ent->health > 0)
+			alive++;
+	}
+
+	qsort(times, bench_options.frames, sizeof(times[0]), Bench_CompareTimes);
+
+	printf("gamebench: %i zombies, %i players, %i frames at %.0f Hz, seed %i%s\n",
+		bench_options.zombies, bench_options.players, bench_options.frames, sv_tickrate->value, bench_options.seed,
+		bench_options.fire ? ", firing" : "");
+	printf("  frame time     mean %10.0f ns  median %10lli ns  p99 %10lli ns  max %10lli ns\n",
+		total / (double)bench_options.frames, (long long)times[bench_options.frames / 2],
+		(long long)times[bench_options.frames * 99 / 100], (long long)times[bench_options.frames - 1]);
+	printf("  engine time    %10.0f ns/frame (%.1f%%), game time %10.0f ns/frame\n",
+		(bench_stats.engine_ns - start_stats.engine_ns) / (double)bench_options.frames,
+		total ? 100.0 * (bench_stats.engine_ns - start_stats.engine_ns) / total : 0,
+		(total - (bench_stats.engine_ns - start_stats.engine_ns)) / (double)bench_options.frames);
+	printf("  traces         %10.1f /frame\n", (bench_stats.traces - start_stats.traces) / (double)bench_options.frames);
+	printf("  pointcontents  %10.1f /frame\n", (bench_stats.pointcontents - start_stats.pointcontents) / (double)bench_options.frames);
+	printf("  BoxEdicts      %10.1f /frame\n", (bench_stats.box_edicts - start_stats.box_edicts) / (double)bench_options.frames);
+	printf("  links          %10.1f /frame\n", (bench_stats.links - start_stats.links) / (double)bench_options.frames);
+
+	if (cache_misses >= 0)
+		printf("  cache misses   %10.1f /frame\n", cache_misses / (double)bench_options.frames);
+	else
+		printf("  cache misses   unavailable (no perf counters)\n");
+
+	printf("  allocations    %10lli (%lli bytes), %lli frees, %+lli bytes live\n",
+		(long long)(bench_stats.allocations - start_stats.allocations),
+		(long long)(bench_stats.allocated_bytes - start_stats.allocated_bytes),
+		(long long)(bench_stats.frees - start_stats.frees),
+		(long long)(Bench_LiveBytes() - live_start));
+	printf("  edicts         %10i in use, %i zombies alive\n", edicts, alive);
+
+	free(times);
+
+	if (bench_options.command)
+		Bench_ServerCommand(ge, bench_options.command);
+
+	ge->Game_Shutdown();
+	return 0;
+}
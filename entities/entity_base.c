@@ -116,6 +116,48 @@ spawn_t	spawns[] =
 	{NULL, NULL}
 };
 
+#define NUM_SPAWNS		(int32_t)(sizeof(spawns) / sizeof(spawns[0]) - 1)
+
+// items first, then spawns[], the same order ED_CallSpawn used to search them in
+perfect_hash_t	spawn_hash;
+perfect_hash_t	field_hash;
+int32_t			num_fields;
+
+static char* ED_SpawnHashKey(int32_t index)
+{
+	if (index < game.num_items)
+		return itemlist[index].classname;
+
+	return spawns[index - game.num_items].name;
+}
+
+static char* ED_FieldHashKey(int32_t index)
+{
+	if (fields[index].flags & FFL_NOSPAWN)
+		return NULL;
+
+	return fields[index].name;
+}
+
+/*
+===============
+ED_InitHashes
+
+Builds the spawn function and field lookups, called from InitGame once the
+item list is set up
+===============
+*/
+void ED_InitHashes()
+{
+	field_t* f;
+
+	for (f = fields, num_fields = 0; f->name; f++)
+		num_fields++;
+
+	PerfectHash_Build(&spawn_hash, game.num_items + NUM_SPAWNS, ED_SpawnHashKey);
+	PerfectHash_Build(&field_hash, num_fields, ED_FieldHashKey);
+}
+
 /*
 ===============
 ED_CallSpawn
@@ -125,9 +167,7 @@ Finds the spawn function for the entity and calls it
 */
 void ED_CallSpawn(edict_t* ent)
 {
-	spawn_t* s;
-	gitem_t* item;
-	int		i;
+	int32_t	index;
 
 	if (!ent->classname)
 	{
@@ -135,49 +175,47 @@ void ED_CallSpawn(edict_t* ent)
 		return;
 	}
 
-	// check item spawn functions
-	for (i = 0, item = itemlist; i < game.num_items; i++, item++)
-	{
-		if (!item->classname)
-			continue;
-		if (!strcmp(item->classname, ent->classname))
-		{	// found it
-			Item_Spawn(ent, item);
-			return;
-		}
-	}
+	index = PerfectHash_Find(&spawn_hash, ent->classname);
 
-	// check normal spawn functions
-	for (s = spawns; s->name; s++)
+	if (index >= 0
+		&& !strcmp(ED_SpawnHashKey(index), ent->classname))
 	{
-		if (!strcmp(s->name, ent->classname))
-		{	// found it
-			s->spawn(ent);
-			return;
-		}
+		// check item spawn functions
+		if (index < game.num_items)
+			Item_Spawn(ent, &itemlist[index]);
+		// check normal spawn functions
+		else
+			spawns[index - game.num_items].spawn(ent);
+
+		return;
 	}
+
 	gi.dprintf("%s doesn't have a spawn function\n", ent->classname);
 }
 
 /*
 =============
 ED_NewString
+
+Returns the level's shared copy of a spawn key's value, with \n escapes turned
+into newlines
 =============
 */
 char* ED_NewString(char* string)
 {
-	char* newb, * new_p;
+	char	newb[MAX_TOKEN_CHARS], * new_p;
 	int		i, l;
 
 	l = (int32_t)strlen(string) + 1;
 
-	newb = gi.TagMalloc(l, TAG_LEVEL);
+	if (l > sizeof(newb))
+		l = sizeof(newb);
 
 	new_p = newb;
 
-	for (i = 0; i < l; i++)
+	for (i = 0; i < l - 1; i++)
 	{
-		if (string[i] == '\\' && i < l - 1)
+		if (string[i] == '\\' && i < l - 2)
 		{
 			i++;
 			if (string[i] == 'n')
@@ -189,7 +227,9 @@ char* ED_NewString(char* string)
 			*new_p++ = string[i];
 	}
 
-	return newb;
+	*new_p = 0;
+
+	return StringPool_Intern(newb);
 }
 
 
@@ -211,69 +251,71 @@ void ED_ParseField(char* key, char* value, edict_t* ent)
 	vec3_t	vec3 = { 0 };
 	vec4_t	vec4 = { 0 };
 	int32_t successful = 0;
+	int32_t index;
 
-	for (f = fields; f->name; f++)
-	{
-		if (!(f->flags & FFL_NOSPAWN) && !Q_stricmp(f->name, key))
-		{	// found it
-			if (f->flags & FFL_SPAWNTEMP)
-				b = (uint8_t*)&st;
-			else
-				b = (uint8_t*)ent;
+	index = PerfectHash_Find(&field_hash, key);
 
-			switch (f->type)
+	if (index >= 0 && !Q_stricmp(fields[index].name, key))
+	{	// found it
+		f = &fields[index];
+
+		if (f->flags & FFL_SPAWNTEMP)
+			b = (uint8_t*)&st;
+		else
+			b = Component_FieldBase(ent, f);
+
+		switch (f->type)
+		{
+		case F_LSTRING:
+			*(char**)(b + f->ofs) = ED_NewString(value);
+			break;
+		case F_VECTOR3:
+			successful = sscanf(value, "%f %f %f", &vec3[0], &vec3[1], &vec3[2]);
+
+			if (successful != 3)
+				Sys_Error("Malformed Vector3 passed to ED_ParseField!");
+
+			((float*)(b + f->ofs))[0] = vec3[0];
+			((float*)(b + f->ofs))[1] = vec3[1];
+			((float*)(b + f->ofs))[2] = vec3[2];
+			break;
+		case F_VECTOR4:
+			successful = sscanf(value, "%f %f %f %f", &vec4[0], &vec4[1], &vec4[2], &vec4[3]);
+
+			// allow rgb colours, but assume alpha is 255
+			if (successful == 3)
 			{
-			case F_LSTRING:
-				*(char**)(b + f->ofs) = ED_NewString(value);
-				break;
-			case F_VECTOR3:
-				successful = sscanf(value, "%f %f %f", &vec3[0], &vec3[1], &vec3[2]);
-
-				if (successful != 3)
-					Sys_Error("Malformed Vector3 passed to ED_ParseField!");
-
-				((float*)(b + f->ofs))[0] = vec3[0];
-				((float*)(b + f->ofs))[1] = vec3[1];
-				((float*)(b + f->ofs))[2] = vec3[2];
-				break;
-			case F_VECTOR4:
-				successful = sscanf(value, "%f %f %f %f", &vec4[0], &vec4[1], &vec4[2], &vec4[3]);
-
-				// allow rgb colours, but assume alpha is 255
-				if (successful == 3)
-				{
-					gi.dprintf("Warning: Provided vector3 to vector4 type, assuming vec4[3] is 255...\n");
-					successful = 4;
-					vec4[3] = 255;
-				}
-
-				if (successful != 4)
-					Sys_Error("Malformed Vector4 passed to ED_ParseField!");
-
-				((float*)(b + f->ofs))[0] = vec4[0];
-				((float*)(b + f->ofs))[1] = vec4[1];
-				((float*)(b + f->ofs))[2] = vec4[2];
-				((float*)(b + f->ofs))[3] = vec4[3];
-				break;
-			case F_INT:
-				*(int32_t*)(b + f->ofs) = atoi(value);
-				break;
-			case F_FLOAT:
-				*(float*)(b + f->ofs) = (float)atof(value);
-				break;
-			case F_ANGLEHACK:
-				v = atof(value);
-				((float*)(b + f->ofs))[0] = 0;
-				((float*)(b + f->ofs))[1] = v;
-				((float*)(b + f->ofs))[2] = 0;
-				break;
-			case F_IGNORE:
-				break;
-			default:
-				break;
+				gi.dprintf("Warning: Provided vector3 to vector4 type, assuming vec4[3] is 255...\n");
+				successful = 4;
+				vec4[3] = 255;
 			}
-			return;
+
+			if (successful != 4)
+				Sys_Error("Malformed Vector4 passed to ED_ParseField!");
+
+			((float*)(b + f->ofs))[0] = vec4[0];
+			((float*)(b + f->ofs))[1] = vec4[1];
+			((float*)(b + f->ofs))[2] = vec4[2];
+			((float*)(b + f->ofs))[3] = vec4[3];
+			break;
+		case F_INT:
+			*(int32_t*)(b + f->ofs) = atoi(value);
+			break;
+		case F_FLOAT:
+			*(float*)(b + f->ofs) = (float)atof(value);
+			break;
+		case F_ANGLEHACK:
+			v = atof(value);
+			((float*)(b + f->ofs))[0] = 0;
+			((float*)(b + f->ofs))[1] = v;
+			((float*)(b + f->ofs))[2] = 0;
+			break;
+		case F_IGNORE:
+			break;
+		default:
+			break;
 		}
+		return;
 	}
 	gi.dprintf("%s is not a field\n", key);
 }
@@ -326,7 +368,17 @@ char* ED_ParseEdict(char* data, edict_t* ent)
 	}
 
 	if (!init)
+	{
+		EdictList_Remove(ent);
+		Class_Unlink(ent);
 		memset(ent, 0, sizeof(*ent));
+		EdictQueue_Release(ent);
+	}
+	else
+	{
+		Targetname_Link(ent);
+		Edict_SetClassname(ent, ent->classname);
+	}
 
 	return data;
 }
@@ -405,8 +457,11 @@ void Game_SpawnEntities(char* mapname, char* entities, char* spawnpoint)
 	edict_t* ent;
 	int32_t		inhibit;
 	char* com_token;
-	int32_t		i;
+	int32_t		i, count;
 	float		skill_level;
+	int64_t		start;
+
+	Trace_Begin("Game_SpawnEntities", -1);
 
 	skill_level = floorf(skill->value);
 	if (skill_level < 0)
@@ -420,8 +475,25 @@ void Game_SpawnEntities(char* mapname, char* entities, char* spawnpoint)
 
 	gi.FreeTags(TAG_LEVEL);
 
+	// no value can be longer than the entity string it came from
+	StringPool_Reset((int32_t)strlen(entities) + 1);
+
 	memset(&level, 0, sizeof(level));
 	memset(g_edicts, 0, game.maxentities * sizeof(g_edicts[0]));
+	Component_Clear();
+	EdictList_Clear();
+	EdictQueue_Rebuild();
+	Targetname_Clear();
+
+	// the trace names entities by class, write those out before the ids are reused
+	Trace_Flush();
+	Class_Clear();
+	ThinkWheel_Clear();
+	GibPool_Clear();
+	Batch_Clear();
+	Spatial_Clear();
+	TraceCache_Clear();
+	Nav_Clear(entities);
 
 	strncpy(level.mapname, mapname, sizeof(level.mapname) - 1);
 	strncpy(game.spawnpoint, spawnpoint, sizeof(game.spawnpoint) - 1);
@@ -432,6 +504,8 @@ void Game_SpawnEntities(char* mapname, char* entities, char* spawnpoint)
 
 	ent = NULL;
 	inhibit = 0;
+	count = 0;
+	start = Sys_Nanoseconds();
 
 	// parse ents
 	while (1)
@@ -492,13 +566,19 @@ void Game_SpawnEntities(char* mapname, char* entities, char* spawnpoint)
 		}
 
 		ED_CallSpawn(ent);
+		count++;
 	}
 
 	gi.dprintf("%i entities inhibited\n", inhibit);
+	gi.dprintf("%i entities spawned in %.2f ms\n", count, (Sys_Nanoseconds() - start) / 1000000.0);
 
 	G_FindTeams();
 
 	PlayerTrail_Init();
+	ProjectilePool_Init();
+	Nav_Init();
+
+	Trace_End();
 }
 
 char* dm_statusbar =
@@ -568,6 +648,8 @@ void SP_worldspawn(edict_t* ent)
 	ent->movetype = MOVETYPE_PUSH;
 	ent->solid = SOLID_BSP;
 	ent->inuse = true;			// since the world doesn't use G_Spawn()
+	EdictList_Add(ent);
+	Edict_SetClassname(ent, ent->classname);
 	ent->s.modelindex = 1;		// world model is always index 1
 
 	//---------------
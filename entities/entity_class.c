@@ -0,0 +1,346 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// entity_class.c : Interned classnames
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+CLASS TABLE
+
+==============================================================================
+
+Every classname an edict is given is interned into a table that lasts for the
+whole game, and the edict stores the index as classid. Comparing classids is
+an integer compare, and every class keeps a list of its live edicts sorted by
+edict number so it can be walked instead of scanning every edict.
+
+The classes the game code checks for by name are registered first in the
+order of class_id_t, so their ids are constant.
+*/
+
+#define CLASS_HASH_SIZE		256
+
+typedef struct class_s
+{
+	char		name[MAX_QPATH];
+	int32_t		hash_next;			// next class in the same hash bucket, or CLASS_NONE
+	int32_t		count;				// live edicts of this class
+	edict_t*	head;				// live edicts, sorted by edict number
+	edict_t*	tail;
+} class_t;
+
+// must match class_id_t
+static char* class_builtin_names[] =
+{
+	"",
+	"worldspawn",
+	"player",
+	"player_noise",
+	"func_areaportal",
+	"func_door",
+	"func_door_rotating",
+	"func_train",
+	"path_corner",
+	"point_combat",
+	"target_actor",
+	"target_changelevel",
+	"target_crosslevel_target",
+	"info_player_start",
+	"info_player_deathmatch",
+	"info_player_intermission",
+	"grenade",
+	"light",
+	"light_spot",
+	"key_power_cube",
+	"monster_medic",
+};
+
+class_t		classes[MAX_CLASSES];
+int32_t		num_classes;
+int32_t		class_hash[CLASS_HASH_SIZE];
+
+static int32_t Class_Lookup(char* name, int32_t* bucket)
+{
+	int32_t	id;
+
+	*bucket = Q_HashStringNoCase(name) & (CLASS_HASH_SIZE - 1);
+
+	for (id = class_hash[*bucket]; id != CLASS_NONE; id = classes[id].hash_next)
+	{
+		if (!Q_stricmp(classes[id].name, name))
+			return id;
+	}
+
+	return CLASS_NONE;
+}
+
+/*
+=============
+Class_Find
+
+Returns the id of an already interned classname, or CLASS_NONE
+=============
+*/
+int32_t Class_Find(char* name)
+{
+	int32_t	bucket;
+
+	if (!name || !name[0])
+		return CLASS_NONE;
+
+	return Class_Lookup(name, &bucket);
+}
+
+/*
+=============
+Class_Intern
+
+Returns the id for a classname, adding it to the table if it isn't there yet
+=============
+*/
+int32_t Class_Intern(char* name)
+{
+	int32_t	id, bucket;
+
+	if (!name || !name[0])
+		return CLASS_NONE;
+
+	id = Class_Lookup(name, &bucket);
+
+	if (id != CLASS_NONE)
+		return id;
+
+	if (num_classes >= MAX_CLASSES)
+	{
+		gi.dprintf("Class_Intern: too many classes, %s will not be indexed\n", name);
+		return CLASS_NONE;
+	}
+
+	if (strlen(name) >= MAX_QPATH)
+	{
+		gi.dprintf("Class_Intern: classname %s is too long to be indexed\n", name);
+		return CLASS_NONE;
+	}
+
+	id = num_classes++;
+	strcpy(classes[id].name, name);
+	classes[id].hash_next = class_hash[bucket];
+	class_hash[bucket] = id;
+
+	return id;
+}
+
+char* Class_Name(int32_t id)
+{
+	if (id <= CLASS_NONE || id >= num_classes)
+		return "";
+
+	return classes[id].name;
+}
+
+static void Class_Link(edict_t* ent)
+{
+	class_t*	cls;
+	edict_t*	prev;
+
+	if (ent->classid == CLASS_NONE)
+		return;
+
+	cls = &classes[ent->classid];
+
+	// usually spawned after everything else of its class, so search from the back
+	for (prev = cls->tail; prev && prev > ent; prev = prev->class_prev)
+		;
+
+	ent->class_prev = prev;
+	ent->class_next = (prev) ? prev->class_next : cls->head;
+
+	if (ent->class_next)
+		ent->class_next->class_prev = ent;
+	else
+		cls->tail = ent;
+
+	if (prev)
+		prev->class_next = ent;
+	else
+		cls->head = ent;
+
+	cls->count++;
+	ent->class_linked = true;
+}
+
+/*
+=============
+Class_Unlink
+
+Takes the edict out of its class list, the classid is left alone
+=============
+*/
+void Class_Unlink(edict_t* ent)
+{
+	class_t* cls;
+
+	if (!ent->class_linked)
+		return;
+
+	cls = &classes[ent->classid];
+
+	if (ent->class_prev)
+		ent->class_prev->class_next = ent->class_next;
+	else
+		cls->head = ent->class_next;
+
+	if (ent->class_next)
+		ent->class_next->class_prev = ent->class_prev;
+	else
+		cls->tail = ent->class_prev;
+
+	cls->count--;
+	ent->class_prev = ent->class_next = NULL;
+	ent->class_linked = false;
+}
+
+/*
+=============
+Class_Init
+
+Registers the builtin classes, called once from InitGame
+=============
+*/
+void Class_Init()
+{
+	int32_t	i;
+
+	memset(classes, 0, sizeof(classes));
+
+	for (i = 0; i < CLASS_HASH_SIZE; i++)
+		class_hash[i] = CLASS_NONE;
+
+	// CLASS_NONE is never hashed
+	num_classes = 1;
+
+	for (i = 1; i < CLASS_NUM_BUILTIN; i++)
+		Class_Intern(class_builtin_names[i]);
+}
+
+/*
+=============
+Class_Clear
+
+Empties every class list, called when the edicts are wiped for a new level
+=============
+*/
+void Class_Clear()
+{
+	int32_t i;
+
+	for (i = 0; i < num_classes; i++)
+	{
+		classes[i].head = classes[i].tail = NULL;
+		classes[i].count = 0;
+	}
+}
+
+/*
+=============
+Class_Rebuild
+
+Reinterns and relinks every edict, after the edicts have been loaded. The
+ids saved with the edicts may have come from a different run.
+=============
+*/
+void Class_Rebuild()
+{
+	int32_t		i;
+	edict_t*	ent;
+
+	Class_Clear();
+
+	for (i = 0, ent = g_edicts; i < globals.num_edicts; i++, ent++)
+	{
+		ent->class_prev = ent->class_next = NULL;
+		ent->class_linked = false;
+		ent->classid = CLASS_NONE;
+
+		if (ent->inuse)
+			Edict_SetClassname(ent, ent->classname);
+	}
+}
+
+/*
+=============
+Edict_SetClassname
+
+Sets the classname of an edict and moves it into the list for that class.
+Edicts that aren't in use keep their classid but aren't listed.
+=============
+*/
+void Edict_SetClassname(edict_t* ent, char* classname)
+{
+	Class_Unlink(ent);
+
+	ent->classname = classname;
+	ent->classid = Class_Intern(classname);
+
+	if (ent->inuse)
+		Class_Link(ent);
+}
+
+/*
+=============
+Edict_FindByClass
+
+G_Find (from, FOFS(classname), name) for an interned class. Returns the next
+live edict of the class after from, or the first one if from is NULL.
+=============
+*/
+edict_t* Edict_FindByClass(edict_t* from, int32_t classid)
+{
+	edict_t* ent;
+
+	if (classid <= CLASS_NONE || classid >= num_classes)
+		return NULL;
+
+	if (from && from->class_linked && from->classid == classid)
+		return from->class_next;
+
+	for (ent = classes[classid].head; ent && from && ent <= from; ent = ent->class_next)
+		;
+
+	return ent;
+}
+
+/*
+=============
+Class_Count
+
+Returns the number of live edicts of a class
+=============
+*/
+int32_t Class_Count(int32_t classid)
+{
+	if (classid <= CLASS_NONE || classid >= num_classes)
+		return 0;
+
+	return classes[classid].count;
+}
@@ -0,0 +1,301 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// entity_component.c : Optional per-edict data blocks
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+COMPONENTS
+
+==============================================================================
+
+monsterinfo, moveinfo and the func_particle_effect fields used to be inline
+in every edict_t, so lights, triggers, player noise and trail markers all
+carried them. They are now components: blocks taken from a pool for each type
+only by the entities that use them, which get a pointer to theirs in the
+edict. Everything else has NULL there.
+
+A spawn function that needs one calls Component_Add before filling it in, and
+spawn keys for a component's fields (FFL_MONSTER, FFL_MOVER, FFL_PARTICLES)
+add it themselves. Edict_Free gives them back. On disk, the edict holds its
+components' handles and each one is written out after it.
+
+The pools grow COMPONENT_BLOCK_SIZE components at a time from TAG_LEVEL
+memory, so Component_Clear has to be called whenever that is freed.
+*/
+
+#define COMPONENT_BLOCK_SIZE	64
+#define COMPONENT_MAX_BLOCKS	((MAX_EDICTS + COMPONENT_BLOCK_SIZE - 1) / COMPONENT_BLOCK_SIZE)
+
+typedef struct component_pool_s
+{
+	const char*	name;
+	int32_t		size;							// of one component
+	uint8_t*	blocks[COMPONENT_MAX_BLOCKS];
+	int32_t		num_blocks;
+	void*		free;							// first free component, each keeps the next in its first bytes
+	int32_t		live;
+	int32_t		peak;
+} component_pool_t;
+
+static component_pool_t	component_pools[COMPONENT_NUM_TYPES] =
+{
+	{ "monster", sizeof(monsterinfo_t) },
+	{ "mover", sizeof(moveinfo_t) },
+	{ "particles", sizeof(particle_emitter_t) },
+};
+
+/*
+=============
+Component_Slot
+
+Returns where ent keeps its pointer to a component of type
+=============
+*/
+void** Component_Slot(edict_t* ent, component_type_t type)
+{
+	switch (type)
+	{
+	case COMPONENT_MONSTER:
+		return (void**)&ent->monsterinfo;
+	case COMPONENT_MOVER:
+		return (void**)&ent->moveinfo;
+	case COMPONENT_PARTICLES:
+		return (void**)&ent->particles;
+	default:
+		gi.error("Component_Slot: bad component type %i", type);
+		return NULL;
+	}
+}
+
+static void Component_Grow(component_pool_t* pool)
+{
+	uint8_t*	block;
+	int32_t		i;
+
+	if (pool->num_blocks >= COMPONENT_MAX_BLOCKS)
+		gi.error("Component_Add: out of %s components", pool->name);
+
+	block = gi.TagMalloc(pool->size * COMPONENT_BLOCK_SIZE, TAG_LEVEL);
+	pool->blocks[pool->num_blocks++] = block;
+
+	// chain them backwards so they are handed out in order
+	for (i = COMPONENT_BLOCK_SIZE - 1; i >= 0; i--)
+	{
+		*(void**)(block + i * pool->size) = pool->free;
+		pool->free = block + i * pool->size;
+	}
+}
+
+/*
+=============
+Component_Add
+
+Gives ent a cleared component of type if it doesn't have one and returns it
+=============
+*/
+void* Component_Add(edict_t* ent, component_type_t type)
+{
+	component_pool_t*	pool;
+	void**				slot;
+
+	slot = Component_Slot(ent, type);
+
+	if (*slot)
+		return *slot;
+
+	pool = &component_pools[type];
+
+	if (!pool->free)
+		Component_Grow(pool);
+
+	*slot = pool->free;
+	pool->free = *(void**)pool->free;
+	memset(*slot, 0, pool->size);
+
+	if (++pool->live > pool->peak)
+		pool->peak = pool->live;
+
+	return *slot;
+}
+
+/*
+=============
+Component_RemoveAll
+
+Gives back all of ent's components, called when it is freed or recycled
+=============
+*/
+void Component_RemoveAll(edict_t* ent)
+{
+	component_pool_t*	pool;
+	void**				slot;
+	int32_t				type;
+
+	for (type = 0; type < COMPONENT_NUM_TYPES; type++)
+	{
+		slot = Component_Slot(ent, type);
+
+		if (!*slot)
+			continue;
+
+		pool = &component_pools[type];
+		*(void**)*slot = pool->free;
+		pool->free = *slot;
+		pool->live--;
+		*slot = NULL;
+	}
+}
+
+/*
+=============
+Component_Clear
+
+Empties the pools, called when the edicts are wiped and TAG_LEVEL is freed
+=============
+*/
+void Component_Clear()
+{
+	component_pool_t*	pool;
+	int32_t				type;
+
+	for (type = 0; type < COMPONENT_NUM_TYPES; type++)
+	{
+		pool = &component_pools[type];
+		memset(pool->blocks, 0, sizeof(pool->blocks));
+		pool->num_blocks = 0;
+		pool->free = NULL;
+		pool->live = 0;
+	}
+}
+
+/*
+=============
+Component_Handle
+
+Returns the handle of ent's component of type, which is what goes on disk,
+or 0 if it doesn't have one
+=============
+*/
+int32_t Component_Handle(edict_t* ent, component_type_t type)
+{
+	component_pool_t*	pool;
+	uint8_t*			component;
+	int32_t				i;
+
+	component = *Component_Slot(ent, type);
+
+	if (!component)
+		return 0;
+
+	pool = &component_pools[type];
+
+	for (i = 0; i < pool->num_blocks; i++)
+	{
+		if (component >= pool->blocks[i]
+			&& component < pool->blocks[i] + pool->size * COMPONENT_BLOCK_SIZE)
+			return i * COMPONENT_BLOCK_SIZE + (int32_t)((component - pool->blocks[i]) / pool->size) + 1;
+	}
+
+	gi.error("Component_Handle: %s component of %s isn't in its pool", pool->name, ent->classname);
+	return 0;
+}
+
+/*
+=============
+Component_Size
+
+Returns how big a component of type is
+=============
+*/
+int32_t Component_Size(component_type_t type)
+{
+	return component_pools[type].size;
+}
+
+/*
+=============
+Component_FieldType
+
+Returns the component a field's offset is into, COMPONENT_NUM_TYPES if it
+is into the edict itself
+=============
+*/
+component_type_t Component_FieldType(field_t* field)
+{
+	if (field->flags & FFL_MONSTER)
+		return COMPONENT_MONSTER;
+	else if (field->flags & FFL_MOVER)
+		return COMPONENT_MOVER;
+	else if (field->flags & FFL_PARTICLES)
+		return COMPONENT_PARTICLES;
+
+	return COMPONENT_NUM_TYPES;
+}
+
+/*
+=============
+Component_FieldBase
+
+Returns what a spawn field's offset is from for ent, adding the component
+it is in if ent doesn't have it yet
+=============
+*/
+uint8_t* Component_FieldBase(edict_t* ent, field_t* field)
+{
+	component_type_t	type;
+
+	type = Component_FieldType(field);
+
+	if (type == COMPONENT_NUM_TYPES)
+		return (uint8_t*)ent;
+
+	return (uint8_t*)Component_Add(ent, type);
+}
+
+/*
+=============
+Component_PrintStats
+
+Prints the pools for sv stats
+=============
+*/
+void Component_PrintStats()
+{
+	component_pool_t*	pool;
+	int32_t				type, inline_size;
+
+	gi.cprintf(NULL, PRINT_HIGH, "Components:\n");
+	inline_size = 0;
+
+	for (type = 0; type < COMPONENT_NUM_TYPES; type++)
+	{
+		pool = &component_pools[type];
+		inline_size += pool->size - (int32_t)sizeof(void*);
+		gi.cprintf(NULL, PRINT_HIGH, "  %-11s %5i live (peak %i), %i bytes each, %i allocated\n",
+			pool->name, pool->live, pool->peak, pool->size, pool->num_blocks * COMPONENT_BLOCK_SIZE);
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "  edict_t is %i bytes, it would be %i with them inline\n",
+		(int32_t)sizeof(edict_t), (int32_t)sizeof(edict_t) + inline_size);
+}
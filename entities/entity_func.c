@@ -77,39 +77,39 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 void Move_Done(edict_t* ent)
 {
 	VectorClear3(ent->velocity);
-	ent->moveinfo.endfunc(ent);
+	ent->moveinfo->endfunc(ent);
 }
 
 void Move_Final(edict_t* ent)
 {
-	if (ent->moveinfo.remaining_distance == 0)
+	if (ent->moveinfo->remaining_distance == 0)
 	{
 		Move_Done(ent);
 		return;
 	}
 
-	VectorScale3(ent->moveinfo.dir, ent->moveinfo.remaining_distance / TICK_TIME, ent->velocity);
+	VectorScale3(ent->moveinfo->dir, ent->moveinfo->remaining_distance / TICK_TIME, ent->velocity);
 
 	ent->think = Move_Done;
-	ent->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(ent, level.time + TICK_TIME);
 }
 
 void Move_Begin(edict_t* ent)
 {
 	float frames;
 
-	if ((ent->moveinfo.speed * TICK_TIME) >= ent->moveinfo.remaining_distance)
+	if ((ent->moveinfo->speed * TICK_TIME) >= ent->moveinfo->remaining_distance)
 	{
 		Move_Final(ent);
 		return;
 	}
-	VectorScale3(ent->moveinfo.dir, ent->moveinfo.speed, ent->velocity);
+	VectorScale3(ent->moveinfo->dir, ent->moveinfo->speed, ent->velocity);
 
 	// scale by static (0.1f/FRAMETIME) to scale for tickrate
-	frames = floorf((ent->moveinfo.remaining_distance / ent->moveinfo.speed) / TICK_TIME);
-	ent->moveinfo.remaining_distance -= frames * ent->moveinfo.speed * TICK_TIME;
+	frames = floorf((ent->moveinfo->remaining_distance / ent->moveinfo->speed) / TICK_TIME);
+	ent->moveinfo->remaining_distance -= frames * ent->moveinfo->speed * TICK_TIME;
 
-	ent->nextthink = level.time + (frames * TICK_TIME);
+	Edict_SetNextThink(ent, level.time + (frames * TICK_TIME));
 	ent->think = Move_Final;
 }
 
@@ -118,11 +118,11 @@ void Think_AccelMove(edict_t* ent);
 void Move_Calc(edict_t* ent, vec3_t dest, void(*func)(edict_t*))
 {
 	VectorClear3(ent->velocity);
-	VectorSubtract3(dest, ent->s.origin, ent->moveinfo.dir);
-	ent->moveinfo.remaining_distance = VectorNormalize3(ent->moveinfo.dir);
-	ent->moveinfo.endfunc = func;
+	VectorSubtract3(dest, ent->s.origin, ent->moveinfo->dir);
+	ent->moveinfo->remaining_distance = VectorNormalize3(ent->moveinfo->dir);
+	ent->moveinfo->endfunc = func;
 
-	if (ent->moveinfo.speed == ent->moveinfo.accel && ent->moveinfo.speed == ent->moveinfo.decel)
+	if (ent->moveinfo->speed == ent->moveinfo->accel && ent->moveinfo->speed == ent->moveinfo->decel)
 	{
 		if (level.current_entity == ((ent->flags & FL_TEAMSLAVE) ? ent->teammaster : ent))
 		{
@@ -130,16 +130,16 @@ void Move_Calc(edict_t* ent, vec3_t dest, void(*func)(edict_t*))
 		}
 		else
 		{
-			ent->nextthink = level.time + TICK_TIME;
+			Edict_SetNextThink(ent, level.time + TICK_TIME);
 			ent->think = Move_Begin;
 		}
 	}
 	else
 	{
 		// accelerative
-		ent->moveinfo.current_speed = 0;
+		ent->moveinfo->current_speed = 0;
 		ent->think = Think_AccelMove;
-		ent->nextthink = level.time + TICK_TIME;
+		Edict_SetNextThink(ent, level.time + TICK_TIME);
 	}
 }
 
@@ -151,17 +151,17 @@ void Move_Calc(edict_t* ent, vec3_t dest, void(*func)(edict_t*))
 void AngleMove_Done(edict_t* ent)
 {
 	VectorClear3(ent->avelocity);
-	ent->moveinfo.endfunc(ent);
+	ent->moveinfo->endfunc(ent);
 }
 
 void AngleMove_Final(edict_t* ent)
 {
 	vec3_t	move;
 
-	if (ent->moveinfo.state == STATE_UP)
-		VectorSubtract3(ent->moveinfo.end_angles, ent->s.angles, move);
+	if (ent->moveinfo->state == STATE_UP)
+		VectorSubtract3(ent->moveinfo->end_angles, ent->s.angles, move);
 	else
-		VectorSubtract3(ent->moveinfo.start_angles, ent->s.angles, move);
+		VectorSubtract3(ent->moveinfo->start_angles, ent->s.angles, move);
 
 	if (VectorCompare3(move, vec3_origin))
 	{
@@ -172,7 +172,7 @@ void AngleMove_Final(edict_t* ent)
 	VectorScale3(move, 1.0 / TICK_TIME, ent->avelocity);
 
 	ent->think = AngleMove_Done;
-	ent->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(ent, level.time + TICK_TIME);
 }
 
 void AngleMove_Begin(edict_t* ent)
@@ -183,16 +183,16 @@ void AngleMove_Begin(edict_t* ent)
 	float	frames;
 
 	// set destdelta to the vector needed to move
-	if (ent->moveinfo.state == STATE_UP)
-		VectorSubtract3(ent->moveinfo.end_angles, ent->s.angles, destdelta);
+	if (ent->moveinfo->state == STATE_UP)
+		VectorSubtract3(ent->moveinfo->end_angles, ent->s.angles, destdelta);
 	else
-		VectorSubtract3(ent->moveinfo.start_angles, ent->s.angles, destdelta);
+		VectorSubtract3(ent->moveinfo->start_angles, ent->s.angles, destdelta);
 
 	// calculate length of vector
 	len = VectorLength3(destdelta);
 
 	// divide by speed to get time to reach dest
-	traveltime = len / ent->moveinfo.speed;
+	traveltime = len / ent->moveinfo->speed;
 
 	if (traveltime < TICK_TIME)
 	{
@@ -206,21 +206,21 @@ void AngleMove_Begin(edict_t* ent)
 	VectorScale3(destdelta, 1.0 / traveltime, ent->avelocity);
 
 	// set nextthink to trigger a think when dest is reached
-	ent->nextthink = level.time + frames * TICK_TIME;
+	Edict_SetNextThink(ent, level.time + frames * TICK_TIME);
 	ent->think = AngleMove_Final;
 }
 
 void AngleMove_Calc(edict_t* ent, void(*func)(edict_t*))
 {
 	VectorClear3(ent->avelocity);
-	ent->moveinfo.endfunc = func;
+	ent->moveinfo->endfunc = func;
 	if (level.current_entity == ((ent->flags & FL_TEAMSLAVE) ? ent->teammaster : ent))
 	{
 		AngleMove_Begin(ent);
 	}
 	else
 	{
-		ent->nextthink = level.time + TICK_TIME;
+		Edict_SetNextThink(ent, level.time + TICK_TIME);
 		ent->think = AngleMove_Begin;
 	}
 }
@@ -338,22 +338,22 @@ void plat_Accelerate(moveinfo_t* moveinfo)
 
 void Think_AccelMove(edict_t* ent)
 {
-	ent->moveinfo.remaining_distance -= ent->moveinfo.current_speed;
+	ent->moveinfo->remaining_distance -= ent->moveinfo->current_speed;
 
-	if (ent->moveinfo.current_speed == 0)		// starting or blocked
-		plat_CalcAcceleratedMove(&ent->moveinfo);
+	if (ent->moveinfo->current_speed == 0)		// starting or blocked
+		plat_CalcAcceleratedMove(ent->moveinfo);
 
-	plat_Accelerate(&ent->moveinfo);
+	plat_Accelerate(ent->moveinfo);
 
 	// will the entire move complete on next frame?
-	if (ent->moveinfo.remaining_distance <= ent->moveinfo.current_speed)
+	if (ent->moveinfo->remaining_distance <= ent->moveinfo->current_speed)
 	{
 		Move_Final(ent);
 		return;
 	}
 
-	VectorScale3(ent->moveinfo.dir, ent->moveinfo.current_speed * (1.0f/TICK_TIME), ent->velocity); // 40
-	ent->nextthink = level.time + TICK_TIME;
+	VectorScale3(ent->moveinfo->dir, ent->moveinfo->current_speed * (1.0f/TICK_TIME), ent->velocity); // 40
+	Edict_SetNextThink(ent, level.time + TICK_TIME);
 	ent->think = Think_AccelMove;
 }
 
@@ -364,49 +364,49 @@ void plat_hit_top(edict_t* ent)
 {
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_end)
-			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, ent->moveinfo.sound_end, 1, ATTN_STATIC, 0);
+		if (ent->moveinfo->sound_end)
+			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, ent->moveinfo->sound_end, 1, ATTN_STATIC, 0);
 		ent->s.sound = 0;
 	}
-	ent->moveinfo.state = STATE_TOP;
+	ent->moveinfo->state = STATE_TOP;
 
 	ent->think = plat_go_down;
-	ent->nextthink = level.time + 3;
+	Edict_SetNextThink(ent, level.time + 3);
 }
 
 void plat_hit_bottom(edict_t* ent)
 {
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_end)
-			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, ent->moveinfo.sound_end, 1, ATTN_STATIC, 0);
+		if (ent->moveinfo->sound_end)
+			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, ent->moveinfo->sound_end, 1, ATTN_STATIC, 0);
 		ent->s.sound = 0;
 	}
-	ent->moveinfo.state = STATE_BOTTOM;
+	ent->moveinfo->state = STATE_BOTTOM;
 }
 
 void plat_go_down(edict_t* ent)
 {
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_start)
-			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, ent->moveinfo.sound_start, 1, ATTN_STATIC, 0);
-		ent->s.sound = ent->moveinfo.sound_middle;
+		if (ent->moveinfo->sound_start)
+			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, ent->moveinfo->sound_start, 1, ATTN_STATIC, 0);
+		ent->s.sound = ent->moveinfo->sound_middle;
 	}
-	ent->moveinfo.state = STATE_DOWN;
-	Move_Calc(ent, ent->moveinfo.end_origin, plat_hit_bottom);
+	ent->moveinfo->state = STATE_DOWN;
+	Move_Calc(ent, ent->moveinfo->end_origin, plat_hit_bottom);
 }
 
 void plat_go_up(edict_t* ent)
 {
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_start)
-			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, ent->moveinfo.sound_start, 1, ATTN_STATIC, 0);
-		ent->s.sound = ent->moveinfo.sound_middle;
+		if (ent->moveinfo->sound_start)
+			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE, ent->moveinfo->sound_start, 1, ATTN_STATIC, 0);
+		ent->s.sound = ent->moveinfo->sound_middle;
 	}
-	ent->moveinfo.state = STATE_UP;
-	Move_Calc(ent, ent->moveinfo.start_origin, plat_hit_top);
+	ent->moveinfo->state = STATE_UP;
+	Move_Calc(ent, ent->moveinfo->start_origin, plat_hit_top);
 }
 
 void plat_blocked(edict_t* self, edict_t* other)
@@ -423,9 +423,9 @@ void plat_blocked(edict_t* self, edict_t* other)
 
 	Player_Damage(other, self, self, vec3_origin, other->s.origin, vec3_origin, self->dmg, 1, 0, MOD_CRUSH);
 
-	if (self->moveinfo.state == STATE_UP)
+	if (self->moveinfo->state == STATE_UP)
 		plat_go_down(self);
-	else if (self->moveinfo.state == STATE_DOWN)
+	else if (self->moveinfo->state == STATE_DOWN)
 		plat_go_up(self);
 }
 
@@ -447,10 +447,10 @@ void Touch_Plat_Center(edict_t* ent, edict_t* other, cplane_t* plane, csurface_t
 		return;
 
 	ent = ent->enemy;	// now point at the plat, not the trigger
-	if (ent->moveinfo.state == STATE_BOTTOM)
+	if (ent->moveinfo->state == STATE_BOTTOM)
 		plat_go_up(ent);
-	else if (ent->moveinfo.state == STATE_TOP)
-		ent->nextthink = level.time + 1;	// the player is still on the plat, so delay going down
+	else if (ent->moveinfo->state == STATE_TOP)
+		Edict_SetNextThink(ent, level.time + 1);	// the player is still on the plat, so delay going down
 }
 
 void plat_spawn_inside_trigger(edict_t* ent)
@@ -494,7 +494,7 @@ void plat_spawn_inside_trigger(edict_t* ent)
 	VectorCopy3(tmin, trigger->mins);
 	VectorCopy3(tmax, trigger->maxs);
 
-	gi.Edict_Link(trigger);
+	Edict_Link(trigger);
 }
 
 
@@ -517,6 +517,8 @@ Set "sounds" to one of the following:
 */
 void SP_func_plat(edict_t* ent)
 {
+	Component_Add(ent, COMPONENT_MOVER);
+
 	VectorClear3(ent->s.angles);
 	ent->solid = SOLID_BSP;
 	ent->movetype = MOVETYPE_PUSH;
@@ -560,27 +562,27 @@ void SP_func_plat(edict_t* ent)
 
 	if (ent->targetname)
 	{
-		ent->moveinfo.state = STATE_UP;
+		ent->moveinfo->state = STATE_UP;
 	}
 	else
 	{
 		VectorCopy3(ent->pos2, ent->s.origin);
-		gi.Edict_Link(ent);
-		ent->moveinfo.state = STATE_BOTTOM;
+		Edict_Link(ent);
+		ent->moveinfo->state = STATE_BOTTOM;
 	}
 
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy3(ent->pos1, ent->moveinfo.start_origin);
-	VectorCopy3(ent->s.angles, ent->moveinfo.start_angles);
-	VectorCopy3(ent->pos2, ent->moveinfo.end_origin);
-	VectorCopy3(ent->s.angles, ent->moveinfo.end_angles);
+	ent->moveinfo->speed = ent->speed;
+	ent->moveinfo->accel = ent->accel;
+	ent->moveinfo->decel = ent->decel;
+	ent->moveinfo->wait = ent->wait;
+	VectorCopy3(ent->pos1, ent->moveinfo->start_origin);
+	VectorCopy3(ent->s.angles, ent->moveinfo->start_angles);
+	VectorCopy3(ent->pos2, ent->moveinfo->end_origin);
+	VectorCopy3(ent->s.angles, ent->moveinfo->end_angles);
 
-	ent->moveinfo.sound_start = gi.soundindex("plats/pt1_strt.wav");
-	ent->moveinfo.sound_middle = gi.soundindex("plats/pt1_mid.wav");
-	ent->moveinfo.sound_end = gi.soundindex("plats/pt1_end.wav");
+	ent->moveinfo->sound_start = gi.soundindex("plats/pt1_strt.wav");
+	ent->moveinfo->sound_middle = gi.soundindex("plats/pt1_mid.wav");
+	ent->moveinfo->sound_end = gi.soundindex("plats/pt1_end.wav");
 }
 
 //====================================================================
@@ -618,7 +620,7 @@ void rotating_use(edict_t* self, edict_t* other, edict_t* activator)
 	}
 	else
 	{
-		self->s.sound = self->moveinfo.sound_middle;
+		self->s.sound = self->moveinfo->sound_middle;
 		VectorScale3(self->movedir, self->speed, self->avelocity);
 		if (self->spawnflags & 16)
 			self->touch = rotating_touch;
@@ -627,6 +629,8 @@ void rotating_use(edict_t* self, edict_t* other, edict_t* activator)
 
 void SP_func_rotating(edict_t* ent)
 {
+	Component_Add(ent, COMPONENT_MOVER);
+
 	ent->solid = SOLID_BSP;
 	if (ent->spawnflags & 32)
 		ent->movetype = MOVETYPE_STOP;
@@ -651,7 +655,7 @@ void SP_func_rotating(edict_t* ent)
 	if (!ent->dmg)
 		ent->dmg = 2;
 
-	//	ent->moveinfo.sound_middle = "doors/hydro1.wav";
+	//	ent->moveinfo->sound_middle = "doors/hydro1.wav";
 
 	ent->use = rotating_use;
 	if (ent->dmg)
@@ -666,7 +670,7 @@ void SP_func_rotating(edict_t* ent)
 		ent->s.effects |= EF_ANIM_ALLFAST;
 
 	gi.setmodel(ent, ent->model);
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 /*
@@ -696,16 +700,16 @@ When a button is touched, it moves some distance in the direction of it's angle,
 
 void button_done(edict_t* self)
 {
-	self->moveinfo.state = STATE_BOTTOM;
+	self->moveinfo->state = STATE_BOTTOM;
 	self->s.effects &= ~EF_ANIM23;
 	self->s.effects |= EF_ANIM01;
 }
 
 void button_return(edict_t* self)
 {
-	self->moveinfo.state = STATE_DOWN;
+	self->moveinfo->state = STATE_DOWN;
 
-	Move_Calc(self, self->moveinfo.start_origin, button_done);
+	Move_Calc(self, self->moveinfo->start_origin, button_done);
 
 	self->s.frame = 0;
 
@@ -715,28 +719,28 @@ void button_return(edict_t* self)
 
 void button_wait(edict_t* self)
 {
-	self->moveinfo.state = STATE_TOP;
+	self->moveinfo->state = STATE_TOP;
 	self->s.effects &= ~EF_ANIM01;
 	self->s.effects |= EF_ANIM23;
 
 	Edict_UseTargets(self, self->activator);
 	self->s.frame = 1;
-	if (self->moveinfo.wait >= 0)
+	if (self->moveinfo->wait >= 0)
 	{
-		self->nextthink = level.time + self->moveinfo.wait;
+		Edict_SetNextThink(self, level.time + self->moveinfo->wait);
 		self->think = button_return;
 	}
 }
 
 void button_fire(edict_t* self)
 {
-	if (self->moveinfo.state == STATE_UP || self->moveinfo.state == STATE_TOP)
+	if (self->moveinfo->state == STATE_UP || self->moveinfo->state == STATE_TOP)
 		return;
 
-	self->moveinfo.state = STATE_UP;
-	if (self->moveinfo.sound_start && !(self->flags & FL_TEAMSLAVE))
-		gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo.sound_start, 1, ATTN_STATIC, 0);
-	Move_Calc(self, self->moveinfo.end_origin, button_wait);
+	self->moveinfo->state = STATE_UP;
+	if (self->moveinfo->sound_start && !(self->flags & FL_TEAMSLAVE))
+		gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo->sound_start, 1, ATTN_STATIC, 0);
+	Move_Calc(self, self->moveinfo->end_origin, button_wait);
 }
 
 void button_use(edict_t* self, edict_t* other, edict_t* activator)
@@ -770,13 +774,15 @@ void SP_func_button(edict_t* ent)
 	vec3_t	abs_movedir;
 	float	dist;
 
+	Component_Add(ent, COMPONENT_MOVER);
+
 	Edict_SetMovedir(ent->s.angles, ent->movedir);
 	ent->movetype = MOVETYPE_STOP;
 	ent->solid = SOLID_BSP;
 	gi.setmodel(ent, ent->model);
 
 	if (ent->sounds != 1)
-		ent->moveinfo.sound_start = gi.soundindex("switches/butn2.wav");
+		ent->moveinfo->sound_start = gi.soundindex("switches/butn2.wav");
 
 	if (!ent->speed)
 		ent->speed = 40;
@@ -809,18 +815,18 @@ void SP_func_button(edict_t* ent)
 	else if (!ent->targetname)
 		ent->touch = button_touch;
 
-	ent->moveinfo.state = STATE_BOTTOM;
+	ent->moveinfo->state = STATE_BOTTOM;
 
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy3(ent->pos1, ent->moveinfo.start_origin);
-	VectorCopy3(ent->s.angles, ent->moveinfo.start_angles);
-	VectorCopy3(ent->pos2, ent->moveinfo.end_origin);
-	VectorCopy3(ent->s.angles, ent->moveinfo.end_angles);
+	ent->moveinfo->speed = ent->speed;
+	ent->moveinfo->accel = ent->accel;
+	ent->moveinfo->decel = ent->decel;
+	ent->moveinfo->wait = ent->wait;
+	VectorCopy3(ent->pos1, ent->moveinfo->start_origin);
+	VectorCopy3(ent->s.angles, ent->moveinfo->start_angles);
+	VectorCopy3(ent->pos2, ent->moveinfo->end_origin);
+	VectorCopy3(ent->s.angles, ent->moveinfo->end_angles);
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 /*
@@ -861,9 +867,9 @@ void door_use_areaportals(edict_t* self, bool open)
 	if (!self->target)
 		return;
 
-	while ((t = Game_FindEdictByValue(t, FOFS(targetname), self->target)))
+	while ((t = Edict_FindByTargetname(t, self->target)))
 	{
-		if (Q_stricmp(t->classname, "func_areaportal") == 0)
+		if (t->classid == CLASS_FUNC_AREAPORTAL)
 		{
 			gi.SetAreaPortalState(t->style, open);
 		}
@@ -876,17 +882,17 @@ void door_hit_top(edict_t* self)
 {
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_end)
-			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo.sound_end, 1, ATTN_STATIC, 0);
+		if (self->moveinfo->sound_end)
+			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo->sound_end, 1, ATTN_STATIC, 0);
 		self->s.sound = 0;
 	}
-	self->moveinfo.state = STATE_TOP;
+	self->moveinfo->state = STATE_TOP;
 	if (self->spawnflags & DOOR_TOGGLE)
 		return;
-	if (self->moveinfo.wait >= 0)
+	if (self->moveinfo->wait >= 0)
 	{
 		self->think = door_go_down;
-		self->nextthink = level.time + self->moveinfo.wait;
+		Edict_SetNextThink(self, level.time + self->moveinfo->wait);
 	}
 }
 
@@ -894,11 +900,11 @@ void door_hit_bottom(edict_t* self)
 {
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_end)
-			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo.sound_end, 1, ATTN_STATIC, 0);
+		if (self->moveinfo->sound_end)
+			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo->sound_end, 1, ATTN_STATIC, 0);
 		self->s.sound = 0;
 	}
-	self->moveinfo.state = STATE_BOTTOM;
+	self->moveinfo->state = STATE_BOTTOM;
 	door_use_areaportals(self, false);
 }
 
@@ -906,9 +912,9 @@ void door_go_down(edict_t* self)
 {
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_start)
-			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo.sound_start, 1, ATTN_STATIC, 0);
-		self->s.sound = self->moveinfo.sound_middle;
+		if (self->moveinfo->sound_start)
+			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo->sound_start, 1, ATTN_STATIC, 0);
+		self->s.sound = self->moveinfo->sound_middle;
 	}
 	if (self->max_health)
 	{
@@ -916,35 +922,35 @@ void door_go_down(edict_t* self)
 		self->health = self->max_health;
 	}
 
-	self->moveinfo.state = STATE_DOWN;
-	if (strcmp(self->classname, "func_door") == 0)
-		Move_Calc(self, self->moveinfo.start_origin, door_hit_bottom);
-	else if (strcmp(self->classname, "func_door_rotating") == 0)
+	self->moveinfo->state = STATE_DOWN;
+	if (self->classid == CLASS_FUNC_DOOR)
+		Move_Calc(self, self->moveinfo->start_origin, door_hit_bottom);
+	else if (self->classid == CLASS_FUNC_DOOR_ROTATING)
 		AngleMove_Calc(self, door_hit_bottom);
 }
 
 void door_go_up(edict_t* self, edict_t* activator)
 {
-	if (self->moveinfo.state == STATE_UP)
+	if (self->moveinfo->state == STATE_UP)
 		return;		// already going up
 
-	if (self->moveinfo.state == STATE_TOP)
+	if (self->moveinfo->state == STATE_TOP)
 	{	// reset top wait time
-		if (self->moveinfo.wait >= 0)
-			self->nextthink = level.time + self->moveinfo.wait;
+		if (self->moveinfo->wait >= 0)
+			Edict_SetNextThink(self, level.time + self->moveinfo->wait);
 		return;
 	}
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_start)
-			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo.sound_start, 1, ATTN_STATIC, 0);
-		self->s.sound = self->moveinfo.sound_middle;
+		if (self->moveinfo->sound_start)
+			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo->sound_start, 1, ATTN_STATIC, 0);
+		self->s.sound = self->moveinfo->sound_middle;
 	}
-	self->moveinfo.state = STATE_UP;
-	if (strcmp(self->classname, "func_door") == 0)
-		Move_Calc(self, self->moveinfo.end_origin, door_hit_top);
-	else if (strcmp(self->classname, "func_door_rotating") == 0)
+	self->moveinfo->state = STATE_UP;
+	if (self->classid == CLASS_FUNC_DOOR)
+		Move_Calc(self, self->moveinfo->end_origin, door_hit_top);
+	else if (self->classid == CLASS_FUNC_DOOR_ROTATING)
 		AngleMove_Calc(self, door_hit_top);
 
 	Edict_UseTargets(self, activator);
@@ -960,7 +966,7 @@ void door_use(edict_t* self, edict_t* other, edict_t* activator)
 
 	if (self->spawnflags & DOOR_TOGGLE)
 	{
-		if (self->moveinfo.state == STATE_UP || self->moveinfo.state == STATE_TOP)
+		if (self->moveinfo->state == STATE_UP || self->moveinfo->state == STATE_TOP)
 		{
 			// trigger all paired doors
 			for (ent = self; ent; ent = ent->teamchain)
@@ -1013,30 +1019,30 @@ void Think_CalcMoveSpeed(edict_t* self)
 		return;		// only the team master does this
 
 	// find the smallest distance any member of the team will be moving
-	min = fabsf(self->moveinfo.distance);
+	min = fabsf(self->moveinfo->distance);
 	for (ent = self->teamchain; ent; ent = ent->teamchain)
 	{
-		dist = fabsf(ent->moveinfo.distance);
+		dist = fabsf(ent->moveinfo->distance);
 		if (dist < min)
 			min = dist;
 	}
 
-	time = min / self->moveinfo.speed;
+	time = min / self->moveinfo->speed;
 
 	// adjust speeds so they will all complete at the same time
 	for (ent = self; ent; ent = ent->teamchain)
 	{
-		newspeed = fabsf(ent->moveinfo.distance) / time;
-		ratio = newspeed / ent->moveinfo.speed;
-		if (ent->moveinfo.accel == ent->moveinfo.speed)
-			ent->moveinfo.accel = newspeed;
+		newspeed = fabsf(ent->moveinfo->distance) / time;
+		ratio = newspeed / ent->moveinfo->speed;
+		if (ent->moveinfo->accel == ent->moveinfo->speed)
+			ent->moveinfo->accel = newspeed;
 		else
-			ent->moveinfo.accel *= ratio;
-		if (ent->moveinfo.decel == ent->moveinfo.speed)
-			ent->moveinfo.decel = newspeed;
+			ent->moveinfo->accel *= ratio;
+		if (ent->moveinfo->decel == ent->moveinfo->speed)
+			ent->moveinfo->decel = newspeed;
 		else
-			ent->moveinfo.decel *= ratio;
-		ent->moveinfo.speed = newspeed;
+			ent->moveinfo->decel *= ratio;
+		ent->moveinfo->speed = newspeed;
 	}
 }
 
@@ -1070,7 +1076,7 @@ void Think_SpawnDoorTrigger(edict_t* ent)
 	other->solid = SOLID_TRIGGER;
 	other->movetype = MOVETYPE_NONE;
 	other->touch = Touch_DoorTrigger;
-	gi.Edict_Link(other);
+	Edict_Link(other);
 
 	if (ent->spawnflags & DOOR_START_OPEN)
 		door_use_areaportals(ent, true);
@@ -1100,9 +1106,9 @@ void door_blocked(edict_t* self, edict_t* other)
 
 	// if a door has a negative wait, it would never come back if blocked,
 	// so let it just squash the object to death real fast
-	if (self->moveinfo.wait >= 0)
+	if (self->moveinfo->wait >= 0)
 	{
-		if (self->moveinfo.state == STATE_DOWN)
+		if (self->moveinfo->state == STATE_DOWN)
 		{
 			for (ent = self->teammaster; ent; ent = ent->teamchain)
 				door_go_up(ent, ent->activator);
@@ -1156,11 +1162,13 @@ void SP_func_door(edict_t* ent)
 {
 	vec3_t	abs_movedir;
 
+	Component_Add(ent, COMPONENT_MOVER);
+
 	if (ent->sounds != 1)
 	{
-		ent->moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-		ent->moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-		ent->moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+		ent->moveinfo->sound_start = gi.soundindex("doors/dr1_strt.wav");
+		ent->moveinfo->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+		ent->moveinfo->sound_end = gi.soundindex("doors/dr1_end.wav");
 	}
 
 	Edict_SetMovedir(ent->s.angles, ent->movedir);
@@ -1191,8 +1199,8 @@ void SP_func_door(edict_t* ent)
 	abs_movedir[0] = fabsf(ent->movedir[0]);
 	abs_movedir[1] = fabsf(ent->movedir[1]);
 	abs_movedir[2] = fabsf(ent->movedir[2]);
-	ent->moveinfo.distance = abs_movedir[0] * ent->size[0] + abs_movedir[1] * ent->size[1] + abs_movedir[2] * ent->size[2] - st.lip;
-	VectorMA3(ent->pos1, ent->moveinfo.distance, ent->movedir, ent->pos2);
+	ent->moveinfo->distance = abs_movedir[0] * ent->size[0] + abs_movedir[1] * ent->size[1] + abs_movedir[2] * ent->size[2] - st.lip;
+	VectorMA3(ent->pos1, ent->moveinfo->distance, ent->movedir, ent->pos2);
 
 	// if it starts open, switch the positions
 	if (ent->spawnflags & DOOR_START_OPEN)
@@ -1202,7 +1210,7 @@ void SP_func_door(edict_t* ent)
 		VectorCopy3(ent->s.origin, ent->pos1);
 	}
 
-	ent->moveinfo.state = STATE_BOTTOM;
+	ent->moveinfo->state = STATE_BOTTOM;
 
 	if (ent->health)
 	{
@@ -1216,14 +1224,14 @@ void SP_func_door(edict_t* ent)
 		ent->touch = door_touch;
 	}
 
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy3(ent->pos1, ent->moveinfo.start_origin);
-	VectorCopy3(ent->s.angles, ent->moveinfo.start_angles);
-	VectorCopy3(ent->pos2, ent->moveinfo.end_origin);
-	VectorCopy3(ent->s.angles, ent->moveinfo.end_angles);
+	ent->moveinfo->speed = ent->speed;
+	ent->moveinfo->accel = ent->accel;
+	ent->moveinfo->decel = ent->decel;
+	ent->moveinfo->wait = ent->wait;
+	VectorCopy3(ent->pos1, ent->moveinfo->start_origin);
+	VectorCopy3(ent->s.angles, ent->moveinfo->start_angles);
+	VectorCopy3(ent->pos2, ent->moveinfo->end_origin);
+	VectorCopy3(ent->s.angles, ent->moveinfo->end_angles);
 
 	if (ent->spawnflags & 16)
 		ent->s.effects |= EF_ANIM_ALL;
@@ -1234,9 +1242,9 @@ void SP_func_door(edict_t* ent)
 	if (!ent->team)
 		ent->teammaster = ent;
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 
-	ent->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(ent, level.time + TICK_TIME);
 	if (ent->health || ent->targetname)
 		ent->think = Think_CalcMoveSpeed;
 	else
@@ -1275,6 +1283,8 @@ REVERSE will cause the door to rotate in the opposite direction.
 
 void SP_func_door_rotating(edict_t* ent)
 {
+	Component_Add(ent, COMPONENT_MOVER);
+
 	VectorClear3(ent->s.angles);
 
 	// set the axis of rotation
@@ -1298,7 +1308,7 @@ void SP_func_door_rotating(edict_t* ent)
 
 	VectorCopy3(ent->s.angles, ent->pos1);
 	VectorMA3(ent->s.angles, st.distance, ent->movedir, ent->pos2);
-	ent->moveinfo.distance = st.distance;
+	ent->moveinfo->distance = st.distance;
 
 	ent->movetype = MOVETYPE_PUSH;
 	ent->solid = SOLID_BSP;
@@ -1321,9 +1331,9 @@ void SP_func_door_rotating(edict_t* ent)
 
 	if (ent->sounds != 1)
 	{
-		ent->moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-		ent->moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-		ent->moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+		ent->moveinfo->sound_start = gi.soundindex("doors/dr1_strt.wav");
+		ent->moveinfo->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+		ent->moveinfo->sound_end = gi.soundindex("doors/dr1_end.wav");
 	}
 
 	// if it starts open, switch the positions
@@ -1348,15 +1358,15 @@ void SP_func_door_rotating(edict_t* ent)
 		ent->touch = door_touch;
 	}
 
-	ent->moveinfo.state = STATE_BOTTOM;
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy3(ent->s.origin, ent->moveinfo.start_origin);
-	VectorCopy3(ent->pos1, ent->moveinfo.start_angles);
-	VectorCopy3(ent->s.origin, ent->moveinfo.end_origin);
-	VectorCopy3(ent->pos2, ent->moveinfo.end_angles);
+	ent->moveinfo->state = STATE_BOTTOM;
+	ent->moveinfo->speed = ent->speed;
+	ent->moveinfo->accel = ent->accel;
+	ent->moveinfo->decel = ent->decel;
+	ent->moveinfo->wait = ent->wait;
+	VectorCopy3(ent->s.origin, ent->moveinfo->start_origin);
+	VectorCopy3(ent->pos1, ent->moveinfo->start_angles);
+	VectorCopy3(ent->s.origin, ent->moveinfo->end_origin);
+	VectorCopy3(ent->pos2, ent->moveinfo->end_angles);
 
 	if (ent->spawnflags & 16)
 		ent->s.effects |= EF_ANIM_ALL;
@@ -1365,9 +1375,9 @@ void SP_func_door_rotating(edict_t* ent)
 	if (!ent->team)
 		ent->teammaster = ent;
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 
-	ent->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(ent, level.time + TICK_TIME);
 	if (ent->health || ent->targetname)
 		ent->think = Think_CalcMoveSpeed;
 	else
@@ -1394,6 +1404,8 @@ void SP_func_water(edict_t* self)
 {
 	vec3_t	abs_movedir;
 
+	Component_Add(self, COMPONENT_MOVER);
+
 	Edict_SetMovedir(self->s.angles, self->movedir);
 	self->movetype = MOVETYPE_PUSH;
 	self->solid = SOLID_BSP;
@@ -1405,13 +1417,13 @@ void SP_func_water(edict_t* self)
 		break;
 
 	case 1: // water
-		self->moveinfo.sound_start = gi.soundindex("world/mov_watr.wav");
-		self->moveinfo.sound_end = gi.soundindex("world/stp_watr.wav");
+		self->moveinfo->sound_start = gi.soundindex("world/mov_watr.wav");
+		self->moveinfo->sound_end = gi.soundindex("world/stp_watr.wav");
 		break;
 
 	case 2: // lava
-		self->moveinfo.sound_start = gi.soundindex("world/mov_watr.wav");
-		self->moveinfo.sound_end = gi.soundindex("world/stp_watr.wav");
+		self->moveinfo->sound_start = gi.soundindex("world/mov_watr.wav");
+		self->moveinfo->sound_end = gi.soundindex("world/stp_watr.wav");
 		break;
 	}
 
@@ -1420,8 +1432,8 @@ void SP_func_water(edict_t* self)
 	abs_movedir[0] = fabsf(self->movedir[0]);
 	abs_movedir[1] = fabsf(self->movedir[1]);
 	abs_movedir[2] = fabsf(self->movedir[2]);
-	self->moveinfo.distance = abs_movedir[0] * self->size[0] + abs_movedir[1] * self->size[1] + abs_movedir[2] * self->size[2] - st.lip;
-	VectorMA3(self->pos1, self->moveinfo.distance, self->movedir, self->pos2);
+	self->moveinfo->distance = abs_movedir[0] * self->size[0] + abs_movedir[1] * self->size[1] + abs_movedir[2] * self->size[2] - st.lip;
+	VectorMA3(self->pos1, self->moveinfo->distance, self->movedir, self->pos2);
 
 	// if it starts open, switch the positions
 	if (self->spawnflags & DOOR_START_OPEN)
@@ -1431,29 +1443,29 @@ void SP_func_water(edict_t* self)
 		VectorCopy3(self->s.origin, self->pos1);
 	}
 
-	VectorCopy3(self->pos1, self->moveinfo.start_origin);
-	VectorCopy3(self->s.angles, self->moveinfo.start_angles);
-	VectorCopy3(self->pos2, self->moveinfo.end_origin);
-	VectorCopy3(self->s.angles, self->moveinfo.end_angles);
+	VectorCopy3(self->pos1, self->moveinfo->start_origin);
+	VectorCopy3(self->s.angles, self->moveinfo->start_angles);
+	VectorCopy3(self->pos2, self->moveinfo->end_origin);
+	VectorCopy3(self->s.angles, self->moveinfo->end_angles);
 
-	self->moveinfo.state = STATE_BOTTOM;
+	self->moveinfo->state = STATE_BOTTOM;
 
 	if (!self->speed)
 		self->speed = 25;
-	self->moveinfo.accel = self->moveinfo.decel = self->moveinfo.speed = self->speed;
+	self->moveinfo->accel = self->moveinfo->decel = self->moveinfo->speed = self->speed;
 
 	if (!self->wait)
 		self->wait = -1;
-	self->moveinfo.wait = self->wait;
+	self->moveinfo->wait = self->wait;
 
 	self->use = door_use;
 
 	if (self->wait == -1)
 		self->spawnflags |= DOOR_TOGGLE;
 
-	self->classname = "func_door";
+	Edict_SetClassname(self, "func_door");
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 
@@ -1512,11 +1524,11 @@ void train_wait(edict_t* self)
 			return;
 	}
 
-	if (self->moveinfo.wait)
+	if (self->moveinfo->wait)
 	{
-		if (self->moveinfo.wait > 0)
+		if (self->moveinfo->wait > 0)
 		{
-			self->nextthink = level.time + self->moveinfo.wait;
+			Edict_SetNextThink(self, level.time + self->moveinfo->wait);
 			self->think = train_next;
 		}
 		else if (self->spawnflags & TRAIN_TOGGLE)  // && wait < 0
@@ -1524,13 +1536,13 @@ void train_wait(edict_t* self)
 			train_next(self);
 			self->spawnflags &= ~TRAIN_START_ON;
 			VectorClear3(self->velocity);
-			self->nextthink = 0;
+			Edict_SetNextThink(self, 0);
 		}
 
 		if (!(self->flags & FL_TEAMSLAVE))
 		{
-			if (self->moveinfo.sound_end)
-				gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo.sound_end, 1, ATTN_STATIC, 0);
+			if (self->moveinfo->sound_end)
+				gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo->sound_end, 1, ATTN_STATIC, 0);
 			self->s.sound = 0;
 		}
 	}
@@ -1582,24 +1594,24 @@ again:
 		VectorSubtract3(ent->s.origin, self->mins, self->s.origin);
 		VectorCopy3(self->s.origin, self->s.old_origin);
 		self->s.event = EV_OTHER_TELEPORT;
-		gi.Edict_Link(self);
+		Edict_Link(self);
 		goto again;
 	}
 
-	self->moveinfo.wait = ent->wait;
+	self->moveinfo->wait = ent->wait;
 	self->target_ent = ent;
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_start)
-			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo.sound_start, 1, ATTN_STATIC, 0);
-		self->s.sound = self->moveinfo.sound_middle;
+		if (self->moveinfo->sound_start)
+			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo->sound_start, 1, ATTN_STATIC, 0);
+		self->s.sound = self->moveinfo->sound_middle;
 	}
 
 	VectorSubtract3(ent->s.origin, self->mins, dest);
-	self->moveinfo.state = STATE_TOP;
-	VectorCopy3(self->s.origin, self->moveinfo.start_origin);
-	VectorCopy3(dest, self->moveinfo.end_origin);
+	self->moveinfo->state = STATE_TOP;
+	VectorCopy3(self->s.origin, self->moveinfo->start_origin);
+	VectorCopy3(dest, self->moveinfo->end_origin);
 	Move_Calc(self, dest, train_wait);
 	self->spawnflags |= TRAIN_START_ON;
 }
@@ -1612,9 +1624,9 @@ void train_resume(edict_t* self)
 	ent = self->target_ent;
 
 	VectorSubtract3(ent->s.origin, self->mins, dest);
-	self->moveinfo.state = STATE_TOP;
-	VectorCopy3(self->s.origin, self->moveinfo.start_origin);
-	VectorCopy3(dest, self->moveinfo.end_origin);
+	self->moveinfo->state = STATE_TOP;
+	VectorCopy3(self->s.origin, self->moveinfo->start_origin);
+	VectorCopy3(dest, self->moveinfo->end_origin);
 	Move_Calc(self, dest, train_wait);
 	self->spawnflags |= TRAIN_START_ON;
 }
@@ -1637,7 +1649,7 @@ void func_train_find(edict_t* self)
 	self->target = ent->target;
 
 	VectorSubtract3(ent->s.origin, self->mins, self->s.origin);
-	gi.Edict_Link(self);
+	Edict_Link(self);
 
 	// if not triggered, start immediately
 	if (!self->targetname)
@@ -1645,7 +1657,7 @@ void func_train_find(edict_t* self)
 
 	if (self->spawnflags & TRAIN_START_ON)
 	{
-		self->nextthink = level.time + TICK_TIME;
+		Edict_SetNextThink(self, level.time + TICK_TIME);
 		self->think = train_next;
 		self->activator = self;
 	}
@@ -1661,7 +1673,7 @@ void train_use(edict_t* self, edict_t* other, edict_t* activator)
 			return;
 		self->spawnflags &= ~TRAIN_START_ON;
 		VectorClear3(self->velocity);
-		self->nextthink = 0;
+		Edict_SetNextThink(self, 0);
 	}
 	else
 	{
@@ -1674,6 +1686,8 @@ void train_use(edict_t* self, edict_t* other, edict_t* activator)
 
 void SP_func_train(edict_t* self)
 {
+	Component_Add(self, COMPONENT_MOVER);
+
 	self->movetype = MOVETYPE_PUSH;
 
 	VectorClear3(self->s.angles);
@@ -1689,23 +1703,23 @@ void SP_func_train(edict_t* self)
 	gi.setmodel(self, self->model);
 
 	if (st.noise)
-		self->moveinfo.sound_middle = gi.soundindex(st.noise);
+		self->moveinfo->sound_middle = gi.soundindex(st.noise);
 
 	if (!self->speed)
 		self->speed = 100;
 
-	self->moveinfo.speed = self->speed;
-	self->moveinfo.accel = self->moveinfo.decel = self->moveinfo.speed;
+	self->moveinfo->speed = self->speed;
+	self->moveinfo->accel = self->moveinfo->decel = self->moveinfo->speed;
 
 	self->use = train_use;
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 
 	if (self->target)
 	{
 		// start trains on the second frame, to make sure their targets have had
 		// a chance to spawn
-		self->nextthink = level.time + TICK_TIME;
+		Edict_SetNextThink(self, level.time + TICK_TIME);
 		self->think = func_train_find;
 	}
 	else
@@ -1756,7 +1770,7 @@ void trigger_elevator_init(edict_t* self)
 		gi.dprintf("trigger_elevator unable to find target %s\n", self->target);
 		return;
 	}
-	if (strcmp(self->movetarget->classname, "func_train") != 0)
+	if (self->movetarget->classid != CLASS_FUNC_TRAIN)
 	{
 		gi.dprintf("trigger_elevator target %s is not a train\n", self->target);
 		return;
@@ -1770,7 +1784,7 @@ void trigger_elevator_init(edict_t* self)
 void SP_trigger_elevator(edict_t* self)
 {
 	self->think = trigger_elevator_init;
-	self->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(self, level.time + TICK_TIME);
 }
 
 
@@ -1791,7 +1805,7 @@ These can used but not touched.
 void func_timer_think(edict_t* self)
 {
 	Edict_UseTargets(self, self->activator);
-	self->nextthink = level.time + self->wait + crandom() * self->random;
+	Edict_SetNextThink(self, level.time + self->wait + crandom() * self->random);
 }
 
 void func_timer_use(edict_t* self, edict_t* other, edict_t* activator)
@@ -1801,13 +1815,13 @@ void func_timer_use(edict_t* self, edict_t* other, edict_t* activator)
 	// if on, turn it off
 	if (self->nextthink)
 	{
-		self->nextthink = 0;
+		Edict_SetNextThink(self, 0);
 		return;
 	}
 
 	// turn it on
 	if (self->delay)
-		self->nextthink = level.time + self->delay;
+		Edict_SetNextThink(self, level.time + self->delay);
 	else
 		func_timer_think(self);
 }
@@ -1828,7 +1842,7 @@ void SP_func_timer(edict_t* self)
 
 	if (self->spawnflags & 1)
 	{
-		self->nextthink = level.time + 1.0f + st.pausetime + self->delay + self->wait + crandom() * self->random;
+		Edict_SetNextThink(self, level.time + 1.0f + st.pausetime + self->delay + self->wait + crandom() * self->random);
 		self->activator = self;
 	}
 
@@ -1874,7 +1888,7 @@ void SP_func_conveyor(edict_t* self)
 
 	gi.setmodel(self, self->model);
 	self->solid = SOLID_BSP;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 
@@ -1915,7 +1929,7 @@ void door_secret_use(edict_t* self, edict_t* other, edict_t* activator)
 
 void door_secret_move1(edict_t* self)
 {
-	self->nextthink = level.time + 1.0f;
+	Edict_SetNextThink(self, level.time + 1.0f);
 	self->think = door_secret_move2;
 }
 
@@ -1928,7 +1942,7 @@ void door_secret_move3(edict_t* self)
 {
 	if (self->wait == -1)
 		return;
-	self->nextthink = level.time + self->wait;
+	Edict_SetNextThink(self, level.time + self->wait);
 	self->think = door_secret_move4;
 }
 
@@ -1939,7 +1953,7 @@ void door_secret_move4(edict_t* self)
 
 void door_secret_move5(edict_t* self)
 {
-	self->nextthink = level.time + 1.0f;
+	Edict_SetNextThink(self, level.time + 1.0f);
 	self->think = door_secret_move6;
 }
 
@@ -1990,9 +2004,11 @@ void SP_func_door_secret(edict_t* ent)
 	float	width;
 	float	length;
 
-	ent->moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-	ent->moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-	ent->moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+	Component_Add(ent, COMPONENT_MOVER);
+
+	ent->moveinfo->sound_start = gi.soundindex("doors/dr1_strt.wav");
+	ent->moveinfo->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+	ent->moveinfo->sound_end = gi.soundindex("doors/dr1_end.wav");
 
 	ent->movetype = MOVETYPE_PUSH;
 	ent->solid = SOLID_BSP;
@@ -2014,7 +2030,7 @@ void SP_func_door_secret(edict_t* ent)
 	if (!ent->wait)
 		ent->wait = 5;
 
-	ent->moveinfo.accel = ent->moveinfo.decel = ent->moveinfo.speed = 50;
+	ent->moveinfo->accel = ent->moveinfo->decel = ent->moveinfo->speed = 50;
 
 	// calculate positions
 	AngleVectors(ent->s.angles, forward, right, up);
@@ -2047,9 +2063,9 @@ void SP_func_door_secret(edict_t* ent)
 		ent->touch = door_touch;
 	}
 
-	ent->classname = "func_door";
+	Edict_SetClassname(ent, "func_door");
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 
@@ -2092,11 +2108,12 @@ void func_trampoline_use(edict_t* self, edict_t* other, cplane_t* plane, csurfac
 	}
 
 	other->velocity[2] += self->jump_height;
+	Edict_Wake(other);
 }
 
 void SP_func_trampoline(edict_t* ent)
 {
-	ent->classname = "func_trampoline";
+	Edict_SetClassname(ent, "func_trampoline");
 	ent->touch = func_trampoline_use;
 
 	ent->movetype = MOVETYPE_PUSH;
@@ -2104,7 +2121,7 @@ void SP_func_trampoline(edict_t* ent)
 	// set model to worldmodel
 	gi.setmodel(ent, ent->model);
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 #define PARTICLE_EFFECT_START_OFF	1
@@ -2116,49 +2133,49 @@ void func_particle_effect_think(edict_t* self)
 	float particles_per_tick = 0;
 
 	// don't despawn in case you want to reactivate it later (e.g. activating particle effect with a button)
-	if (!(self->spawnflags & 2) && (level.time - self->timestamp) > self->particle_lifetime)
+	if (!(self->spawnflags & 2) && (level.time - self->timestamp) > self->particles->lifetime)
 		return;
 
 	//TODO: Targetname
 	if (self->spawnflags & 1)
 	{
-		self->nextthink = level.time + self->wait;
+		Edict_SetNextThink(self, level.time + self->wait);
 		self->spawnflags &= ~1;
 		return;
 	}
 
 	// get rid of the start off spawnflag, since we finished raitng
-	self->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(self, level.time + TICK_TIME);
 
 	// if it's lower than the tickrate, don't spawn an entity until we hit that tickrate
-	if (self->particle_rate < sv_tickrate->value)
+	if (self->particles->rate < sv_tickrate->value)
 	{
-		if (level.framenum % self->particle_rate != 0)
+		if (level.framenum % self->particles->rate != 0)
 			return;
 		else
 			particles_per_tick = 1;
 	}
 	else // per tick
 	{
-		if (self->particles_next_frame == 0)
+		if (self->particles->next_frame == 0)
 		{
-			float particles_per_tick = (self->particle_rate) / sv_tickrate->value;
+			float particles_per_tick = (self->particles->rate) / sv_tickrate->value;
 			float rounded = roundf(particles_per_tick);
 
 			// we rounded down
 			if (rounded == floorf(particles_per_tick))
 			{
-				self->particles_next_frame = ceilf(particles_per_tick);
+				self->particles->next_frame = ceilf(particles_per_tick);
 			}
 			else if (rounded == ceilf(particles_per_tick)) // we rounded up
 			{
-				self->particles_next_frame = floorf(particles_per_tick);
+				self->particles->next_frame = floorf(particles_per_tick);
 			}
 		}
 		else
 		{
-			particles_per_tick = (float)self->particles_next_frame;
-			self->particles_next_frame = 0;
+			particles_per_tick = (float)self->particles->next_frame;
+			self->particles->next_frame = 0;
 		}
 	}
 
@@ -2167,22 +2184,22 @@ void func_particle_effect_think(edict_t* self)
 	{
 		// tell the client to spawn a tempent and also the type
 		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(self->particle_effect);
+		gi.WriteByte(self->particles->effect);
 
 		// send our tempent info
-		switch (self->particle_effect)
+		switch (self->particles->effect)
 		{
 			// Generic tempent
 		case TE_GENERIC:
 			gi.WritePos(self->s.origin);
 			gi.WriteDir(self->s.angles);
-			gi.WriteColor(self->color);
+			gi.WriteColor(self->particles->color);
 			gi.WriteInt(self->count);
-			gi.WritePos(self->color_run);
-			gi.WriteInt(self->angles_spread);
+			gi.WritePos(self->particles->color_run);
+			gi.WriteInt(self->particles->angles_spread);
 			gi.WritePos(self->velocity);
-			gi.WriteInt(self->particle_lifetime);
-			gi.WriteFloat(self->alphavel);
+			gi.WriteInt(self->particles->lifetime);
+			gi.WriteFloat(self->particles->alphavel);
 			break;
 			// Tempents that only send a position
 		case TE_EXPLOSION1:
@@ -2230,21 +2247,21 @@ void func_particle_effect_think(edict_t* self)
 			gi.WriteShort(self->count);
 			gi.WritePos(self->s.origin);
 			gi.WriteDir(self->s.angles);
-			gi.WriteColor(self->color);
+			gi.WriteColor(self->particles->color);
 			break;
 		case TE_FLASH:
 			gi.WriteShort(self - g_edicts);
 			gi.WritePos(self->s.origin);
 			gi.WritePos(self->count);
-			gi.WriteColor(self->color);
+			gi.WriteColor(self->particles->color);
 			break;
 		case TE_SMOKE:
 		case TE_STEAM:
 			gi.WritePos(self->s.origin);
 			gi.WriteDir(self->s.angles);
-			gi.WriteColor(self->color);
+			gi.WriteColor(self->particles->color);
 			gi.WriteInt(self->count);
-			gi.WriteInt(self->particle_magnitude);
+			gi.WriteInt(self->particles->magnitude);
 			break;
 		}
 	}
@@ -2253,9 +2270,11 @@ void func_particle_effect_think(edict_t* self)
 
 void SP_func_particle_effect(edict_t* ent)
 {
-	ent->classname = "func_particle_effect";
+	Component_Add(ent, COMPONENT_PARTICLES);
+
+	Edict_SetClassname(ent, "func_particle_effect");
 	ent->think = func_particle_effect_think;
-	ent->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(ent, level.time + TICK_TIME);
 	ent->timestamp = level.time;
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
\ No newline at end of file
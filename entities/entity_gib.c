@@ -0,0 +1,221 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// entity_gib.c : Gib and debris pool
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+GIB POOL
+
+==============================================================================
+
+ThrowGib and ThrowDebris used to take a new edict for every piece, so killing
+a crowd could fill up maxentities with gore. They now go through
+GibPool_Spawn, which keeps at most sv_maxgibs of them alive. When the pool is
+full the oldest piece is recycled in place for the new one, and no more than
+GIB_POOL_FRAME_BUDGET pieces are thrown in one frame; the rest are dropped.
+Gore never takes the last GIB_POOL_EDICT_RESERVE free edicts, it recycles the
+oldest piece instead, or is dropped if there isn't one.
+
+Pooled edicts are kept on a list from oldest to newest through gib_prev and
+gib_next, and moved by SV_Physics_Gib instead of SV_Physics_Toss.
+sv_maxgibs 0 turns gore off.
+*/
+
+#define GIB_POOL_FRAME_BUDGET	32		// pieces thrown a frame at most
+#define GIB_POOL_EDICT_RESERVE	64		// free edicts gore leaves for everything else
+
+typedef struct gib_pool_stats_s
+{
+	int32_t		spawned;
+	int32_t		recycled;		// oldest piece reused because the pool was full
+	int32_t		dropped;		// over the frame budget, out of edicts or gore is off
+} gib_pool_stats_t;
+
+static edict_t*			gib_pool_oldest;
+static edict_t*			gib_pool_newest;
+static int32_t			gib_pool_count;
+
+static int32_t			gib_pool_frame;			// level.framenum frame_spawns counts
+static int32_t			gib_pool_frame_spawns;
+
+static gib_pool_stats_t	gib_pool_stats;
+
+static void GibPool_Append(edict_t* ent)
+{
+	ent->gib_pooled = true;
+	ent->gib_prev = gib_pool_newest;
+	ent->gib_next = NULL;
+
+	if (gib_pool_newest)
+		gib_pool_newest->gib_next = ent;
+	else
+		gib_pool_oldest = ent;
+
+	gib_pool_newest = ent;
+	gib_pool_count++;
+}
+
+/*
+=============
+GibPool_Remove
+
+Takes ent off the pool, called whenever an edict is freed or recycled
+=============
+*/
+void GibPool_Remove(edict_t* ent)
+{
+	if (!ent->gib_pooled)
+		return;
+
+	if (ent->gib_prev)
+		ent->gib_prev->gib_next = ent->gib_next;
+	else
+		gib_pool_oldest = ent->gib_next;
+
+	if (ent->gib_next)
+		ent->gib_next->gib_prev = ent->gib_prev;
+	else
+		gib_pool_newest = ent->gib_prev;
+
+	ent->gib_pooled = false;
+	ent->gib_prev = ent->gib_next = NULL;
+	gib_pool_count--;
+}
+
+/*
+=============
+GibPool_Clear
+
+Empties the pool, called when the edicts are wiped for a new level
+=============
+*/
+void GibPool_Clear()
+{
+	gib_pool_oldest = gib_pool_newest = NULL;
+	gib_pool_count = 0;
+	gib_pool_frame_spawns = 0;
+}
+
+/*
+=============
+GibPool_Rebuild
+
+Relinks the pool after a level load, the saved links are meaningless. The
+order they were thrown in is lost, so the lowest edict counts as oldest.
+=============
+*/
+void GibPool_Rebuild()
+{
+	edict_t*	ent;
+	int32_t		i;
+
+	GibPool_Clear();
+
+	for (i = 0, ent = g_edicts; i < globals.num_edicts; i++, ent++)
+	{
+		if (!ent->gib_pooled)
+			continue;
+
+		ent->gib_pooled = false;
+
+		if (ent->inuse)
+			GibPool_Append(ent);
+	}
+}
+
+/*
+=============
+GibPool_Spawn
+
+Returns a blank edict for a gib or piece of debris, or NULL if it shouldn't
+be thrown. The caller has to set s.origin before linking it.
+=============
+*/
+edict_t* GibPool_Spawn()
+{
+	edict_t*	ent;
+	bool		recycled;
+
+	if (gib_pool_frame != level.framenum)
+	{
+		gib_pool_frame = level.framenum;
+		gib_pool_frame_spawns = 0;
+	}
+
+	// sv_maxgibs may have been turned down
+	while (gib_pool_count > sv_maxgibs->value
+		&& gib_pool_oldest)
+		Edict_Free(gib_pool_oldest);
+
+	if (sv_maxgibs->value <= 0
+		|| gib_pool_frame_spawns >= GIB_POOL_FRAME_BUDGET)
+	{
+		gib_pool_stats.dropped++;
+		return NULL;
+	}
+
+	// full, or the edicts are running low, take the oldest
+	ent = NULL;
+	recycled = false;
+
+	if (gib_pool_count >= sv_maxgibs->value)
+		recycled = true;
+	else if (!(ent = Edict_TrySpawn(GIB_POOL_EDICT_RESERVE)))
+		recycled = (gib_pool_oldest != NULL);
+
+	if (recycled)
+	{
+		ent = Edict_Recycle(gib_pool_oldest);
+
+		// don't let clients lerp it over from where it was
+		ent->s.event = EV_OTHER_TELEPORT;
+		gib_pool_stats.recycled++;
+	}
+
+	if (!ent)
+	{
+		gib_pool_stats.dropped++;
+		return NULL;
+	}
+
+	GibPool_Append(ent);
+	gib_pool_frame_spawns++;
+	gib_pool_stats.spawned++;
+	return ent;
+}
+
+/*
+=============
+GibPool_PrintStats
+
+Prints the pool for sv stats
+=============
+*/
+void GibPool_PrintStats()
+{
+	gi.cprintf(NULL, PRINT_HIGH, "Gibs:\n");
+	gi.cprintf(NULL, PRINT_HIGH, "  live        %5i of %g\n", gib_pool_count, sv_maxgibs->value);
+	gi.cprintf(NULL, PRINT_HIGH, "  thrown      %5i (%i recycled, %i dropped)\n",
+		gib_pool_stats.spawned, gib_pool_stats.recycled, gib_pool_stats.dropped);
+}
@@ -48,6 +48,9 @@ gitem_armor_t bodyarmor_info = { 100, 200, .80, .60, ARMOR_BODY };
 void Use_Quad(edict_t* ent, gitem_t* item);
 static int32_t quad_drop_timeout_hack;
 
+perfect_hash_t	item_classname_hash;
+perfect_hash_t	item_pickup_hash;
+
 //======================================================================
 
 
@@ -59,17 +62,16 @@ FindItemByClassname
 */
 gitem_t* Item_FindByClassname(char* classname)
 {
-	int32_t i;
-	gitem_t* it;
+	int32_t index;
 
-	it = itemlist;
-	for (i = 0; i < game.num_items; i++, it++)
-	{
-		if (!it->classname)
-			continue;
-		if (!Q_stricmp(it->classname, classname))
-			return it;
-	}
+	if (!classname)
+		return NULL;
+
+	index = PerfectHash_Find(&item_classname_hash, classname);
+
+	if (index >= 0
+		&& !Q_stricmp(itemlist[index].classname, classname))
+		return &itemlist[index];
 
 	return NULL;
 }
@@ -82,20 +84,16 @@ FindItem
 */
 gitem_t* Item_FindByPickupName(char* pickup_name)
 {
+	int32_t index;
+
 	if (!pickup_name)
 		return NULL;
 
-	int32_t	i;
-	gitem_t* it;
+	index = PerfectHash_Find(&item_pickup_hash, pickup_name);
 
-	it = itemlist;
-	for (i = 0; i < game.num_items; i++, it++)
-	{
-		if (!it->pickup_name)
-			continue;
-		if (!Q_stricmp(it->pickup_name, pickup_name))
-			return it;
-	}
+	if (index >= 0
+		&& !Q_stricmp(itemlist[index].pickup_name, pickup_name))
+		return &itemlist[index];
 
 	return NULL;
 }
@@ -123,7 +121,7 @@ void DoRespawn(edict_t* ent)
 
 	ent->svflags &= ~SVF_NOCLIENT;
 	ent->solid = SOLID_TRIGGER;
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 
 	// send an effect
 	ent->s.event = EV_ITEM_RESPAWN;
@@ -134,9 +132,9 @@ void Item_SetRespawn(edict_t* ent, float delay)
 	ent->flags |= FL_RESPAWN;
 	ent->svflags |= SVF_NOCLIENT;
 	ent->solid = SOLID_NOT;
-	ent->nextthink = level.time + delay;
+	Edict_SetNextThink(ent, level.time + delay);
 	ent->think = DoRespawn;
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 
@@ -144,7 +142,7 @@ void Item_SetRespawn(edict_t* ent, float delay)
 
 bool Pickup_Powerup(edict_t* ent, edict_t* other)
 {
-	loadout_entry_t* loadout_entry = Loadout_GetItem(other, ent->item->pickup_name);
+	gloadout_entry_t* loadout_entry = Loadout_FindItem(other, ent->item);
 
 	// if it's not there add it
 	if (!loadout_entry)
@@ -172,7 +170,7 @@ bool Pickup_Powerup(edict_t* ent, edict_t* other)
 
 void Drop_General(edict_t* ent, gitem_t* item)
 {
-	loadout_entry_t* loadout_entry = Loadout_GetItem(ent, item->pickup_name);
+	gloadout_entry_t* loadout_entry = Loadout_FindItem(ent, item);
 
 	Item_Drop(ent, item);
 
@@ -205,7 +203,7 @@ bool Pickup_Adrenaline(edict_t* ent, edict_t* other)
 bool Pickup_Bandolier(edict_t* ent, edict_t* other)
 {
 	gitem_t* item = Item_FindByPickupName("Bullets");
-	loadout_entry_t* loadout_item = Loadout_GetItem(ent, "Bullets");
+	gloadout_entry_t* loadout_item = Loadout_GetItem(ent, "Bullets");
 
 	if (other->client->pers.max_bullets < 250)
 		other->client->pers.max_bullets = 250;
@@ -241,7 +239,7 @@ bool Pickup_Bandolier(edict_t* ent, edict_t* other)
 bool Pickup_Pack(edict_t* ent, edict_t* other)
 {
 	gitem_t* item = Item_FindByPickupName("Bullets");
-	loadout_entry_t* loadout_item_ptr = Loadout_GetItem(other, "Bullets");
+	gloadout_entry_t* loadout_item_ptr = Loadout_GetItem(other, "Bullets");
 
 	// quantity is later
 	if (!loadout_item_ptr)
@@ -320,7 +318,7 @@ void Use_Quad(edict_t* ent, gitem_t* item)
 {
 	int		timeout;
 
-	loadout_entry_t* entry_ptr = Loadout_GetItem(ent, "Quad Damage");
+	gloadout_entry_t* entry_ptr = Loadout_GetItem(ent, "Quad Damage");
 	entry_ptr->amount--;
 
 	if (quad_drop_timeout_hack)
@@ -345,7 +343,7 @@ void Use_Quad(edict_t* ent, gitem_t* item)
 
 void Use_Breather(edict_t* ent, gitem_t* item)
 {
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, item->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(ent, item);
 	loadout_entry_ptr->amount--;
 
 	if (ent->client->breather_framenum > level.framenum)
@@ -358,7 +356,7 @@ void Use_Breather(edict_t* ent, gitem_t* item)
 
 void Use_Envirosuit(edict_t* ent, gitem_t* item)
 {
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, item->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(ent, item);
 	loadout_entry_ptr->amount--;
 
 	if (ent->client->enviro_framenum > level.framenum)
@@ -371,7 +369,7 @@ void Use_Envirosuit(edict_t* ent, gitem_t* item)
 
 void	Use_Invulnerability(edict_t* ent, gitem_t* item)
 {
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, item->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(ent, item);
 	loadout_entry_ptr->amount--;
 
 	if (ent->client->invincible_framenum > level.framenum)
@@ -386,7 +384,7 @@ void	Use_Invulnerability(edict_t* ent, gitem_t* item)
 
 void Use_Silencer(edict_t* ent, gitem_t* item)
 {
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, item->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(ent, item);
 	loadout_entry_ptr->amount--;
 	ent->client->silencer_shots += 30;
 }
@@ -398,7 +396,7 @@ bool Ammo_Add(edict_t* ent, gitem_t* item, int32_t count)
 	int32_t		index;
 	int32_t		max;
 
-	loadout_entry_t* ammo_ptr = Loadout_GetItem(ent, item->pickup_name);
+	gloadout_entry_t* ammo_ptr = Loadout_FindItem(ent, item);
 
 	if (ammo_ptr == NULL)
 		ammo_ptr = Loadout_AddItem(ent, item->pickup_name, item->icon, loadout_entry_type_ammo, 0); // amount is added later
@@ -436,7 +434,7 @@ bool Ammo_Add(edict_t* ent, gitem_t* item, int32_t count)
 
 bool Pickup_Ammo(edict_t* ent, edict_t* other)
 {
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(other, ent->item->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(other, ent->item);
 	int32_t	oldcount;
 	int32_t	count;
 	bool	weapon;
@@ -476,7 +474,7 @@ void Drop_Ammo(edict_t* ent, gitem_t* item)
 {
 	edict_t* dropped;
 
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, item->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(ent, item);
 
 	dropped = Item_Drop(ent, item);
 	if (loadout_entry_ptr->amount >= item->quantity)
@@ -514,7 +512,7 @@ void MegaHealth_think(edict_t* self)
 {
 	if (self->owner->health > self->owner->max_health)
 	{
-		self->nextthink = level.time + 1;
+		Edict_SetNextThink(self, level.time + 1);
 		self->owner->health -= 1;
 		return;
 	}
@@ -542,7 +540,7 @@ bool Pickup_Health(edict_t* ent, edict_t* other)
 	if (ent->style & HEALTH_TIMED)
 	{
 		ent->think = MegaHealth_think;
-		ent->nextthink = level.time + 5;
+		Edict_SetNextThink(ent, level.time + 5);
 		ent->owner = other;
 		ent->flags |= FL_RESPAWN;
 		ent->svflags |= SVF_NOCLIENT;
@@ -559,14 +557,14 @@ bool Pickup_Health(edict_t* ent, edict_t* other)
 
 //======================================================================
 
-loadout_entry_t* Armor_GetCurrent(edict_t* ent)
+gloadout_entry_t* Armor_GetCurrent(edict_t* ent)
 {
 	if (!ent->client)
 		return 0;
 
-	loadout_entry_t* loadout_ptr_jacket = Loadout_GetItem(ent, "Jacket Armor");
-	loadout_entry_t* loadout_ptr_combat = Loadout_GetItem(ent, "Combat Armor");
-	loadout_entry_t* loadout_ptr_body = Loadout_GetItem(ent, "Body Armor");
+	gloadout_entry_t* loadout_ptr_jacket = Loadout_GetItem(ent, "Jacket Armor");
+	gloadout_entry_t* loadout_ptr_combat = Loadout_GetItem(ent, "Combat Armor");
+	gloadout_entry_t* loadout_ptr_body = Loadout_GetItem(ent, "Body Armor");
 
 	if (loadout_ptr_jacket == NULL
 		&& loadout_ptr_combat == NULL
@@ -598,10 +596,10 @@ loadout_entry_t* Armor_GetCurrent(edict_t* ent)
 
 bool Pickup_Armor(edict_t* ent, edict_t* other)
 {
-	loadout_entry_t* loadout_ptr_old = Armor_GetCurrent(other);
+	gloadout_entry_t* loadout_ptr_old = Armor_GetCurrent(other);
 	gitem_t* loadout_ptr_jacket = Item_FindByPickupName("Jacket Armor");
 	gitem_t* loadout_ptr_combat = Item_FindByPickupName("Combat Armor");
-	loadout_entry_t* loadout_ptr_new = Loadout_GetItem(other, ent->item->pickup_name);
+	gloadout_entry_t* loadout_ptr_new = Loadout_FindItem(other, ent->item);
 	gitem_armor_t* oldinfo;
 	gitem_armor_t* newinfo;
 	int32_t				newcount;
@@ -682,7 +680,7 @@ int32_t Armor_GetCurrentPowerArmor(edict_t* ent)
 	if (!ent->client)
 		return POWER_ARMOR_NONE;
 
-	loadout_entry_t* loadout_entry_power_screen = Loadout_GetItem(ent, "Power screen");
+	gloadout_entry_t* loadout_entry_power_screen = Loadout_GetItem(ent, "Power screen");
 
 	if (!(ent->flags & FL_POWER_ARMOR))
 		return POWER_ARMOR_NONE;
@@ -695,8 +693,8 @@ int32_t Armor_GetCurrentPowerArmor(edict_t* ent)
 
 void Use_PowerArmor(edict_t* ent, gitem_t* item)
 {
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, item->pickup_name);
-	loadout_entry_t* loadout_entry_cells = Loadout_GetItem(ent, "cells");
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(ent, item);
+	gloadout_entry_t* loadout_entry_cells = Loadout_GetItem(ent, "cells");
 
 	if (ent->flags & FL_POWER_ARMOR)
 	{
@@ -717,7 +715,7 @@ void Use_PowerArmor(edict_t* ent, gitem_t* item)
 
 bool Pickup_PowerArmor(edict_t* ent, edict_t* other)
 {
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(other, ent->item->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(other, ent->item);
 
 	if (!loadout_entry_ptr)
 		loadout_entry_ptr = Loadout_AddItem(other, ent->item->pickup_name, ent->item->icon, loadout_entry_type_armor, 1);
@@ -735,7 +733,7 @@ bool Pickup_PowerArmor(edict_t* ent, edict_t* other)
 
 void Drop_PowerArmor(edict_t* ent, gitem_t* item)
 {
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, item->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(ent, item);
 
 	if (!loadout_entry_ptr)
 	{
@@ -835,18 +833,18 @@ static void Item_DropMakeTouchable(edict_t* ent)
 
 	if (item->disappear_time > 0)
 	{
-		ent->nextthink = level.time + (item->disappear_time - item->touchable_time);
+		Edict_SetNextThink(ent, level.time + (item->disappear_time - item->touchable_time));
 
 		// make sure the user iddn't fuck up
 		if (ent->nextthink < level.time)
 		{
 			Com_Printf("Warning: Item touchable time was more than disappear. Setting disappear time to 29 seconds...");
-			ent->nextthink = level.time + 29;
+			Edict_SetNextThink(ent, level.time + 29);
 		}
 	}
 	else
 	{
-		ent->nextthink = level.time + 29;
+		Edict_SetNextThink(ent, level.time + 29);
 	}
 
 	ent->think = Edict_Free;
@@ -860,7 +858,7 @@ edict_t* Item_Drop(edict_t* ent, gitem_t* item)
 
 	dropped = Edict_Spawn();
 
-	dropped->classname = item->classname;
+	Edict_SetClassname(dropped, item->classname);
 	dropped->item = item;
 	dropped->spawnflags = DROPPED_ITEM;
 	dropped->s.effects = item->world_model_flags;
@@ -880,7 +878,7 @@ edict_t* Item_Drop(edict_t* ent, gitem_t* item)
 		AngleVectors(ent->client->v_angle, forward, right, NULL);
 		VectorSet3(offset, 24, 0, -16);
 		Game_ProjectSource(ent->s.origin, offset, forward, right, dropped->s.origin);
-		trace = gi.trace(ent->s.origin, dropped->mins, dropped->maxs,
+		trace = Game_Trace(ent->s.origin, dropped->mins, dropped->maxs,
 			dropped->s.origin, ent, CONTENTS_SOLID);
 		VectorCopy3(trace.endpos, dropped->s.origin);
 	}
@@ -896,11 +894,11 @@ edict_t* Item_Drop(edict_t* ent, gitem_t* item)
 	dropped->think = Item_DropMakeTouchable;
 
 	if (item->touchable_time > 0)
-		dropped->nextthink = level.time + item->touchable_time;
+		Edict_SetNextThink(dropped, level.time + item->touchable_time);
 	else
-		dropped->nextthink = level.time + 1;
+		Edict_SetNextThink(dropped, level.time + 1);
 
-	gi.Edict_Link(dropped);
+	Edict_Link(dropped);
 
 	return dropped;
 }
@@ -921,7 +919,7 @@ void Use_Item(edict_t* ent, edict_t* other, edict_t* activator)
 		ent->touch = Item_OnTouch;
 	}
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 //======================================================================
@@ -953,7 +951,7 @@ void Item_DropToFloor(edict_t* ent)
 	v = tv(0, 0, -128);
 	VectorAdd3(ent->s.origin, v, dest);
 
-	tr = gi.trace(ent->s.origin, ent->mins, ent->maxs, dest, ent, MASK_SOLID);
+	tr = Game_Trace(ent->s.origin, ent->mins, ent->maxs, dest, ent, MASK_SOLID);
 	if (tr.startsolid)
 	{
 		gi.dprintf("droptofloor: %s startsolid at %s\n", ent->classname, vtos(ent->s.origin));
@@ -973,7 +971,7 @@ void Item_DropToFloor(edict_t* ent)
 		ent->solid = SOLID_NOT;
 		if (ent == ent->teammaster)
 		{
-			ent->nextthink = level.time + TICK_TIME;
+			Edict_SetNextThink(ent, level.time + TICK_TIME);
 			ent->think = DoRespawn;
 		}
 	}
@@ -993,7 +991,7 @@ void Item_DropToFloor(edict_t* ent)
 		ent->use = Use_Item;
 	}
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 
@@ -1028,7 +1026,7 @@ void Item_Precache(gitem_t* it)
 	// parse everything for its ammo
 	if (it->ammo && it->ammo[0])
 	{
-		ammo = Item_FindByPickupName(it->ammo);
+		ammo = it->ammo_item;
 		if (ammo != it)
 			Item_Precache(ammo);
 	}
@@ -1080,7 +1078,7 @@ void Item_Spawn(edict_t* ent, gitem_t* item)
 
 	if (ent->spawnflags)
 	{
-		if (strcmp(ent->classname, "key_power_cube") != 0)
+		if (ent->classid != CLASS_KEY_POWER_CUBE)
 		{
 			ent->spawnflags = 0;
 			gi.dprintf("%s at %s has invalid spawnflags set\n", ent->classname, vtos(ent->s.origin));
@@ -1121,7 +1119,7 @@ void Item_Spawn(edict_t* ent, gitem_t* item)
 	}
 
 	ent->item = item;
-	ent->nextthink = level.time + 2 * TICK_TIME;    // items start after other solids
+	Edict_SetNextThink(ent, level.time + 2 * TICK_TIME);    // items start after other solids
 	ent->think = Item_DropToFloor;
 	ent->s.effects = item->world_model_flags;
 	ent->s.renderfx = RF_GLOW;
@@ -1978,9 +1976,31 @@ void SP_item_health_mega(edict_t* self)
 	self->style = HEALTH_IGNORE_MAX | HEALTH_TIMED;
 }
 
+static char* ItemList_ClassnameKey(int32_t index)
+{
+	return itemlist[index].classname;
+}
+
+static char* ItemList_PickupNameKey(int32_t index)
+{
+	return itemlist[index].pickup_name;
+}
+
 void ItemList_Init()
 {
+	int32_t i;
+
 	game.num_items = sizeof(itemlist) / sizeof(itemlist[0]) - 1;
+
+	if (game.num_items > MAX_ITEMS)
+		gi.error("ItemList_Init: %i items, max is %i", game.num_items, MAX_ITEMS);
+
+	PerfectHash_Build(&item_classname_hash, game.num_items, ItemList_ClassnameKey);
+	PerfectHash_Build(&item_pickup_hash, game.num_items, ItemList_PickupNameKey);
+
+	// resolve ammo names once so pickups don't have to look them up
+	for (i = 0; i < game.num_items; i++)
+		itemlist[i].ammo_item = Item_FindByPickupName(itemlist[i].ammo);
 }
 
 
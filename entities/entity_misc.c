@@ -95,13 +95,13 @@ void gib_think(edict_t* self)
 	int32_t next_frame_time = (0.1f / TICK_TIME);
 
 	self->s.frame++;
-	self->nextthink = level.time + TICK_TIME * next_frame_time;
+	Edict_SetNextThink(self, level.time + TICK_TIME * next_frame_time);
 
 
 	if (self->s.frame == 10)
 	{
 		self->think = Edict_Free;
-		self->nextthink = level.time + 8 + random() * 10;
+		Edict_SetNextThink(self, level.time + 8 + random() * 10);
 	}
 }
 
@@ -126,7 +126,7 @@ void gib_touch(edict_t* self, edict_t* other, cplane_t* plane, csurface_t* surf)
 		{
 			self->s.frame++;
 			self->think = gib_think;
-			self->nextthink = level.time + TICK_TIME;
+			Edict_SetNextThink(self, level.time + TICK_TIME);
 		}
 	}
 }
@@ -144,7 +144,10 @@ void ThrowGib(edict_t* self, char* gibname, int32_t damage, int32_t type)
 	vec3_t	size;
 	float	vscale;
 
-	gib = Edict_Spawn();
+	gib = GibPool_Spawn();
+
+	if (!gib)
+		return;
 
 	VectorScale3(self->size, 0.5, size);
 	VectorAdd3(self->absmin, size, origin);
@@ -179,9 +182,9 @@ void ThrowGib(edict_t* self, char* gibname, int32_t damage, int32_t type)
 	gib->avelocity[2] = random() * 600;
 
 	gib->think = Edict_Free;
-	gib->nextthink = level.time + 10 + random() * 10;
+	Edict_SetNextThink(gib, level.time + 10 + random() * 10);
 
-	gi.Edict_Link(gib);
+	Edict_Link(gib);
 }
 
 void ThrowHead(edict_t* self, char* gibname, int32_t damage, int32_t type)
@@ -224,9 +227,9 @@ void ThrowHead(edict_t* self, char* gibname, int32_t damage, int32_t type)
 	self->avelocity[YAW] = crandom() * 600;
 
 	self->think = Edict_Free;
-	self->nextthink = level.time + 10 + random() * 10;
+	Edict_SetNextThink(self, level.time + 10 + random() * 10);
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 
@@ -270,10 +273,10 @@ void ThrowClientHead(edict_t* self, int32_t damage)
 	else
 	{
 		self->think = NULL;
-		self->nextthink = 0;
+		Edict_SetNextThink(self, 0);
 	}
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 
@@ -292,7 +295,11 @@ void ThrowDebris(edict_t* self, char* modelname, float speed, vec3_t origin)
 	edict_t* chunk;
 	vec3_t	v;
 
-	chunk = Edict_Spawn();
+	chunk = GibPool_Spawn();
+
+	if (!chunk)
+		return;
+
 	VectorCopy3(origin, chunk->s.origin);
 	gi.setmodel(chunk, modelname);
 	v[0] = 100.0f * crandom();
@@ -305,13 +312,13 @@ void ThrowDebris(edict_t* self, char* modelname, float speed, vec3_t origin)
 	chunk->avelocity[1] = random() * 600;
 	chunk->avelocity[2] = random() * 600;
 	chunk->think = Edict_Free;
-	chunk->nextthink = level.time + 5 + random() * 5;
+	Edict_SetNextThink(chunk, level.time + 5 + random() * 5);
 	chunk->s.frame = 0;
 	chunk->flags = 0;
-	chunk->classname = "debris";
+	Edict_SetClassname(chunk, "debris");
 	chunk->takedamage = DAMAGE_YES;
 	chunk->die = debris_die;
-	gi.Edict_Link(chunk);
+	Edict_Link(chunk);
 }
 
 
@@ -383,15 +390,15 @@ void path_corner_touch(edict_t* self, edict_t* other, cplane_t* plane, csurface_
 
 	if (self->wait)
 	{
-		other->monsterinfo.pausetime = level.time + self->wait;
-		other->monsterinfo.stand(other);
+		other->monsterinfo->pausetime = level.time + self->wait;
+		other->monsterinfo->stand(other);
 		return;
 	}
 
 	if (!other->movetarget)
 	{
-		other->monsterinfo.pausetime = level.time + 100000000;
-		other->monsterinfo.stand(other);
+		other->monsterinfo->pausetime = level.time + 100000000;
+		other->monsterinfo->stand(other);
 	}
 	else
 	{
@@ -414,7 +421,7 @@ void SP_path_corner(edict_t* self)
 	VectorSet3(self->mins, -8, -8, -8);
 	VectorSet3(self->maxs, 8, 8, 8);
 	self->svflags |= SVF_NOCLIENT;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 
@@ -443,9 +450,9 @@ void point_combat_touch(edict_t* self, edict_t* other, cplane_t* plane, csurface
 	}
 	else if ((self->spawnflags & 1) && !(other->flags & (FL_SWIM | FL_FLY)))
 	{
-		other->monsterinfo.pausetime = level.time + 100000000;
-		other->monsterinfo.aiflags |= AI_STAND_GROUND;
-		other->monsterinfo.stand(other);
+		other->monsterinfo->pausetime = level.time + 100000000;
+		other->monsterinfo->aiflags |= AI_STAND_GROUND;
+		other->monsterinfo->stand(other);
 	}
 
 	if (other->movetarget == self)
@@ -453,7 +460,7 @@ void point_combat_touch(edict_t* self, edict_t* other, cplane_t* plane, csurface
 		other->target = NULL;
 		other->movetarget = NULL;
 		other->goalentity = other->enemy;
-		other->monsterinfo.aiflags &= ~AI_COMBAT_POINT;
+		other->monsterinfo->aiflags &= ~AI_COMBAT_POINT;
 	}
 
 	if (self->pathtarget)
@@ -482,7 +489,7 @@ void SP_point_combat(edict_t* self)
 	VectorSet3(self->mins, -8, -8, -16);
 	VectorSet3(self->maxs, 8, 8, 16);
 	self->svflags = SVF_NOCLIENT;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 };
 
 /*QUAKED info_null (0 0.5 0) (-4 -4 -4) (4 4 4)
@@ -604,7 +611,7 @@ void func_wall_use(edict_t* self, edict_t* other, edict_t* activator)
 		self->solid = SOLID_NOT;
 		self->svflags |= SVF_NOCLIENT;
 	}
-	gi.Edict_Link(self);
+	Edict_Link(self);
 
 	if (!(self->spawnflags & 2))
 		self->use = NULL;
@@ -666,7 +673,7 @@ void SP_func_wall(edict_t* self)
 			self->solid = SOLID_BSP;
 		}
 
-		gi.Edict_Link(self);
+		Edict_Link(self);
 		return;
 	}
 
@@ -699,7 +706,7 @@ void SP_func_wall(edict_t* self)
 		self->solid = SOLID_NOT;
 		self->svflags |= SVF_NOCLIENT;
 	}
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 /*QUAKED func_object (0 .5 .8) ? TRIGGER_SPAWN ANIMATED ANIMATED_FAST
@@ -752,7 +759,7 @@ void SP_func_object(edict_t* self)
 		self->solid = SOLID_BSP;
 		self->movetype = MOVETYPE_PUSH;
 		self->think = func_object_release;
-		self->nextthink = level.time + 2 * TICK_TIME;
+		Edict_SetNextThink(self, level.time + 2 * TICK_TIME);
 	}
 	else
 	{
@@ -769,7 +776,7 @@ void SP_func_object(edict_t* self)
 
 	self->clipmask = MASK_MONSTERSOLID;
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 
@@ -861,7 +868,7 @@ void func_explosive_spawn(edict_t* self, edict_t* other, edict_t* activator)
 	self->svflags &= ~SVF_NOCLIENT;
 	self->use = NULL;
 	Game_KillBox(self);
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 void SP_func_explosive(edict_t* self)
@@ -899,7 +906,7 @@ void SP_func_explosive(edict_t* self)
 		self->takedamage = DAMAGE_YES;
 	}
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 
@@ -1004,7 +1011,7 @@ void barrel_explode(edict_t* self)
 void barrel_delay(edict_t* self, edict_t* inflictor, edict_t* attacker, int32_t damage, vec3_t point)
 {
 	self->takedamage = DAMAGE_NO;
-	self->nextthink = level.time + 2 * TICK_TIME;
+	Edict_SetNextThink(self, level.time + 2 * TICK_TIME);
 	self->think = barrel_explode;
 	self->activator = attacker;
 }
@@ -1032,14 +1039,17 @@ void SP_misc_explobox(edict_t* self)
 
 	self->die = barrel_delay;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.aiflags = AI_NOSTEP;
+
+	// M_walkmove looks at its aiflags when it is pushed
+	Component_Add(self, COMPONENT_MONSTER);
+	self->monsterinfo->aiflags = AI_NOSTEP;
 
 	self->touch = barrel_touch;
 
 	self->think = AI_MonsterDropToFloor;
-	self->nextthink = level.time + 2 * TICK_TIME;
+	Edict_SetNextThink(self, level.time + 2 * TICK_TIME);
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 
@@ -1064,11 +1074,11 @@ void misc_blackhole_use(edict_t* ent, edict_t* other, edict_t* activator)
 void misc_blackhole_think(edict_t* self)
 {
 	if (++self->s.frame < 19)
-		self->nextthink = level.time + TICK_TIME;
+		Edict_SetNextThink(self, level.time + TICK_TIME);
 	else
 	{
 		self->s.frame = 0;
-		self->nextthink = level.time + TICK_TIME;
+		Edict_SetNextThink(self, level.time + TICK_TIME);
 	}
 }
 
@@ -1082,8 +1092,8 @@ void SP_misc_blackhole(edict_t* ent)
 	ent->s.renderfx = RF_TRANSLUCENT;
 	ent->use = misc_blackhole_use;
 	ent->think = misc_blackhole_think;
-	ent->nextthink = level.time + 2 * TICK_TIME;
-	gi.Edict_Link(ent);
+	Edict_SetNextThink(ent, level.time + 2 * TICK_TIME);
+	Edict_Link(ent);
 }
 
 
@@ -1094,7 +1104,7 @@ The banner is 128 tall.
 void misc_banner_think(edict_t* ent)
 {
 	ent->s.frame = (ent->s.frame + 1) % 16;
-	ent->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(ent, level.time + TICK_TIME);
 }
 
 void SP_misc_banner(edict_t* ent)
@@ -1103,10 +1113,10 @@ void SP_misc_banner(edict_t* ent)
 	ent->solid = SOLID_NOT;
 	ent->s.modelindex = gi.modelindex("models/objects/banner/tris.md2");
 	ent->s.frame = rand() % 16;
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 
 	ent->think = misc_banner_think;
-	ent->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(ent, level.time + TICK_TIME);
 }
 
 /*QUAKED misc_deadsoldier (1 .5 0) (-16 -16 0) (16 16 16) ON_BACK ON_STOMACH BACK_DECAP FETAL_POS SIT_DECAP IMPALED
@@ -1128,6 +1138,8 @@ void misc_deadsoldier_die(edict_t* self, edict_t* inflictor, edict_t* attacker,
 
 void SP_misc_deadsoldier(edict_t* ent)
 {
+	Component_Add(ent, COMPONENT_MONSTER);
+
 	ent->movetype = MOVETYPE_NONE;
 	ent->solid = SOLID_BBOX;
 	ent->s.modelindex = gi.modelindex("models/deadbods/dude/tris.md2");
@@ -1152,9 +1164,9 @@ void SP_misc_deadsoldier(edict_t* ent)
 	ent->takedamage = DAMAGE_YES;
 	ent->svflags |= SVF_MONSTER | SVF_DEADMONSTER;
 	ent->die = misc_deadsoldier_die;
-	ent->monsterinfo.aiflags |= AI_GOOD_GUY;
+	ent->monsterinfo->aiflags |= AI_GOOD_GUY;
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 /*QUAKED misc_satellite_dish (1 .5 0) (-64 -64 0) (64 64 128)
@@ -1165,14 +1177,14 @@ void misc_satellite_dish_think(edict_t* self)
 
 	self->s.frame++;
 	if (self->s.frame < 38)
-		self->nextthink = level.time + TICK_TIME * next_frame_time;
+		Edict_SetNextThink(self, level.time + TICK_TIME * next_frame_time);
 }
 
 void misc_satellite_dish_use(edict_t* self, edict_t* other, edict_t* activator)
 {
 	self->s.frame = 0;
 	self->think = misc_satellite_dish_think;
-	self->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(self, level.time + TICK_TIME);
 }
 
 void SP_misc_satellite_dish(edict_t* ent)
@@ -1183,7 +1195,7 @@ void SP_misc_satellite_dish(edict_t* ent)
 	VectorSet3(ent->maxs, 64, 64, 128);
 	ent->s.modelindex = gi.modelindex("models/objects/satellite/tris.md2");
 	ent->use = misc_satellite_dish_use;
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 
@@ -1194,7 +1206,7 @@ void SP_light_mine1(edict_t* ent)
 	ent->movetype = MOVETYPE_NONE;
 	ent->solid = SOLID_BBOX;
 	ent->s.modelindex = gi.modelindex("models/objects/minelite/light1/tris.md2");
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 
@@ -1205,7 +1217,7 @@ void SP_light_mine2(edict_t* ent)
 	ent->movetype = MOVETYPE_NONE;
 	ent->solid = SOLID_BBOX;
 	ent->s.modelindex = gi.modelindex("models/objects/minelite/light2/tris.md2");
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 
@@ -1214,6 +1226,8 @@ Intended for use with the target_spawner
 */
 void SP_misc_gib_arm(edict_t* ent)
 {
+	Component_Add(ent, COMPONENT_MONSTER);
+
 	gi.setmodel(ent, "models/objects/gibs/arm/tris.md2");
 	ent->solid = SOLID_NOT;
 	ent->s.effects |= EF_GIB;
@@ -1226,8 +1240,8 @@ void SP_misc_gib_arm(edict_t* ent)
 	ent->avelocity[1] = random() * 200;
 	ent->avelocity[2] = random() * 200;
 	ent->think = Edict_Free;
-	ent->nextthink = level.time + 30;
-	gi.Edict_Link(ent);
+	Edict_SetNextThink(ent, level.time + 30);
+	Edict_Link(ent);
 }
 
 /*QUAKED misc_gib_leg (1 0 0) (-8 -8 -8) (8 8 8)
@@ -1235,6 +1249,8 @@ Intended for use with the target_spawner
 */
 void SP_misc_gib_leg(edict_t* ent)
 {
+	Component_Add(ent, COMPONENT_MONSTER);
+
 	gi.setmodel(ent, "models/objects/gibs/leg/tris.md2");
 	ent->solid = SOLID_NOT;
 	ent->s.effects |= EF_GIB;
@@ -1247,8 +1263,8 @@ void SP_misc_gib_leg(edict_t* ent)
 	ent->avelocity[1] = random() * 200;
 	ent->avelocity[2] = random() * 200;
 	ent->think = Edict_Free;
-	ent->nextthink = level.time + 30;
-	gi.Edict_Link(ent);
+	Edict_SetNextThink(ent, level.time + 30);
+	Edict_Link(ent);
 }
 
 /*QUAKED misc_gib_head (1 0 0) (-8 -8 -8) (8 8 8)
@@ -1256,6 +1272,8 @@ Intended for use with the target_spawner
 */
 void SP_misc_gib_head(edict_t* ent)
 {
+	Component_Add(ent, COMPONENT_MONSTER);
+
 	gi.setmodel(ent, "models/objects/gibs/head/tris.md2");
 	ent->solid = SOLID_NOT;
 	ent->s.effects |= EF_GIB;
@@ -1268,8 +1286,8 @@ void SP_misc_gib_head(edict_t* ent)
 	ent->avelocity[1] = random() * 200;
 	ent->avelocity[2] = random() * 200;
 	ent->think = Edict_Free;
-	ent->nextthink = level.time + 30;
-	gi.Edict_Link(ent);
+	Edict_SetNextThink(ent, level.time + 30);
+	Edict_Link(ent);
 }
 
 //=====================================================
@@ -1285,7 +1303,7 @@ void SP_target_character(edict_t* self)
 	gi.setmodel(self, self->model);
 	self->solid = SOLID_BSP;
 	self->s.frame = 12;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 	return;
 }
 
@@ -1393,9 +1411,13 @@ static void func_clock_format_countdown(edict_t* self)
 
 void func_clock_think(edict_t* self)
 {
+	// a load puts the message in the shared string pool, write into a buffer of our own again
+	if (StringPool_Owns(self->message))
+		self->message = gi.TagMalloc(CLOCK_MESSAGE_SIZE, TAG_LEVEL);
+
 	if (!self->enemy)
 	{
-		self->enemy = Game_FindEdictByValue(NULL, FOFS(targetname), self->target);
+		self->enemy = Edict_FindByTargetname(NULL, self->target);
 		if (!self->enemy)
 			return;
 	}
@@ -1453,7 +1475,7 @@ void func_clock_think(edict_t* self)
 			return;
 	}
 
-	self->nextthink = level.time + 1;
+	Edict_SetNextThink(self, level.time + 1);
 }
 
 void func_clock_use(edict_t* self, edict_t* other, edict_t* activator)
@@ -1494,7 +1516,7 @@ void SP_func_clock(edict_t* self)
 	if (self->spawnflags & 4)
 		self->use = func_clock_use;
 	else
-		self->nextthink = level.time + 1;
+		Edict_SetNextThink(self, level.time + 1);
 }
 
 //=================================================================================
@@ -1506,7 +1528,7 @@ void teleporter_touch(edict_t* self, edict_t* other, cplane_t* plane, csurface_t
 
 	if (!other->client)
 		return;
-	dest = Game_FindEdictByValue(NULL, FOFS(targetname), self->target);
+	dest = Edict_FindByTargetname(NULL, self->target);
 	if (!dest)
 	{
 		gi.dprintf("Couldn't find destination\n");
@@ -1514,7 +1536,7 @@ void teleporter_touch(edict_t* self, edict_t* other, cplane_t* plane, csurface_t
 	}
 
 	// unlink to make sure it can't possibly interfere with KillBox
-	gi.Edict_Unlink(other);
+	Edict_Unlink(other);
 
 	VectorCopy3(dest->s.origin, other->s.origin);
 	VectorCopy3(dest->s.origin, other->s.old_origin);
@@ -1542,7 +1564,7 @@ void teleporter_touch(edict_t* self, edict_t* other, cplane_t* plane, csurface_t
 	// kill anything at the destination
 	Game_KillBox(other);
 
-	gi.Edict_Link(other);
+	Edict_Link(other);
 }
 
 /*QUAKED misc_teleporter (1 0 0) (-32 -32 -24) (32 32 -16)
@@ -1567,7 +1589,7 @@ void SP_misc_teleporter(edict_t* ent)
 
 	VectorSet3(ent->mins, -32, -32, -24);
 	VectorSet3(ent->maxs, 32, 32, -16);
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 
 	trig = Edict_Spawn();
 	trig->touch = teleporter_touch;
@@ -1577,7 +1599,7 @@ void SP_misc_teleporter(edict_t* ent)
 	VectorCopy3(ent->s.origin, trig->s.origin);
 	VectorSet3(trig->mins, -8, -8, 8);
 	VectorSet3(trig->maxs, 8, 8, 24);
-	gi.Edict_Link(trig);
+	Edict_Link(trig);
 
 }
 
@@ -1592,6 +1614,6 @@ void SP_misc_teleporter_dest(edict_t* ent)
 	//	ent->s.effects |= EF_FLIES;
 	VectorSet3(ent->mins, -32, -32, -24);
 	VectorSet3(ent->maxs, 32, 32, -16);
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
@@ -110,7 +110,7 @@ void SP_target_speaker(edict_t* ent)
 
 	// must link the entity so we get areas and clusters so
 	// the server can determine who to send updates to
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 //==========================================================
@@ -208,7 +208,7 @@ void use_target_explosion(edict_t* self, edict_t* other, edict_t* activator)
 	}
 
 	self->think = target_explosion_explode;
-	self->nextthink = level.time + self->delay;
+	Edict_SetNextThink(self, level.time + self->delay);
 }
 
 void SP_target_explosion(edict_t* ent)
@@ -330,13 +330,13 @@ void use_target_spawner(edict_t* self, edict_t* other, edict_t* activator)
 	edict_t* ent;
 
 	ent = Edict_Spawn();
-	ent->classname = self->target;
+	Edict_SetClassname(ent, self->target);
 	VectorCopy3(self->s.origin, ent->s.origin);
 	VectorCopy3(self->s.angles, ent->s.angles);
 	ED_CallSpawn(ent);
-	gi.Edict_Unlink(ent);
+	Edict_Unlink(ent);
 	Game_KillBox(ent);
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 	if (self->speed)
 		VectorCopy3(self->movedir, ent->velocity);
 }
@@ -430,7 +430,7 @@ void SP_target_crosslevel_target(edict_t* self)
 	self->svflags = SVF_NOCLIENT;
 
 	self->think = target_crosslevel_target_think;
-	self->nextthink = level.time + self->delay;
+	Edict_SetNextThink(self, level.time + self->delay);
 }
 
 //==========================================================
@@ -470,7 +470,7 @@ void target_laser_think(edict_t* self)
 	VectorMA3(start, 2048, self->movedir, end);
 	while (1)
 	{
-		tr = gi.trace(start, NULL, NULL, end, ignore, CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_DEADMONSTER);
+		tr = Game_Trace(start, NULL, NULL, end, ignore, CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_DEADMONSTER);
 
 		if (!tr.ent)
 			break;
@@ -521,7 +521,7 @@ void target_laser_think(edict_t* self)
 
 	VectorCopy3(tr.endpos, self->s.old_origin);
 
-	self->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(self, level.time + TICK_TIME);
 }
 
 void target_laser_on(edict_t* self)
@@ -537,7 +537,7 @@ void target_laser_off(edict_t* self)
 {
 	self->spawnflags &= ~1;
 	self->svflags |= SVF_NOCLIENT;
-	self->nextthink = 0;
+	Edict_SetNextThink(self, 0);
 }
 
 void target_laser_use(edict_t* self, edict_t* other, edict_t* activator)
@@ -568,7 +568,7 @@ void target_laser_start(edict_t* self)
 	{
 		if (self->target)
 		{
-			ent = Game_FindEdictByValue(NULL, FOFS(targetname), self->target);
+			ent = Edict_FindByTargetname(NULL, self->target);
 			if (!ent)
 				gi.dprintf("%s at %s: %s is a bad target\n", self->classname, vtos(self->s.origin), self->target);
 			self->enemy = ent;
@@ -586,7 +586,7 @@ void target_laser_start(edict_t* self)
 
 	VectorSet3(self->mins, -8, -8, -8);
 	VectorSet3(self->maxs, 8, 8, 8);
-	gi.Edict_Link(self);
+	Edict_Link(self);
 
 	if (self->spawnflags & 1)
 		target_laser_on(self);
@@ -598,7 +598,7 @@ void SP_target_laser(edict_t* self)
 {
 	// let everything else get spawned before we start firing
 	self->think = target_laser_start;
-	self->nextthink = level.time + 1;
+	Edict_SetNextThink(self, level.time + 1);
 }
 
 //==========================================================
@@ -618,7 +618,7 @@ void target_lightramp_think(edict_t* self)
 
 	if ((level.time - self->timestamp) < self->speed)
 	{
-		self->nextthink = level.time + TICK_TIME;
+		Edict_SetNextThink(self, level.time + TICK_TIME);
 	}
 	else if (self->spawnflags & 1)
 	{
@@ -641,11 +641,11 @@ void target_lightramp_use(edict_t* self, edict_t* other, edict_t* activator)
 		e = NULL;
 		while (1)
 		{
-			e = Game_FindEdictByValue(e, FOFS(targetname), self->target);
+			e = Edict_FindByTargetname(e, self->target);
 			if (!e)
 				break;
-			if (strcmp(e->classname, "light") != 0
-				|| strcmp(e->classname, "light_spot") != 0)
+			if (e->classid != CLASS_LIGHT
+				|| e->classid != CLASS_LIGHT_SPOT)
 			{
 				gi.dprintf("%s at %s ", self->classname, vtos(self->s.origin));
 				gi.dprintf("target %s (%s at %s) is not a light\n", self->target, e->classname, vtos(e->s.origin));
@@ -729,13 +729,13 @@ void target_earthquake_think(edict_t* self)
 	}
 
 	if (level.time < self->timestamp)
-		self->nextthink = level.time + TICK_TIME;
+		Edict_SetNextThink(self, level.time + TICK_TIME);
 }
 
 void target_earthquake_use(edict_t* self, edict_t* other, edict_t* activator)
 {
 	self->timestamp = level.time + self->count;
-	self->nextthink = level.time + TICK_TIME;
+	Edict_SetNextThink(self, level.time + TICK_TIME);
 	self->activator = activator;
 	self->last_move_time = 0;
 }
@@ -35,7 +35,7 @@ void InitTrigger(edict_t* self)
 // the wait time has passed, so set back up for another activation
 void multi_wait(edict_t* ent)
 {
-	ent->nextthink = 0;
+	Edict_SetNextThink(ent, 0);
 }
 
 
@@ -52,13 +52,13 @@ void multi_trigger(edict_t* ent)
 	if (ent->wait > 0)
 	{
 		ent->think = multi_wait;
-		ent->nextthink = level.time + ent->wait;
+		Edict_SetNextThink(ent, level.time + ent->wait);
 	}
 	else
 	{	// we can't just remove (self) here, because this is a touch function
 		// called while looping through area links...
 		ent->touch = NULL;
-		ent->nextthink = level.time + TICK_TIME;
+		Edict_SetNextThink(ent, level.time + TICK_TIME);
 		ent->think = Edict_Free;
 	}
 }
@@ -112,7 +112,7 @@ void trigger_enable(edict_t* self, edict_t* other, edict_t* activator)
 {
 	self->solid = SOLID_TRIGGER;
 	self->use = Use_Multi;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 void SP_trigger_multiple(edict_t* ent)
@@ -146,7 +146,7 @@ void SP_trigger_multiple(edict_t* ent)
 		Edict_SetMovedir(ent->s.angles, ent->movedir);
 
 	gi.setmodel(ent, ent->model);
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 
@@ -283,7 +283,7 @@ static int32_t windsound;
 
 void trigger_push_touch(edict_t* self, edict_t* other, cplane_t* plane, csurface_t* surf)
 {
-	if (strcmp(other->classname, "grenade") == 0)
+	if (other->classid == CLASS_GRENADE)
 	{
 		VectorScale3(self->movedir, self->speed * 10, other->velocity);
 	}
@@ -302,6 +302,9 @@ void trigger_push_touch(edict_t* self, edict_t* other, cplane_t* plane, csurface
 			}
 		}
 	}
+
+	Edict_Wake(other);
+
 	if (self->spawnflags & PUSH_ONCE)
 		Edict_Free(self);
 }
@@ -318,7 +321,7 @@ void SP_trigger_push(edict_t* self)
 	self->touch = trigger_push_touch;
 	if (!self->speed)
 		self->speed = 1000;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 
@@ -348,7 +351,7 @@ void hurt_use(edict_t* self, edict_t* other, edict_t* activator)
 		self->solid = SOLID_TRIGGER;
 	else
 		self->solid = SOLID_NOT;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 
 	if (!(self->spawnflags & 2))
 		self->use = NULL;
@@ -401,7 +404,7 @@ void SP_trigger_hurt(edict_t* self)
 	if (self->spawnflags & 2)
 		self->use = hurt_use;
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 
@@ -462,6 +465,8 @@ void trigger_monsterjump_touch(edict_t* self, edict_t* other, cplane_t* plane, c
 	if (!(other->svflags & SVF_MONSTER))
 		return;
 
+	Edict_Wake(other);
+
 	// set XY even if not on ground, so the jump will clear lips
 	other->velocity[0] = self->movedir[0] * self->speed;
 	other->velocity[1] = self->movedir[1] * self->speed;
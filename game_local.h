@@ -180,6 +180,16 @@ typedef enum
 #define	AS_MELEE				3
 #define	AS_MISSILE				4
 
+// monster think rate, see ai_lod.c
+#define AI_LOD_FULL				0
+#define AI_LOD_HALF				1
+#define AI_LOD_QUARTER			2
+#define AI_LOD_DORMANT			3
+#define AI_NUM_LODS				4
+
+// ticks between thinks for the tiers below dormant
+#define AI_LOD_TICKS(ent)		(1 << (ent)->monsterinfo->lod)
+
 // armor types
 #define ARMOR_NONE				0
 #define ARMOR_JACKET			1
@@ -298,8 +308,32 @@ typedef struct gitem_s
 
 	float		touchable_time; // Time that this item will take to become touchable once it has been dropped.
 	float		disappear_time; // Time that this item will take to disappear once it has been dropped.
+
+	struct gitem_s* ammo_item;	// ammo resolved at ItemList_Init
 } gitem_t;
 
+#define MAX_ITEMS				256		// most entries itemlist can have
+
+//
+// server side loadout. entries only hold the item index, the names and icons
+// the client needs are sent from the item when the entry is added
+//
+typedef struct gloadout_entry_s
+{
+	int32_t				item_index;		// index into itemlist, 0 if the slot has been emptied
+	int32_t				amount;			// The amount (usually only used for the ammunition)
+	loadout_entry_type	type;			// The type of this loadout entry.
+} gloadout_entry_t;
+
+typedef struct gloadout_s
+{
+	int32_t				num_items;							// Slots used, including emptied ones below the last item
+	gloadout_entry_t*	client_current_item;				// The currently selected item
+	uint32_t			occupied;							// One bit per slot that holds an item
+	uint8_t				item_slots[MAX_ITEMS];				// Slot + 1 of each item index, 0 if it isn't in the loadout
+	gloadout_entry_t	items[LOADOUT_MAX_ITEMS];			// The items within the loadout.
+} gloadout_t;
+
 //
 // this structure is left intact through an entire game
 // it should be initialized at dll load time, and read/written to
@@ -371,6 +405,11 @@ typedef struct level_locals_s
 	int32_t		body_que;			// dead bodies
 
 	int32_t		power_cubes;		// ugly necessity for coop
+
+	uint32_t	nav_checksum;		// of the entity string, names the navigation graph cache
+
+	int32_t		projectile_base;	// first edict of the slab set aside for projectiles, see ammo_pool.c
+	int32_t		projectile_count;
 } level_locals_t;
 
 
@@ -484,8 +523,37 @@ typedef struct monsterinfo_s
 	int32_t	wander_steps_max;		// The maximum number of wander steps.
 	int32_t	wander_steps;			// The current number of wander steps.
 	int32_t	wander_steps_total;		// The current total number of wander steps.
+
+	int32_t	lod;					// AI_LOD_*, how often it thinks
 } monsterinfo_t;
 
+typedef struct particle_emitter_s
+{
+	int32_t 	angles_spread;			// angle spread
+	color4_t	color;
+	// TODO: MAKE THIS A COLOR4_T!!!!!
+	color3_t	color_run;
+	int32_t		effect;					// tempent ID
+	int32_t		rate;
+	int32_t		lifetime;				// ignored if spawnflags & 2
+	int32_t		magnitude;
+	int32_t		next_frame;				// particles to send next frame
+	float		alphavel;
+} particle_emitter_t;
+
+//
+// optional per-edict data blocks, see entity_component.c
+// anything with SVF_MONSTER set has a monster component
+//
+typedef enum component_type_e
+{
+	COMPONENT_MONSTER,		// monsterinfo
+	COMPONENT_MOVER,		// moveinfo
+	COMPONENT_PARTICLES,	// particles
+
+	COMPONENT_NUM_TYPES,
+} component_type_t;
+
 extern game_locals_t	game;
 extern level_locals_t	level;
 extern game_import_t	gi;
@@ -539,6 +607,9 @@ extern edict_t* g_edicts;
 #define	STOFS(x) (intptr_t)&(((spawn_temp_t *)0)->x)
 #define	LLOFS(x) (intptr_t)&(((level_locals_t *)0)->x)
 #define	CLOFS(x) (intptr_t)&(((gclient_t *)0)->x)
+#define	MIOFS(x) (intptr_t)&(((monsterinfo_t *)0)->x)
+#define	MVOFS(x) (intptr_t)&(((moveinfo_t *)0)->x)
+#define	PEOFS(x) (intptr_t)&(((particle_emitter_t *)0)->x)
 
 #define random()	((rand () & 0x7fff) / ((float)0x7fff))
 #define crandom()	(2.0f * (random() - 0.5f))
@@ -588,6 +659,18 @@ extern cvar_t* sv_maplist;
 
 extern cvar_t* aimfix;
 
+extern cvar_t* sv_profile;
+extern cvar_t* sv_tracecache;
+extern cvar_t* sv_sightbudget;
+extern cvar_t* sv_nav;
+extern cvar_t* sv_flowbudget;
+extern cvar_t* sv_ailod;
+extern cvar_t* sv_ailod_half;
+extern cvar_t* sv_ailod_quarter;
+extern cvar_t* sv_ailod_dormant;
+extern cvar_t* sv_maxgibs;
+extern cvar_t* sv_physbatch;
+
 #define world	(&g_edicts[0])
 
 // item spawnflags
@@ -605,11 +688,16 @@ extern cvar_t* aimfix;
 //
 #define FFL_SPAWNTEMP		1
 #define FFL_NOSPAWN			2
+#define FFL_MONSTER			4		// offset is into the monster component
+#define FFL_MOVER			8		// ...the mover component
+#define FFL_PARTICLES		16		// ...the particle emitter component
+
+#define FFL_COMPONENTS		(FFL_MONSTER | FFL_MOVER | FFL_PARTICLES)
 
 typedef enum fieldtype_e {
 	F_INT,
 	F_FLOAT,
-	F_LSTRING,			// string on disk, pointer in memory, TAG_LEVEL
+	F_LSTRING,			// string table index on disk, interned pointer in memory, TAG_LEVEL
 	F_GSTRING,			// string on disk, pointer in memory, TAG_GAME
 	F_VECTOR3,
 	F_VECTOR4,
@@ -634,6 +722,39 @@ typedef struct field_s
 extern	field_t fields[];
 extern	gitem_t	itemlist[];
 
+//
+// interned classnames, see entity_class.c
+// the builtin classes are registered in this order so their ids are fixed
+//
+#define MAX_CLASSES			1024
+
+typedef enum class_id_e
+{
+	CLASS_NONE = 0,
+	CLASS_WORLDSPAWN,
+	CLASS_PLAYER,
+	CLASS_PLAYER_NOISE,
+	CLASS_FUNC_AREAPORTAL,
+	CLASS_FUNC_DOOR,
+	CLASS_FUNC_DOOR_ROTATING,
+	CLASS_FUNC_TRAIN,
+	CLASS_PATH_CORNER,
+	CLASS_POINT_COMBAT,
+	CLASS_TARGET_ACTOR,
+	CLASS_TARGET_CHANGELEVEL,
+	CLASS_TARGET_CROSSLEVEL_TARGET,
+	CLASS_INFO_PLAYER_START,
+	CLASS_INFO_PLAYER_DEATHMATCH,
+	CLASS_INFO_PLAYER_INTERMISSION,
+	CLASS_GRENADE,
+	CLASS_LIGHT,
+	CLASS_LIGHT_SPOT,
+	CLASS_KEY_POWER_CUBE,
+	CLASS_MONSTER_MEDIC,
+
+	CLASS_NUM_BUILTIN,
+} class_id_t;
+
 // Zombie specific defines
 // test zombie types
 // maybe make these load from a file
@@ -692,7 +813,7 @@ void Item_SetRespawn(edict_t* ent, float delay);
 void Item_OnTouch(edict_t* ent, edict_t* other, cplane_t* plane, csurface_t* surf);
 void Player_WeaponChange(edict_t* ent);
 void Weapon_Think(edict_t* ent);
-loadout_entry_t* Armor_GetCurrent(edict_t* ent);
+gloadout_entry_t* Armor_GetCurrent(edict_t* ent);
 int32_t Armor_GetCurrentPowerArmor(edict_t* ent);
 bool Ammo_Add(edict_t* ent, gitem_t* item, int32_t count);
 
@@ -705,16 +826,63 @@ void	Game_ProjectSource(vec3_t point, vec3_t distance, vec3_t forward, vec3_t ri
 edict_t* Game_FindEdictByValue(edict_t* from, int32_t fieldofs, char* match);
 edict_t* Game_FindEdictsWithinRadius(edict_t* from, vec3_t org, float rad);
 edict_t* Edict_PickTarget(char* targetname);
+edict_t* Edict_FindByTargetname(edict_t* from, char* targetname);
+void	Edict_SetTargetname(edict_t* ent, char* targetname);
+void	Targetname_Link(edict_t* ent);
+void	Targetname_Unlink(edict_t* ent);
+void	Targetname_Clear();
+void	Targetname_Rebuild();
 void	Edict_UseTargets(edict_t* ent, edict_t* activator);
 void	Edict_SetMovedir(vec3_t angles, vec3_t movedir);
 
 void	Edict_Init(edict_t* e);
 edict_t* Edict_Spawn();
+edict_t* Edict_TrySpawn(int32_t reserve);
+edict_t* Edict_Recycle(edict_t* e);
 void	Edict_Free(edict_t* e);
+void	Edict_Link(edict_t* ent);
+void	Edict_Unlink(edict_t* ent);
+void	Edict_PrintStats();
+
+void	EdictQueue_Rebuild();
+void	EdictQueue_Release(edict_t* ent);
+
+// edict allocation counters, reported by sv stats
+typedef struct edict_stats_s
+{
+	int32_t		allocs;				// total G_Spawn calls
+	int32_t		rate;				// allocations over the last full second
+	int32_t		window_allocs;		// allocations so far in the current second
+	float		window_start;		// level.time the current second started
+	int32_t		peak_live;			// most edicts in use at once
+	int32_t		peak_edicts;		// highest num_edicts reached
+} edict_stats_t;
+
+extern edict_stats_t edict_stats;
+
+void	EdictList_Add(edict_t* ent);
+void	EdictList_Remove(edict_t* ent);
+void	EdictList_Clear();
+void	EdictList_Rebuild();
+edict_t* EdictList_Next(edict_t* from);
 
 void	Edict_TouchTriggers(edict_t* ent);
 void	Edict_TouchSolids(edict_t* ent);
 
+// collision free name lookup, see PerfectHash_Build
+#define PERFECT_HASH_SIZE		512
+#define PERFECT_HASH_MAX_BUCKET	8
+
+typedef struct perfect_hash_s
+{
+	uint32_t	mask;
+	uint32_t	displace[PERFECT_HASH_SIZE];
+	int32_t		slots[PERFECT_HASH_SIZE];
+} perfect_hash_t;
+
+void	PerfectHash_Build(perfect_hash_t* hash, int32_t count, char* (*key)(int32_t index));
+int32_t	PerfectHash_Find(perfect_hash_t* hash, char* name);
+
 void	GameUI_Send(edict_t* ent, char* ui_name, bool enabled, bool activated, bool reliable);
 void	GameUI_SetText(edict_t* ent, char* ui_name, char* control_name, char* text, bool reliable);
 void	GameUI_SetImage(edict_t* ent, char* ui_name, char* control_name, char* image_path, bool reliable);
@@ -804,6 +972,28 @@ void ThrowClientHead(edict_t* self, int32_t damage);
 void ThrowGib(edict_t* self, char* gibname, int32_t damage, int32_t type);
 void BecomeExplosion1(edict_t* self);
 
+//
+// entity_component.c
+//
+void* Component_Add(edict_t* ent, component_type_t type);
+void Component_RemoveAll(edict_t* ent);
+void Component_Clear();
+void** Component_Slot(edict_t* ent, component_type_t type);
+int32_t Component_Handle(edict_t* ent, component_type_t type);
+int32_t Component_Size(component_type_t type);
+component_type_t Component_FieldType(field_t* field);
+uint8_t* Component_FieldBase(edict_t* ent, field_t* field);
+void Component_PrintStats();
+
+//
+// entity_gib.c
+//
+edict_t* GibPool_Spawn();
+void GibPool_Remove(edict_t* ent);
+void GibPool_Clear();
+void GibPool_Rebuild();
+void GibPool_PrintStats();
+
 //
 // ai_base.c
 //
@@ -827,6 +1017,31 @@ bool AI_MoveWalk(edict_t* ent, float yaw, float dist);
 void AI_MoveToGoal(edict_t* ent, float dist);
 void AI_ChangeYaw(edict_t* ent);
 
+//
+// ai_sight.c
+//
+void AI_UpdateSight();
+edict_t* AI_PickSightClient(edict_t* self, bool* checked);
+void AI_PrintSightStats();
+
+//
+// ai_lod.c
+//
+void AI_UpdateLOD();
+bool AI_LODThink(edict_t* self);
+void AI_PrintLODStats();
+
+//
+// ai_nav.c
+//
+void Nav_Clear(char* entities);
+void Nav_Init();
+int32_t Nav_FindNode(vec3_t origin);
+bool Nav_SteerTowards(edict_t* self, vec3_t goal, vec3_t waypoint);
+void Nav_UpdateFields();
+bool Nav_FlowDirection(edict_t* self, edict_t* target, vec3_t dir);
+void Nav_PrintStats();
+
 
 //
 // Ammo_*.c
@@ -844,6 +1059,36 @@ void Ammo_Rail(edict_t* self, vec3_t start, vec3_t aimdir, int32_t damage, int32
 void Ammo_Bamfuslicator(edict_t* self, vec3_t start, vec3_t aimdir, zombie_type zombie_type);
 void Ammo_Tangfuslicator(edict_t* self, vec3_t start, vec3_t aimdir); //todo: recoil
 
+//
+// ammo_pool.c
+//
+
+// what a kind of projectile starts out as, see Projectile_Spawn
+typedef struct projectile_template_s
+{
+	char*		classname;
+	char*		model;
+	char*		sound;			// looping sound, or NULL
+	int32_t		movetype;
+	int32_t		effects;
+	int32_t		svflags;
+	void		(*touch)(edict_t* self, edict_t* other, cplane_t* plane, csurface_t* surf);
+	void		(*think)(edict_t* self);
+
+	// looked up the first time it is used each level
+	int32_t		modelindex;
+	int32_t		soundindex;
+	int32_t		cached;
+} projectile_template_t;
+
+void ProjectilePool_Init();
+void ProjectilePool_Rebuild();
+bool ProjectilePool_Owns(edict_t* ent);
+void ProjectilePool_Release(edict_t* ent);
+edict_t* Projectile_Spawn(projectile_template_t* proj, edict_t* owner, vec3_t start);
+void ProjectilePool_RunFrame();
+void ProjectilePool_PrintStats();
+
 //
 // game_player_trail.c
 //
@@ -867,6 +1112,7 @@ void Client_InitBodyQue();
 void Client_BeginServerFrame(edict_t* ent);
 void Client_UserinfoChanged(edict_t* ent, char* userinfo);
 float Client_CalcRoll(vec3_t angles, vec3_t velocity);
+void Client_SetTeam(edict_t* ent, player_team team);
 
 
 void Client_SetupGamemode(edict_t* ent, vec3_t origin, vec3_t angles);
@@ -924,6 +1170,155 @@ void Player_Noise(edict_t* who, vec3_t where, int32_t type);
 // physics_base.c
 //
 void Physics_RunEntity(edict_t* ent);
+void Physics_RunProjectile(edict_t* ent);
+
+//
+// physics_batch.c
+//
+void Batch_Link(edict_t* ent);
+void Batch_Clear();
+void Batch_Rebuild();
+void Batch_Sync(edict_t* ent);
+void Batch_Remove(edict_t* ent);
+void Batch_Integrate();
+bool Batch_Take(edict_t* ent, vec3_t end);
+void Batch_PrintStats();
+
+//
+// physics_think.c
+//
+void ThinkWheel_Link(edict_t* ent);
+void ThinkWheel_Unlink(edict_t* ent);
+void ThinkWheel_Clear();
+void ThinkWheel_Rebuild();
+void ThinkWheel_Advance(int32_t tick);
+void ThinkWheel_Remove(edict_t* ent);
+void ThinkWheel_Uncarry(edict_t* ent);
+void ThinkWheel_TrySleep(edict_t* ent);
+
+//
+// game_profile.c
+//
+typedef enum profile_phase_e
+{
+	PROFILE_PHASE_FRAME,
+	PROFILE_PHASE_SIGHT,
+	PROFILE_PHASE_FLOW,
+	PROFILE_PHASE_ENTITIES,
+	PROFILE_PHASE_PROJECTILES,
+	PROFILE_PHASE_GAMEMODE,
+	PROFILE_PHASE_CLIENTS,
+	PROFILE_NUM_PHASES
+} profile_phase_t;
+
+extern bool profile_enabled;
+
+// start time for Profile_Add*, only read the clock when the profiler is on
+#define Profile_Start()	(profile_enabled ? Sys_Nanoseconds() : 0)
+
+void Profile_Reset();
+void Profile_BeginFrame();
+void Profile_EndFrame();
+void Profile_AddPhase(int32_t phase, int64_t start);
+void Profile_AddClass(int32_t classid, int64_t start);
+void Profile_CallThink(edict_t* ent);
+void Profile_CallTouch(edict_t* self, edict_t* other, cplane_t* plane, csurface_t* surf);
+void Profile_Print(int32_t count);
+trace_t Profile_Trace(const char* function, int32_t line, vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, edict_t* passent, int32_t contentmask);
+int32_t Profile_PointContents(const char* function, int32_t line, vec3_t point);
+
+// use these instead of gi.trace and gi.pointcontents so the profiler can tell which code made the query
+#define Game_Trace(start, mins, maxs, end, passent, contentmask) \
+	(profile_enabled ? Profile_Trace(__func__, __LINE__, start, mins, maxs, end, passent, contentmask) \
+		: TraceCache_Trace(start, mins, maxs, end, passent, contentmask))
+#define Game_PointContents(point) \
+	(profile_enabled ? Profile_PointContents(__func__, __LINE__, point) : gi.pointcontents(point))
+
+//
+// game_arena.c
+//
+void FrameArena_Reset();
+void* FrameArena_Alloc(int32_t size);
+int32_t FrameArena_Mark();
+void FrameArena_Release(int32_t mark);
+void FrameArena_PrintStats();
+
+// count uninitialised scratch elements of type, free them with FrameArena_Release
+#define FrameArena_Array(type, count)	((type*)FrameArena_Alloc((int32_t)sizeof(type) * (int32_t)(count)))
+
+//
+// game_strings.c
+//
+void StringPool_Reset(int32_t size);
+char* StringPool_Intern(const char* s);
+bool StringPool_Owns(const char* s);
+void StringPool_PrintStats();
+
+// Level_Write and Level_Read's table of every saved string
+void StringTable_Begin();
+void StringTable_Add(char* s);
+int32_t StringTable_Index(char* s);
+void StringTable_Write(FILE* f);
+void StringTable_Read(FILE* f);
+char* StringTable_Get(int32_t index);
+void StringTable_End();
+
+//
+// game_trace.c
+//
+extern bool trace_enabled;
+
+// scoped timeline events for "sv trace", every Trace_Begin needs a Trace_End
+#define Trace_Begin(name, arg)	(trace_enabled ? Trace_BeginEvent(name, arg) : (void)0)
+#define Trace_End()				(trace_enabled ? Trace_EndEvent() : (void)0)
+
+void Trace_BeginEvent(const char* name, int32_t arg);
+void Trace_EndEvent();
+void Trace_EndFrame();
+void Trace_Flush();
+void Trace_Start(int32_t frames, char* filename);
+void Trace_Stop();
+
+//
+// physics_spatial.c
+//
+void Spatial_Link(edict_t* ent);
+void Spatial_Unlink(edict_t* ent);
+void Spatial_Clear();
+int32_t Spatial_FindInRadius(vec3_t org, float radius, edict_t** list, int32_t maxcount);
+int32_t Spatial_BoxEdicts(vec3_t mins, vec3_t maxs, edict_t** list, int32_t maxcount, int32_t areatype);
+int32_t Spatial_FindNearest(vec3_t org, float maxdist, edict_t** list, int32_t count, bool (*filter)(edict_t* ent));
+void Spatial_Benchmark(int32_t count);
+
+//
+// physics_tracecache.c
+//
+void TraceCache_Invalidate(edict_t* ent, bool linking);
+void TraceCache_Clear();
+void TraceCache_EndFrame();
+trace_t TraceCache_Trace(vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, edict_t* passent, int32_t contentmask);
+void TraceCache_PrintStats();
+void Edict_SetNextThink(edict_t* ent, float time);
+void Edict_Wake(edict_t* ent);
+
+//
+// entity_base.c
+//
+void	ED_InitHashes();
+
+//
+// entity_class.c
+//
+void	Class_Init();
+void	Class_Clear();
+void	Class_Rebuild();
+void	Class_Unlink(edict_t* ent);
+int32_t	Class_Find(char* name);
+int32_t	Class_Intern(char* name);
+char*	Class_Name(int32_t id);
+int32_t	Class_Count(int32_t classid);
+void	Edict_SetClassname(edict_t* ent, char* classname);
+edict_t* Edict_FindByClass(edict_t* from, int32_t classid);
 
 //
 // game_save.c
@@ -1011,9 +1406,9 @@ typedef struct gclient_s
 	client_respawn_t	resp;
 	pmove_state_t		old_pmove;	// for detecting out-of-pmove changes
 
-	loadout_t	loadout;
-	loadout_entry_t* loadout_current_weapon;
-	loadout_entry_t* loadout_current_ammo;
+	gloadout_t	loadout;
+	gloadout_entry_t* loadout_current_weapon;
+	gloadout_entry_t* loadout_current_ammo;
 
 	int32_t		buttons;
 	int32_t		oldbuttons;
@@ -1128,14 +1523,21 @@ struct edict_s
 	// only used locally in game, not by server
 	//
 	char*		message;
-	char*		classname;
+	char*		classname;		// change with Edict_SetClassname so classid stays valid
+	int32_t		classid;		// interned classname
+	bool		class_linked;	// in the live list for classid
+	edict_t*	class_prev;
+	edict_t*	class_next;
 	int32_t		spawnflags;
 
 	float		timestamp;
 
 	float		angle;			// set in level editor, -1 = up, -2 = down
 	char*		target;
-	char*		targetname;
+	char*		targetname;		// change with Edict_SetTargetname so the index stays valid
+	edict_t*	targetname_next;	// next edict in the same targetname bucket
+	int32_t		targetname_bucket;
+	bool		targetname_linked;
 	char*		killtarget;
 
 	char*		pathtarget;
@@ -1160,6 +1562,28 @@ struct edict_s
 	float		ideal_yaw;
 
 	float		nextthink;
+	int32_t		think_tick;			// level.framenum the think wheel fires on
+	int32_t		think_slot;			// think wheel slot, only valid if think_queued
+	bool		think_queued;		// filed in the think wheel
+	bool		think_asleep;		// skipped by G_RunFrame until its think fires or it is relinked
+	edict_t*	think_carried;		// first of the entities that went to sleep on it
+	edict_t*	think_carrier;		// the entity it is on the carried list of
+	edict_t*	think_carried_prev;
+	edict_t*	think_carried_next;
+	int32_t		think_rest;			// frames it has sat still on the ground
+	edict_t*	think_prev;
+	edict_t*	think_next;
+	int32_t		spatial_bucket;		// spatial hash bucket, only valid if spatial_linked and not spatial_large
+	int32_t		spatial_query;		// last spatial query that visited this edict
+	bool		spatial_linked;		// filed in the spatial hash
+	bool		spatial_large;		// too big for its cell, kept in the large list instead
+	edict_t*	spatial_prev;
+	edict_t*	spatial_next;
+	bool		gib_pooled;			// a gib or debris from GibPool_Spawn
+	edict_t*	gib_prev;			// older pooled gib
+	edict_t*	gib_next;			// newer pooled gib
+	bool		projectile_pooled;	// in the projectile slab, run by ProjectilePool_RunFrame
+	int32_t		batch_slot;			// ballistic mirror entry + 1, 0 if not in it
 	void		(*prethink) (edict_t* ent);
 	void		(*think)(edict_t* self);
 	void		(*blocked)(edict_t* self, edict_t* other);	//move to moveinfo?
@@ -1211,18 +1635,6 @@ struct edict_s
 
 	int32_t		jump_height; // for func_trampoline
 
-	int32_t 	angles_spread;		// func_particle_effect angle spread
-	color4_t	color;
-	// TODO: MAKE THIS A COLOR4_T!!!!!
-	color3_t	color_run;			// func_particle_effect run
-	int32_t		particle_effect;	// func_particle_effect tempent ID
-	int32_t		particle_rate;		// func_particle_effect rate
-	int32_t		particle_lifetime;	// func_particle_effect lifetime (ignored if spawnflags & 2)
-	int32_t		particle_magnitude;	// func_particle_effect magnitude
-	int32_t		particles_next_frame;	// func_particle_effect next frame particles
-
-	float		alphavel;			// func_particle_effect alphavel
-
 	// timing variables
 	float		wait;
 	float		delay;			// before firing targets
@@ -1248,9 +1660,10 @@ struct edict_s
 	// waves mode 
 	uint32_t	money;			// the amount of money that you have
 
-	// common data blocks
-	moveinfo_t		moveinfo;
-	monsterinfo_t	monsterinfo;
+	// common data blocks, from the component pools, NULL if it doesn't have one
+	moveinfo_t*				moveinfo;
+	monsterinfo_t*			monsterinfo;
+	particle_emitter_t*		particles;		// func_particle_effect
 };
 
 // Gamemode-specific stuff
@@ -1275,8 +1688,10 @@ void Weapon_Generic(edict_t* ent, int32_t frame_activate_last, int32_t frame_fir
 	int32_t* pause_frames, int32_t* fire_frames_primary, int32_t* fire_frames_secondary, void (*fire_primary)(edict_t* ent), void(*fire_secondary)(edict_t* ent));
 
 // game_loadout.c
-loadout_entry_t* Loadout_AddItem(edict_t* ent, const char* item_name, const char* icon, loadout_entry_type type, int32_t amount);		// Adds the loadout item with the name name, the icon icon and the amount amount. Returns the new loadout item
+gloadout_entry_t* Loadout_AddItem(edict_t* ent, const char* item_name, const char* icon, loadout_entry_type type, int32_t amount);		// Adds the loadout item with the name name, the icon icon and the amount amount. Returns the new loadout item
 void			Loadout_DeleteItem(edict_t* ent, const char* item_name);				// Deletes the loadout item with the name name.
-loadout_entry_t* Loadout_GetItem(edict_t* ent, const char* item_name);		// Returns the loadout item with the name item_name.
-bool			Loadout_EntryIsItem(loadout_entry_t* entry, const char* item_name);	// Determines if the loadout entry entry is the item with the name item_name.
+gloadout_entry_t* Loadout_GetItem(edict_t* ent, const char* item_name);		// Returns the loadout item with the name item_name.
+gloadout_entry_t* Loadout_FindItem(edict_t* ent, gitem_t* item);				// Returns the loadout entry holding item.
+bool			Loadout_EntryIsItem(gloadout_entry_t* entry, const char* item_name);	// Determines if the loadout entry entry is the item with the name item_name.
+gitem_t*		Loadout_EntryGetItem(gloadout_entry_t* entry);							// Returns the item the loadout entry entry holds, or NULL.
 
@@ -67,7 +67,7 @@ void ChaseCam_Update(edict_t* ent)
 	if (!targ->groundentity)
 		o[2] += 16;
 
-	trace = gi.trace(ownerv, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
+	trace = Game_Trace(ownerv, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
 
 	VectorCopy3(trace.endpos, goal);
 
@@ -76,7 +76,7 @@ void ChaseCam_Update(edict_t* ent)
 	// pad for floors and ceilings
 	VectorCopy3(goal, o);
 	o[2] += 6;
-	trace = gi.trace(goal, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
+	trace = Game_Trace(goal, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
 	if (trace.fraction < 1) {
 		VectorCopy3(trace.endpos, goal);
 		goal[2] -= 6;
@@ -84,7 +84,7 @@ void ChaseCam_Update(edict_t* ent)
 
 	VectorCopy3(goal, o);
 	o[2] -= 6;
-	trace = gi.trace(goal, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
+	trace = Game_Trace(goal, vec3_origin, vec3_origin, o, targ, MASK_SOLID);
 	if (trace.fraction < 1) {
 		VectorCopy3(trace.endpos, goal);
 		goal[2] += 6;
@@ -113,7 +113,7 @@ void ChaseCam_Update(edict_t* ent)
 
 	ent->viewheight = 0;
 	ent->client->ps.pmove.pm_flags |= PMF_NO_PREDICTION;
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 void ChaseCam_Next(edict_t* ent)
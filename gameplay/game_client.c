@@ -29,9 +29,15 @@ edict_t* pm_passent;
 trace_t	PM_trace(vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end)
 {
 	if (pm_passent->health > 0)
-		return gi.trace(start, mins, maxs, end, pm_passent, MASK_PLAYERSOLID);
+		return Game_Trace(start, mins, maxs, end, pm_passent, MASK_PLAYERSOLID);
 	else
-		return gi.trace(start, mins, maxs, end, pm_passent, MASK_DEADSOLID);
+		return Game_Trace(start, mins, maxs, end, pm_passent, MASK_DEADSOLID);
+}
+
+// so the profiler can see pmove's contents checks
+int32_t PM_pointcontents(vec3_t point)
+{
+	return Game_PointContents(point);
 }
 
 
@@ -140,7 +146,7 @@ void Client_Think(edict_t* ent, usercmd_t* ucmd)
 
 		pm.cmd = *ucmd;
 		pm.trace = PM_trace;	// adds default parms
-		pm.pointcontents = gi.pointcontents;
+		pm.pointcontents = PM_pointcontents;
 
 		VectorCopy3(client->ps.vieworigin, pm.vieworigin);
 
@@ -214,7 +220,7 @@ void Client_Think(edict_t* ent, usercmd_t* ucmd)
 			VectorCopy3(pm.viewangles, client->ps.viewangles);
 		}
 
-		gi.Edict_Link(ent);
+		Edict_Link(ent);
 
 		if (ent->movetype != MOVETYPE_NOCLIP)
 			Edict_TouchTriggers(ent);
@@ -230,7 +236,7 @@ void Client_Think(edict_t* ent, usercmd_t* ucmd)
 				continue;	// duplicated
 			if (!other->touch)
 				continue;
-			other->touch(other, ent, NULL, NULL);
+			Profile_CallTouch(other, ent, NULL, NULL);
 		}
 	}
 
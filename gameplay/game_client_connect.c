@@ -228,11 +228,12 @@ void Client_Disconnect(edict_t* ent)
 	gi.WriteByte(MZ_LOGOUT);
 	gi.multicast(ent->s.origin, MULTICAST_PVS);
 
-	gi.Edict_Unlink(ent);
+	Edict_Unlink(ent);
 	ent->s.modelindex = 0;
 	ent->solid = SOLID_NOT;
 	ent->inuse = false;
-	ent->classname = "disconnected";
+	EdictList_Remove(ent);
+	Edict_SetClassname(ent, "disconnected");
 	ent->client->pers.connected = false;
 
 	playernum = ent - g_edicts - 1;
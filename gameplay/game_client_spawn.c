@@ -186,7 +186,7 @@ edict_t* Player_SpawnSelectUnassigned()
 {
 	edict_t* spot = NULL;
 
-	while ((spot = Game_FindEdictByValue(spot, FOFS(classname), "info_player_start")) != NULL)
+	while ((spot = Edict_FindByClass(spot, CLASS_INFO_PLAYER_START)) != NULL)
 	{
 		if (!game.spawnpoint[0] && !spot->targetname)
 			return spot;
@@ -202,7 +202,7 @@ edict_t* Player_SpawnSelectUnassigned()
 	{
 		if (!game.spawnpoint[0])
 		{	// there wasn't a spawnpoint without a target, so use any
-			spot = Game_FindEdictByValue(spot, FOFS(classname), "info_player_start");
+			spot = Edict_FindByClass(spot, CLASS_INFO_PLAYER_START);
 		}
 
 		// if it's still not there, die
@@ -228,13 +228,15 @@ edict_t* Player_SpawnSelectRandom(char* spawn_class_name)
 	edict_t* spot, * spot1, * spot2;
 	int		count = 0;
 	int		selection;
+	int32_t	spawn_class;
 	float	AI_GetRange, range1, range2;
 
+	spawn_class = Class_Find(spawn_class_name);
 	spot = NULL;
 	range1 = range2 = 99999;
 	spot1 = spot2 = NULL;
 
-	while ((spot = Game_FindEdictByValue(spot, FOFS(classname), spawn_class_name)) != NULL)
+	while ((spot = Edict_FindByClass(spot, spawn_class)) != NULL)
 	{
 		count++;
 		AI_GetRange = PlayersRangeFromSpot(spot);
@@ -270,7 +272,7 @@ edict_t* Player_SpawnSelectRandom(char* spawn_class_name)
 	spot = NULL;
 	do
 	{
-		spot = Game_FindEdictByValue(spot, FOFS(classname), spawn_class_name);
+		spot = Edict_FindByClass(spot, spawn_class);
 		if (spot == spot1 || spot == spot2)
 			selection++;
 	} while (selection--);
@@ -288,6 +290,7 @@ edict_t* Player_SpawnSelectFarthest(char* spawn_class_name)
 	edict_t* bestspot;
 	float	bestdistance, bestplayerdistance;
 	edict_t* spot;
+	int32_t	spawn_class;
 
 	if (spawn_class_name == NULL)
 	{
@@ -295,10 +298,11 @@ edict_t* Player_SpawnSelectFarthest(char* spawn_class_name)
 		return NULL;
 	}
 
+	spawn_class = Class_Find(spawn_class_name);
 	spot = NULL;
 	bestspot = NULL;
 	bestdistance = 0;
-	while ((spot = Game_FindEdictByValue(spot, FOFS(classname), spawn_class_name)) != NULL)
+	while ((spot = Edict_FindByClass(spot, spawn_class)) != NULL)
 	{
 		bestplayerdistance = PlayersRangeFromSpot(spot);
 
@@ -314,7 +318,7 @@ edict_t* Player_SpawnSelectFarthest(char* spawn_class_name)
 
 	// if there is a player just spawned on each and every start spot
 	// we have no choice to turn one into a telefrag meltdown
-	spot = Game_FindEdictByValue(NULL, FOFS(classname), spawn_class_name);
+	spot = Edict_FindByClass(NULL, spawn_class);
 
 	// still null? try unassigned
 	if (spot == NULL)
@@ -433,7 +437,7 @@ void Client_InitBodyQue()
 	for (i = 0; i < BODY_QUEUE_SIZE; i++)
 	{
 		ent = Edict_Spawn();
-		ent->classname = "bodyque";
+		Edict_SetClassname(ent, "bodyque");
 	}
 }
 
@@ -462,9 +466,9 @@ void Player_CopyToBodyQue(edict_t* ent)
 
 	// FIXME: send an effect on the removed body
 
-	gi.Edict_Unlink(ent);
+	Edict_Unlink(ent);
 
-	gi.Edict_Unlink(body);
+	Edict_Unlink(body);
 	body->s = ent->s;
 	body->s.number = body - g_edicts;
 
@@ -482,7 +486,7 @@ void Player_CopyToBodyQue(edict_t* ent)
 	body->die = body_die;
 	body->takedamage = DAMAGE_YES;
 
-	gi.Edict_Link(body);
+	Edict_Link(body);
 }
 
 
@@ -649,7 +653,8 @@ void Client_JoinServer(edict_t* ent)
 	ent->movetype = MOVETYPE_WALK;
 	ent->viewheight = 22;
 	ent->inuse = true;
-	ent->classname = "player";
+	EdictList_Add(ent);
+	Edict_SetClassname(ent, "player");
 	ent->mass = 200;
 	ent->solid = SOLID_BBOX;
 	ent->deadflag = DEAD_NO;
@@ -721,7 +726,7 @@ void Client_JoinServer(edict_t* ent)
 		ent->solid = SOLID_NOT;
 		ent->svflags |= SVF_NOCLIENT;
 		ent->client->ps.gunindex = 0;
-		gi.Edict_Link(ent);
+		Edict_Link(ent);
 		return;
 	}
 	else
@@ -731,7 +736,7 @@ void Client_JoinServer(edict_t* ent)
 	{	// could't spawn in?
 	}
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 
 	// force the current weapon up
 	client->newweapon = client->pers.weapon;
@@ -426,7 +426,7 @@ void Client_CalcBlend(edict_t* ent)
 
 	// add for contents
 	VectorAdd3(ent->s.origin, ent->client->ps.viewoffset, vieworg);
-	contents = gi.pointcontents(vieworg);
+	contents = Game_PointContents(vieworg);
 	if (contents & (CONTENTS_LAVA | CONTENTS_SLIME | CONTENTS_WATER))
 		ent->client->ps.rdflags |= RDF_UNDERWATER;
 	else
@@ -42,13 +42,13 @@ void Player_SelectNextItem(edict_t* ent, int32_t itflags)
 		return;
 
 	// new loadout system...
-	loadout_entry_t* loadout_entry_ptr = &cl->loadout_current_weapon;
+	gloadout_entry_t* loadout_entry_ptr = &cl->loadout_current_weapon;
 
 	for (int32_t item_num = 0; item_num < cl->loadout.num_items; item_num++)
 	{
-		loadout_entry_t* loadout_entry_ptr = &cl->loadout.items[item_num];
+		gloadout_entry_t* loadout_entry_ptr = &cl->loadout.items[item_num];
 
-		it = Item_FindByPickupName(loadout_entry_ptr->item_name);
+		it = Loadout_EntryGetItem(loadout_entry_ptr);
 
 		if (it == NULL)
 			continue;
@@ -61,7 +61,7 @@ void Player_SelectNextItem(edict_t* ent, int32_t itflags)
 
 		// make sure we are actually selecting it
 		//  cycle if its the first item
-		if (!strncmp(cl->loadout.client_current_item->item_name, it->pickup_name, LOADOUT_MAX_STRLEN))
+		if (cl->loadout.client_current_item->item_index == ITEM_INDEX(it))
 		{
 			int32_t new_item_num = item_num + 1;
 			if (new_item_num > cl->loadout.num_items) new_item_num = 0;
@@ -93,13 +93,13 @@ void Player_SelectPrevItem(edict_t* ent, int32_t itflags)
 		return;
 
 	// new loadout system...
-	loadout_entry_t* loadout_entry_ptr = &cl->loadout_current_weapon;
+	gloadout_entry_t* loadout_entry_ptr = &cl->loadout_current_weapon;
 
 	for (int32_t item_num = 0; item_num < cl->loadout.num_items; item_num++)
 	{
-		loadout_entry_t* loadout_entry_ptr = &cl->loadout.items[item_num];
+		gloadout_entry_t* loadout_entry_ptr = &cl->loadout.items[item_num];
 
-		it = Item_FindByPickupName(loadout_entry_ptr->item_name);
+		it = Loadout_EntryGetItem(loadout_entry_ptr);
 
 		if (it == NULL)
 			continue;
@@ -111,7 +111,7 @@ void Player_SelectPrevItem(edict_t* ent, int32_t itflags)
 			continue;
 
 		// cycle if its the first item
-		if (!strncmp(cl->loadout.client_current_item->item_name, it->pickup_name, LOADOUT_MAX_STRLEN))
+		if (cl->loadout.client_current_item->item_index == ITEM_INDEX(it))
 		{
 			int32_t new_item_num = item_num - 1;
 			if (new_item_num < 0) new_item_num = cl->loadout.num_items;
@@ -210,7 +210,7 @@ void Client_CommandGive(edict_t* ent)
 		info = (gitem_armor_t*)it->info;
 
 		// see if you already have it
-		loadout_entry_t* body_armor_ptr = Loadout_GetItem(ent, it->pickup_name);
+		gloadout_entry_t* body_armor_ptr = Loadout_FindItem(ent, it);
 
 		// if its not there add it, otherwise set it to max_count
 		if (!body_armor_ptr)
@@ -230,7 +230,7 @@ void Client_CommandGive(edict_t* ent)
 	{
 		it = Item_FindByPickupName("Power Shield");
 		it_ent = Edict_Spawn();
-		it_ent->classname = it->classname;
+		Edict_SetClassname(it_ent, it->classname);
 		Item_Spawn(it_ent, it);
 		Item_OnTouch(it_ent, ent, NULL, NULL);
 		if (it_ent->inuse)
@@ -273,7 +273,7 @@ void Client_CommandGive(edict_t* ent)
 		return;
 	}
 
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, it->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(ent, it);
 
 	if (it->flags & IT_AMMO)
 	{
@@ -285,7 +285,7 @@ void Client_CommandGive(edict_t* ent)
 	else
 	{
 		it_ent = Edict_Spawn();
-		it_ent->classname = it->classname;
+		Edict_SetClassname(it_ent, it->classname);
 		Item_Spawn(it_ent, it);
 		Item_OnTouch(it_ent, ent, NULL, NULL);
 		if (it_ent->inuse)
@@ -413,7 +413,7 @@ void Client_CommandUse(edict_t* ent)
 		return;
 	}
 
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, it->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(ent, it);
 
 	if (loadout_entry_ptr == NULL
 		|| !loadout_entry_ptr->amount)
@@ -526,7 +526,7 @@ void Client_CommandLoadout(edict_t* ent)
 		if (&ent->client->loadout.items[index] != ent->client->loadout_current_weapon)
 		{
 			ent->client->loadout_current_weapon = &ent->client->loadout.items[index];
-			ent->client->newweapon = Item_FindByPickupName(ent->client->loadout.items[index].item_name);
+			ent->client->newweapon = Loadout_EntryGetItem(&ent->client->loadout.items[index]);
 			Player_WeaponChange(ent);
 		}
 	}
@@ -547,8 +547,7 @@ void Client_CommandDrop(edict_t* ent)
 {
 	gitem_t* it;
 	char* s;
-
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, it->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr;
 
 	s = gi.Cmd_Args();
 	it = Item_FindByPickupName(s);
@@ -562,7 +561,11 @@ void Client_CommandDrop(edict_t* ent)
 		gi.cprintf(ent, PRINT_HIGH, "Item is not dropable.\n");
 		return;
 	}
-	if (loadout_entry_ptr->amount == 0)
+
+	loadout_entry_ptr = Loadout_FindItem(ent, it);
+
+	if (!loadout_entry_ptr
+		|| loadout_entry_ptr->amount == 0)
 	{
 		gi.cprintf(ent, PRINT_HIGH, "Out of item: %s\n", s);
 		return;
@@ -587,7 +590,7 @@ void Client_CommandInvUse(edict_t* ent)
 		return;
 	}
 
-	it = Item_FindByPickupName(ent->client->loadout_current_weapon->item_name);
+	it = Loadout_EntryGetItem(ent->client->loadout_current_weapon);
 
 	if (!it->use)
 	{
@@ -614,13 +617,13 @@ void Client_CommandWeapPrev(edict_t* ent)
 		return;
 
 	// new loadout system...
-	loadout_entry_t* loadout_entry_ptr = &cl->loadout_current_weapon;
+	gloadout_entry_t* loadout_entry_ptr = &cl->loadout_current_weapon;
 
 	for (int32_t item_num = 0; item_num < cl->loadout.num_items; item_num++)
 	{
-		loadout_entry_t* loadout_entry_ptr = &cl->loadout.items[item_num];
+		gloadout_entry_t* loadout_entry_ptr = &cl->loadout.items[item_num];
 
-		it = Item_FindByPickupName(loadout_entry_ptr->item_name);
+		it = Loadout_EntryGetItem(loadout_entry_ptr);
 
 		if (it == NULL)
 			continue;
@@ -662,13 +665,13 @@ void Client_CommandWeapNext(edict_t* ent)
 		return;
 
 	// new loadout system...
-	loadout_entry_t* loadout_entry_ptr = &cl->loadout_current_weapon;
+	gloadout_entry_t* loadout_entry_ptr = &cl->loadout_current_weapon;
 
 	for (int32_t item_num = 0; item_num < cl->loadout.num_items; item_num++)
 	{
-		loadout_entry_t* loadout_entry_ptr = &cl->loadout.items[item_num];
+		gloadout_entry_t* loadout_entry_ptr = &cl->loadout.items[item_num];
 
-		it = Item_FindByPickupName(loadout_entry_ptr->item_name);
+		it = Loadout_EntryGetItem(loadout_entry_ptr);
 
 		if (it == NULL)
 			continue;
@@ -708,7 +711,7 @@ void Client_CommandWeapLast(edict_t* ent)
 	if (!cl->pers.weapon || !cl->pers.lastweapon)
 		return;
 
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, cl->pers.lastweapon->pickup_name);
+	gloadout_entry_t* loadout_entry_ptr = Loadout_FindItem(ent, cl->pers.lastweapon);
 
 	it = Item_FindByPickupName(cl->pers.lastweapon->pickup_name);
 	if (!it->use)
@@ -733,7 +736,7 @@ void Command_ClientInvDrop(edict_t* ent)
 		return;
 	}
 
-	it = Item_FindByPickupName(ent->client->loadout_current_weapon->item_name);
+	it = Loadout_EntryGetItem(ent->client->loadout_current_weapon);
 
 	if (!it->use)
 	{
@@ -272,6 +272,82 @@ void SVCmd_WriteIP_f()
 	fclose(f);
 }
 
+/*
+=================
+Server_CommandStats
+
+Prints entity allocation, gib and projectile pool, physics batch, component, frame arena, level string, trace cache and sight stats
+=================
+*/
+void Server_CommandStats()
+{
+	Edict_PrintStats();
+	GibPool_PrintStats();
+	ProjectilePool_PrintStats();
+	Batch_PrintStats();
+	Component_PrintStats();
+	FrameArena_PrintStats();
+	StringPool_PrintStats();
+	TraceCache_PrintStats();
+	AI_PrintSightStats();
+}
+
+/*
+=================
+Server_CommandSpatialBench
+
+Times spatial hash radius queries against the linear scan
+sv spatialbench [count]
+=================
+*/
+void Server_CommandSpatialBench()
+{
+	if (!g_edicts[0].inuse)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "spatialbench needs a level to be loaded\n");
+		return;
+	}
+
+	Spatial_Benchmark(gi.Cmd_Argc() > 2 ? atoi(gi.Cmd_Argv(2)) : 0);
+}
+
+/*
+=================
+Server_CommandProfile
+
+sv profile [count]
+sv profile reset
+=================
+*/
+void Server_CommandProfile()
+{
+	if (!Q_stricmp(gi.Cmd_Argv(2), "reset"))
+	{
+		Profile_Reset();
+		return;
+	}
+
+	Profile_Print(atoi(gi.Cmd_Argv(2)));
+}
+
+/*
+=================
+Server_CommandTrace
+
+sv trace start [frames] [filename]
+sv trace stop
+=================
+*/
+void Server_CommandTrace()
+{
+	if (!Q_stricmp(gi.Cmd_Argv(2), "start"))
+		Trace_Start(atoi(gi.Cmd_Argv(3)), gi.Cmd_Argv(4));
+	else if (!Q_stricmp(gi.Cmd_Argv(2), "stop"))
+		Trace_Stop();
+	else
+		gi.cprintf(NULL, PRINT_HIGH, "Usage: sv trace start [frames] [filename] or sv trace stop\n");
+}
+
 /*
 =================
 ServerCommand
@@ -294,6 +370,16 @@ void Server_Command()
 		Server_CommandListIP();
 	else if (Q_stricmp(cmd, "writeip") == 0)
 		SVCmd_WriteIP_f();
+	else if (Q_stricmp(cmd, "stats") == 0)
+		Server_CommandStats();
+	else if (Q_stricmp(cmd, "spatialbench") == 0)
+		Server_CommandSpatialBench();
+	else if (Q_stricmp(cmd, "profile") == 0)
+		Server_CommandProfile();
+	else if (Q_stricmp(cmd, "trace") == 0)
+		Server_CommandTrace();
+	else if (Q_stricmp(cmd, "nav") == 0)
+		Nav_PrintStats();
 	else
 		gi.cprintf(NULL, PRINT_HIGH, "Unknown server command \"%s\"\n", cmd);
 }
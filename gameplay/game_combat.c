@@ -43,7 +43,7 @@ bool Player_CanDamage(edict_t* targ, edict_t* inflictor)
 	{
 		VectorAdd3(targ->absmin, targ->absmax, dest);
 		VectorScale3(dest, 0.5, dest);
-		trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin, dest, inflictor, MASK_SOLID);
+		trace = Game_Trace(inflictor->s.origin, vec3_origin, vec3_origin, dest, inflictor, MASK_SOLID);
 		if (trace.fraction == 1.0)
 			return true;
 		if (trace.ent == targ)
@@ -51,35 +51,35 @@ bool Player_CanDamage(edict_t* targ, edict_t* inflictor)
 		return false;
 	}
 
-	trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin, targ->s.origin, inflictor, MASK_SOLID);
+	trace = Game_Trace(inflictor->s.origin, vec3_origin, vec3_origin, targ->s.origin, inflictor, MASK_SOLID);
 	if (trace.fraction == 1.0)
 		return true;
 
 	VectorCopy3(targ->s.origin, dest);
 	dest[0] += 15.0;
 	dest[1] += 15.0;
-	trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin, dest, inflictor, MASK_SOLID);
+	trace = Game_Trace(inflictor->s.origin, vec3_origin, vec3_origin, dest, inflictor, MASK_SOLID);
 	if (trace.fraction == 1.0)
 		return true;
 
 	VectorCopy3(targ->s.origin, dest);
 	dest[0] += 15.0;
 	dest[1] -= 15.0;
-	trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin, dest, inflictor, MASK_SOLID);
+	trace = Game_Trace(inflictor->s.origin, vec3_origin, vec3_origin, dest, inflictor, MASK_SOLID);
 	if (trace.fraction == 1.0)
 		return true;
 
 	VectorCopy3(targ->s.origin, dest);
 	dest[0] -= 15.0;
 	dest[1] += 15.0;
-	trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin, dest, inflictor, MASK_SOLID);
+	trace = Game_Trace(inflictor->s.origin, vec3_origin, vec3_origin, dest, inflictor, MASK_SOLID);
 	if (trace.fraction == 1.0)
 		return true;
 
 	VectorCopy3(targ->s.origin, dest);
 	dest[0] -= 15.0;
 	dest[1] -= 15.0;
-	trace = gi.trace(inflictor->s.origin, vec3_origin, vec3_origin, dest, inflictor, MASK_SOLID);
+	trace = Game_Trace(inflictor->s.origin, vec3_origin, vec3_origin, dest, inflictor, MASK_SOLID);
 	if (trace.fraction == 1.0)
 		return true;
 
@@ -102,7 +102,7 @@ void Killed(edict_t* targ, edict_t* inflictor, edict_t* attacker, int32_t damage
 	if ((targ->svflags & SVF_MONSTER) && (targ->deadflag != DEAD_DEAD))
 	{
 		//		targ->svflags |= SVF_DEADMONSTER;	// now treat as a different content type
-		if (!(targ->monsterinfo.aiflags & AI_GOOD_GUY))
+		if (!(targ->monsterinfo->aiflags & AI_GOOD_GUY))
 		{
 			level.killed_monsters++;
 
@@ -121,7 +121,7 @@ void Killed(edict_t* targ, edict_t* inflictor, edict_t* attacker, int32_t damage
 			}
 
 			// medics won't heal monsters that they kill themselves
-			if (strcmp(attacker->classname, "monster_medic") == 0)
+			if (attacker->classid == CLASS_MONSTER_MEDIC)
 				targ->owner = attacker;
 		}
 	}
@@ -189,7 +189,7 @@ static int32_t CheckPowerArmor(edict_t* ent, vec3_t point, vec3_t normal, int32_
 	gclient_t* client;
 	int32_t		save = 0;
 	int32_t		power_armor_type = 0;
-	loadout_entry_t* loadout_ptr_cells = NULL;
+	gloadout_entry_t* loadout_ptr_cells = NULL;
 	int32_t		damage_per_cell = 0;
 	int32_t		temp_entity_type = 0;
 	int32_t		power = 0;
@@ -215,8 +215,8 @@ static int32_t CheckPowerArmor(edict_t* ent, vec3_t point, vec3_t normal, int32_
 	}
 	else if (ent->svflags & SVF_MONSTER)
 	{
-		power_armor_type = ent->monsterinfo.power_armor_type;
-		power = ent->monsterinfo.power_armor_power;
+		power_armor_type = ent->monsterinfo->power_armor_type;
+		power = ent->monsterinfo->power_armor_power;
 	}
 	else
 		return 0;
@@ -249,7 +249,7 @@ static int32_t CheckPowerArmor(edict_t* ent, vec3_t point, vec3_t normal, int32_
 	if (client)
 		loadout_ptr_cells -= power_used;
 	else
-		ent->monsterinfo.power_armor_power -= power_used;
+		ent->monsterinfo->power_armor_power -= power_used;
 	return save;
 }
 
@@ -257,7 +257,7 @@ static int32_t CheckArmor(edict_t* ent, vec3_t point, vec3_t normal, int32_t dam
 {
 	gclient_t* client;
 	int32_t			save;
-	loadout_entry_t* current_armor = Armor_GetCurrent(ent);
+	gloadout_entry_t* current_armor = Armor_GetCurrent(ent);
 	gitem_t* armor;
 
 	if (!damage)
@@ -274,7 +274,7 @@ static int32_t CheckArmor(edict_t* ent, vec3_t point, vec3_t normal, int32_t dam
 	if (!current_armor)
 		return 0;
 
-	armor = Item_FindByPickupName(current_armor->item_name);
+	armor = Loadout_EntryGetItem(current_armor);
 
 	if (dflags & DAMAGE_ENERGY)
 		save = ceilf(((gitem_armor_t*)armor->info)->energy_protection * (float)damage);
@@ -303,9 +303,9 @@ void M_ReactToDamage(edict_t* targ, edict_t* attacker)
 
 	// if we are a good guy monster and our attacker is a player
 	// or another good guy, do not get mad at them
-	if (targ->monsterinfo.aiflags & AI_GOOD_GUY)
+	if (targ->monsterinfo->aiflags & AI_GOOD_GUY)
 	{
-		if (attacker->client || (attacker->monsterinfo.aiflags & AI_GOOD_GUY))
+		if (attacker->client || (attacker->monsterinfo->aiflags & AI_GOOD_GUY))
 			return;
 	}
 
@@ -314,7 +314,7 @@ void M_ReactToDamage(edict_t* targ, edict_t* attacker)
 	// if attacker is a client, get mad at them because he's good and we're not
 	if (attacker->client)
 	{
-		targ->monsterinfo.aiflags &= ~AI_SOUND_TARGET;
+		targ->monsterinfo->aiflags &= ~AI_SOUND_TARGET;
 
 		// this can only happen in coop (both new and old enemies are clients)
 		// only switch if can't see the current enemy
@@ -328,7 +328,7 @@ void M_ReactToDamage(edict_t* targ, edict_t* attacker)
 			targ->oldenemy = targ->enemy;
 		}
 		targ->enemy = attacker;
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ->monsterinfo->aiflags & AI_DUCKED))
 			AI_FoundTarget(targ);
 		return;
 	}
@@ -336,12 +336,12 @@ void M_ReactToDamage(edict_t* targ, edict_t* attacker)
 	// it's the same base (walk/swim/fly) type and a different classname and it's not a tank
 	// (they spray too much), get mad at them
 	if (((targ->flags & (FL_FLY | FL_SWIM)) == (attacker->flags & (FL_FLY | FL_SWIM))) &&
-		(strcmp(targ->classname, attacker->classname) != 0))
+		(targ->classid != attacker->classid))
 	{
 		if (targ->enemy && targ->enemy->client)
 			targ->oldenemy = targ->enemy;
 		targ->enemy = attacker;
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ->monsterinfo->aiflags & AI_DUCKED))
 			AI_FoundTarget(targ);
 	}
 	// if they *meant* to shoot us, then shoot back
@@ -350,7 +350,7 @@ void M_ReactToDamage(edict_t* targ, edict_t* attacker)
 		if (targ->enemy && targ->enemy->client)
 			targ->oldenemy = targ->enemy;
 		targ->enemy = attacker;
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ->monsterinfo->aiflags & AI_DUCKED))
 			AI_FoundTarget(targ);
 	}
 	// otherwise get mad at whoever they are mad at (help our buddy) unless it is us!
@@ -359,12 +359,12 @@ void M_ReactToDamage(edict_t* targ, edict_t* attacker)
 		if (targ->enemy && targ->enemy->client)
 			targ->oldenemy = targ->enemy;
 		targ->enemy = attacker->enemy;
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ->monsterinfo->aiflags & AI_DUCKED))
 			AI_FoundTarget(targ);
 	}
 }
 
-void Player_Damage(edict_t* targ, edict_t* inflictor, edict_t* attacker, vec3_t dir, vec3_t point, vec3_t normal, int32_t damage, int32_t knockback, int32_t dflags, int32_t mod)
+static void Player_ApplyDamage(edict_t* targ, edict_t* inflictor, edict_t* attacker, vec3_t dir, vec3_t point, vec3_t normal, int32_t damage, int32_t knockback, int32_t dflags, int32_t mod)
 {
 	gclient_t* client;
 	int32_t		take;
@@ -385,8 +385,8 @@ void Player_Damage(edict_t* targ, edict_t* inflictor, edict_t* attacker, vec3_t
 		// todo: gamemode def for more "dynamic" checks? probably stupid and overengineered
 
 		// hack! (if the target is a player and the attacker isn't)
-		if (!strcmp(targ->classname, "player")
-			&& strcmp(attacker->classname, "player"))
+		if (targ->classid == CLASS_PLAYER
+			&& attacker->classid != CLASS_PLAYER)
 		{
 			if (gamemode->value != GAMEMODE_COOP
 				&& gamemode->value != GAMEMODE_WAVES
@@ -478,6 +478,9 @@ void Player_Damage(edict_t* targ, edict_t* inflictor, edict_t* attacker, vec3_t
 		}
 	}
 
+	// knockback, or the damage killing it, may need it to start moving again
+	Edict_Wake(targ);
+
 	take = damage;
 	save = 0;
 
@@ -533,7 +536,7 @@ void Player_Damage(edict_t* targ, edict_t* inflictor, edict_t* attacker, vec3_t
 	if (targ->svflags & SVF_MONSTER)
 	{
 		M_ReactToDamage(targ, attacker);
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED) && (take))
+		if (!(targ->monsterinfo->aiflags & AI_DUCKED) && (take))
 		{
 			targ->pain(targ, attacker, knockback, take);
 			// nightmare mode monsters don't go into pain frames often
@@ -565,6 +568,20 @@ void Player_Damage(edict_t* targ, edict_t* inflictor, edict_t* attacker, vec3_t
 	}
 }
 
+/*
+============
+Player_Damage
+
+Applies the damage, marking it on the "sv trace" timeline
+============
+*/
+void Player_Damage(edict_t* targ, edict_t* inflictor, edict_t* attacker, vec3_t dir, vec3_t point, vec3_t normal, int32_t damage, int32_t knockback, int32_t dflags, int32_t mod)
+{
+	Trace_Begin("Player_Damage", targ - g_edicts);
+	Player_ApplyDamage(targ, inflictor, attacker, dir, point, normal, damage, knockback, dflags, mod);
+	Trace_End();
+}
+
 
 /*
 ============
@@ -574,12 +591,23 @@ T_RadiusDamage
 void Player_RadiusDamage(edict_t* inflictor, edict_t* attacker, float damage, edict_t* ignore, float radius, int32_t mod)
 {
 	float	points;
-	edict_t* ent = NULL;
+	edict_t* ent;
+	edict_t** touch;
+	int32_t	i, num, mark;
 	vec3_t	v;
 	vec3_t	dir;
 
-	while ((ent = Game_FindEdictsWithinRadius(ent, inflictor->s.origin, radius)) != NULL)
+	// gather them all first, damage can kill things and set off more radius damage
+	mark = FrameArena_Mark();
+	touch = FrameArena_Array(edict_t*, globals.num_edicts);
+	num = Spatial_FindInRadius(inflictor->s.origin, radius, touch, globals.num_edicts);
+
+	for (i = 0; i < num; i++)
 	{
+		ent = touch[i];
+
+		if (!ent->inuse)
+			continue;
 		if (ent == ignore)
 			continue;
 		if (!ent->takedamage)
@@ -600,6 +628,8 @@ void Player_RadiusDamage(edict_t* inflictor, edict_t* attacker, float damage, ed
 			}
 		}
 	}
+
+	FrameArena_Release(mark);
 }
 
 /* Player specific */
@@ -940,7 +970,7 @@ void Player_TossWeapon(edict_t* self)
 		drop->spawnflags |= DROPPED_PLAYER_ITEM;
 
 		drop->touch = Item_OnTouch;
-		drop->nextthink = level.time + (self->client->quad_framenum - level.framenum) * TICK_TIME;
+		Edict_SetNextThink(drop, level.time + (self->client->quad_framenum - level.framenum) * TICK_TIME);
 		drop->think = Edict_Free;
 	}
 }
@@ -1095,7 +1125,7 @@ void Player_Die(edict_t* self, edict_t* inflictor, edict_t* attacker, int32_t da
 
 	self->deadflag = DEAD_DEAD;
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 /*
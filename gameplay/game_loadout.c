@@ -22,22 +22,52 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 
 #include <game_local.h>
 
-loadout_entry_t* Loadout_AddItem(edict_t *ent, const char* name, const char* icon, loadout_entry_type type, int32_t amount)
+
+// The server side loadout only stores item indexes. item_slots maps an item index to the slot it is in,
+// but Weapon_Drop can cut num_items back underneath an entry, so it is only trusted after it has been checked.
+
+gloadout_entry_t* Loadout_AddItem(edict_t *ent, const char* name, const char* icon, loadout_entry_type type, int32_t amount)
 {
-	// don't crash if we're not connected
-	strncpy(ent->client->loadout.items[ent->client->loadout.num_items].item_name, name, LOADOUT_MAX_STRLEN);
-	strncpy(ent->client->loadout.items[ent->client->loadout.num_items].icon, icon, MAX_QPATH);
-	ent->client->loadout.items[ent->client->loadout.num_items].type = type;
-	ent->client->loadout.items[ent->client->loadout.num_items].amount = amount;
+	gloadout_t* loadout = &ent->client->loadout;
+	gloadout_entry_t* entry;
+	gloadout_entry_t* existing;
+	gitem_t* item;
+	int32_t slot;
+
+	if (loadout->num_items >= LOADOUT_MAX_ITEMS)
+	{
+		gi.error("Tried to add too many loadout entries (name: %s)!", name);
+		return NULL;
+	}
+
+	// loadout entries are named after the item's pickup name
+	item = Item_FindByPickupName((char*)name);
+	existing = Loadout_FindItem(ent, item);
 
-	ent->client->loadout.num_items++;
+	slot = loadout->num_items++;
+	entry = &loadout->items[slot];
 
+	entry->item_index = 0;
+	entry->type = type;
+	entry->amount = amount;
+
+	if (item)
+	{
+		entry->item_index = ITEM_INDEX(item);
+		loadout->occupied |= (1u << slot);
+
+		// if the item is somehow in there twice, the first one is the one that gets used
+		if (!existing)
+			loadout->item_slots[entry->item_index] = slot + 1;
+	}
+
+	// don't crash if we're not connected
 	if (ent->client->pers.connected)
 	{
 		gi.WriteByte(svc_event);
 		gi.WriteByte(event_type_sv_loadout_add);
-		gi.WriteString(name);
-		gi.WriteString(icon);
+		gi.WriteString((char*)name);
+		gi.WriteString((char*)icon);
 		gi.WriteByte(type);
 		gi.WriteShort(amount);
 
@@ -45,12 +75,14 @@ loadout_entry_t* Loadout_AddItem(edict_t *ent, const char* name, const char* ico
 		gi.unicast(ent, true);
 	}
 
-	return &ent->client->loadout.items[ent->client->loadout.num_items - 1];
+	return entry;
 }
 
 void Loadout_DeleteItem(edict_t* ent, const char* name)
 {
-	loadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, name);
+	gloadout_t* loadout = &ent->client->loadout;
+	gloadout_entry_t* loadout_entry_ptr = Loadout_GetItem(ent, name);
+	int32_t slot;
 
 	if (loadout_entry_ptr == NULL)
 	{
@@ -58,35 +90,79 @@ void Loadout_DeleteItem(edict_t* ent, const char* name)
 		return;
 	}
 
-	memset(loadout_entry_ptr->item_name, 0x00, strlen(loadout_entry_ptr->item_name));
+	slot = loadout_entry_ptr - loadout->items;
+
+	loadout->item_slots[loadout_entry_ptr->item_index] = 0;
+	loadout->occupied &= ~(1u << slot);
+	loadout_entry_ptr->item_index = 0;
 	loadout_entry_ptr->amount = 0;
 
 	// only decrement num_items if its the last item (empty items get skipped)
-	if (loadout_entry_ptr == &ent->client->loadout.items[ent->client->loadout.num_items - 1])
-		ent->client->loadout.num_items--;
+	if (slot == loadout->num_items - 1)
+		loadout->num_items--;
 
 	// tell the client
 	gi.WriteByte(svc_event);
 	gi.WriteByte(event_type_sv_loadout_remove);
-	gi.WriteString(name);
+	gi.WriteString((char*)name);
 	
 	gi.unicast(ent, true);
 }
 
-loadout_entry_t* Loadout_GetItem(edict_t* ent, const char* name)
+gloadout_entry_t* Loadout_FindItem(edict_t* ent, gitem_t* item)
 {
-	for (int32_t item_id = 0; item_id < ent->client->loadout.num_items; item_id++)
+	gloadout_t* loadout = &ent->client->loadout;
+	int32_t index, slot;
+
+	if (!item)
+		return NULL;
+
+	index = ITEM_INDEX(item);
+	slot = loadout->item_slots[index] - 1;
+
+	if (slot >= 0
+		&& slot < loadout->num_items
+		&& loadout->items[slot].item_index == index)
+		return &loadout->items[slot];
+
+	// the slot is out of date, look for it
+	for (slot = 0; slot < loadout->num_items; slot++)
 	{
-		if (!strncmp(ent->client->loadout.items[item_id].item_name, name, LOADOUT_MAX_STRLEN))
+		if ((loadout->occupied & (1u << slot))
+			&& loadout->items[slot].item_index == index)
 		{
-			return &ent->client->loadout.items[item_id];
+			loadout->item_slots[index] = slot + 1;
+			return &loadout->items[slot];
 		}
 	}
 
-	return NULL; 
+	loadout->item_slots[index] = 0;
+	return NULL;
+}
+
+gloadout_entry_t* Loadout_GetItem(edict_t* ent, const char* name)
+{
+	gitem_t* item = Item_FindByPickupName((char*)name);
+
+	// loadout names have always been case sensitive
+	if (!item
+		|| strcmp(item->pickup_name, name))
+		return NULL;
+
+	return Loadout_FindItem(ent, item);
 }
 
-bool Loadout_EntryIsItem(loadout_entry_t* entry, const char* name)
+bool Loadout_EntryIsItem(gloadout_entry_t* entry, const char* name)
 {
-	return !strncmp(entry->item_name, name, LOADOUT_MAX_STRLEN);
-}
\ No newline at end of file
+	return entry->item_index
+		&& !strcmp(itemlist[entry->item_index].pickup_name, name);
+}
+
+gitem_t* Loadout_EntryGetItem(gloadout_entry_t* entry)
+{
+	if (!entry
+		|| !entry->item_index)
+		return NULL;
+
+	return &itemlist[entry->item_index];
+}
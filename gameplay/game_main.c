@@ -21,6 +21,11 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 
 #include <game_local.h>
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
 game_locals_t	game;
 level_locals_t	level;
 game_import_t	gi;
@@ -78,6 +83,18 @@ cvar_t* sv_maplist;
 
 cvar_t* aimfix;
 
+cvar_t* sv_profile;
+cvar_t* sv_tracecache;
+cvar_t* sv_sightbudget;
+cvar_t* sv_nav;
+cvar_t* sv_flowbudget;
+cvar_t* sv_ailod;
+cvar_t* sv_ailod_half;
+cvar_t* sv_ailod_quarter;
+cvar_t* sv_ailod_dormant;
+cvar_t* sv_maxgibs;
+cvar_t* sv_physbatch;
+
 void Game_Write(char* filename, bool autosave);
 void Game_Read(char* filename);
 void Game_SpawnEntities(char* mapname, char* entities, char* spawnpoint);
@@ -103,6 +120,8 @@ void Game_Shutdown()
 {
 	gi.dprintf("==== ShutdownGame ====\n");
 
+	Trace_Stop();
+
 	gi.FreeTags(TAG_LEVEL);
 	gi.FreeTags(TAG_GAME);
 }
@@ -173,6 +192,29 @@ void Com_Printf(char* msg, ...)
 	gi.dprintf(text);
 }
 
+// monotonic, the wall clock can be stepped while the game is running
+int64_t Sys_Nanoseconds()
+{
+#ifdef _WIN32
+	static LARGE_INTEGER	frequency;
+	LARGE_INTEGER			counter;
+
+	if (!frequency.QuadPart)
+		QueryPerformanceFrequency(&frequency);
+
+	QueryPerformanceCounter(&counter);
+
+	// split so the multiply doesn't overflow on long uptimes
+	return (counter.QuadPart / frequency.QuadPart) * 1000000000
+		+ (counter.QuadPart % frequency.QuadPart) * 1000000000 / frequency.QuadPart;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
 #endif
 
 //======================================================================
@@ -212,7 +254,7 @@ edict_t* CreateTargetChangeLevel(char* map)
 	edict_t* ent;
 
 	ent = Edict_Spawn();
-	ent->classname = "target_changelevel";
+	Edict_SetClassname(ent, "target_changelevel");
 	Com_sprintf(level.nextmap, sizeof(level.nextmap), "%s", map);
 	ent->map = level.nextmap;
 	return ent;
@@ -272,7 +314,7 @@ void Game_EndMatch()
 	if (level.nextmap[0]) // go to a specific map
 		Game_TransitionToNextMatch(CreateTargetChangeLevel(level.nextmap));
 	else {	// search for a changelevel
-		ent = Game_FindEdictByValue(NULL, FOFS(classname), "target_changelevel");
+		ent = Edict_FindByClass(NULL, CLASS_TARGET_CHANGELEVEL);
 		if (!ent)
 		{	// the map designer didn't include a changelevel,
 			// so create a fake ent that goes back to the same level
@@ -374,31 +416,63 @@ Advances the world by (1/TICKRATE) seconds
 */
 void Game_RunFrame()
 {
-	int32_t  i;
+	int32_t  i, classid;
 	edict_t* ent;
+	int64_t	 frame_start, entities_start, start;
 
 	level.framenum++;
 	level.time = level.framenum * TICK_TIME;
 
-	// choose a client for monsters to target this frame
+	FrameArena_Reset();
+	Profile_BeginFrame();
+	frame_start = Profile_Start();
+	Trace_Begin("frame", level.framenum);
+
+	// choose a client for monsters to target this frame, how often they think and who they can all see
+	start = Profile_Start();
 	AI_SetSightClient();
+	AI_UpdateLOD();
+	AI_UpdateSight();
+
+	if (profile_enabled)
+		Profile_AddPhase(PROFILE_PHASE_SIGHT, start);
+
+	// and the way to whatever they are chasing
+	start = Profile_Start();
+	Nav_UpdateFields();
+
+	if (profile_enabled)
+		Profile_AddPhase(PROFILE_PHASE_FLOW, start);
 
 	// exit intermissions
 
 	if (level.exitintermission)
 	{
 		Level_Exit();
+		Profile_EndFrame();
+		Trace_End();
+		Trace_EndFrame();
+		TraceCache_EndFrame();
 		return;
 	}
 
+	// wake up anything whose think is due this frame
+	ThinkWheel_Advance(level.framenum);
+
+	// and move every gib and projectile in flight in one go, they trace to where it put them
+	Batch_Integrate();
+
 	//
 	// treat each object in turn
 	// even the world gets a chance to think
 	//
-	ent = &g_edicts[0];
-	for (i = 0; i < globals.num_edicts; i++, ent++)
+	entities_start = Profile_Start();
+
+	for (ent = EdictList_Next(NULL); ent; ent = EdictList_Next(ent))
 	{
-		if (!ent->inuse)
+		// nothing to do until its think fires or something moves it, projectiles are run below
+		if (ent->think_asleep
+			|| ent->projectile_pooled)
 			continue;
 
 		level.current_entity = ent;
@@ -416,22 +490,61 @@ void Game_RunFrame()
 			}
 		}
 
+		i = ent - g_edicts;
+
+		// the entity can free itself, so hang on to its class
+		classid = ent->classid;
+		start = Profile_Start();
+
 		if (i > 0 && i <= sv_maxclients->value)
 		{
 			Client_BeginServerFrame(ent); 
-			continue;
+		}
+		else
+		{
+			Physics_RunEntity(ent);
+
+			if (ent->inuse)
+				ThinkWheel_TrySleep(ent);
 		}
 
-		Physics_RunEntity(ent);
+		if (profile_enabled)
+			Profile_AddClass(classid, start);
 	}
 
+	if (profile_enabled)
+		Profile_AddPhase(PROFILE_PHASE_ENTITIES, entities_start);
+
+	// then all the rockets, grenades and bolts in one go
+	start = Profile_Start();
+	ProjectilePool_RunFrame();
+
+	if (profile_enabled)
+		Profile_AddPhase(PROFILE_PHASE_PROJECTILES, start);
+
 	// let the current gamemode think
+	start = Profile_Start();
 	Gamemode_Update();
 
+	if (profile_enabled)
+		Profile_AddPhase(PROFILE_PHASE_GAMEMODE, start);
+
 	// see if needpass needs updated
 	Game_CheckIfPasswordRequired();
 
 	// build the playerstate_t structures for all players
+	start = Profile_Start();
 	ClientEndServerFrames();
+
+	if (profile_enabled)
+	{
+		Profile_AddPhase(PROFILE_PHASE_CLIENTS, start);
+		Profile_AddPhase(PROFILE_PHASE_FRAME, frame_start);
+		Profile_EndFrame();
+	}
+
+	Trace_End();
+	Trace_EndFrame();
+	TraceCache_EndFrame();
 }
 
@@ -53,7 +53,7 @@ void PlayerTrail_Init()
 	for (n = 0; n < TRAIL_LENGTH; n++)
 	{
 		trail[n] = Edict_Spawn();
-		trail[n]->classname = "player_trail";
+		Edict_SetClassname(trail[n], "player_trail");
 	}
 
 	trail_head = 0;
@@ -99,7 +99,7 @@ edict_t* PlayerTrail_PickFirst(edict_t* self)
 
 	for (marker = trail_head, n = TRAIL_LENGTH; n; n--)
 	{
-		if (trail[marker]->timestamp <= self->monsterinfo.trail_time)
+		if (trail[marker]->timestamp <= self->monsterinfo->trail_time)
 			marker = NEXT(marker);
 		else
 			break;
@@ -128,7 +128,7 @@ edict_t* PlayerTrail_PickNext(edict_t* self)
 
 	for (marker = trail_head, n = TRAIL_LENGTH; n; n--)
 	{
-		if (trail[marker]->timestamp <= self->monsterinfo.trail_time)
+		if (trail[marker]->timestamp <= self->monsterinfo->trail_time)
 			marker = NEXT(marker);
 		else
 			break;
@@ -62,15 +62,17 @@ field_t fields[] =
 	{ "angle", FOFS(s.angles), F_ANGLEHACK },
 	{ "angles", FOFS(s.angles), F_VECTOR3 },
 	{ "velocity", FOFS(velocity), F_VECTOR3 },
-	{ "angles_spread", FOFS(angles_spread), F_INT },
 	{ "jump_velocity", FOFS(jump_height), F_INT },
-	{ "particle_effect", FOFS(particle_effect), F_INT },
-	{ "particle_rate", FOFS(particle_rate), F_INT },
-	{ "particle_lifetime", FOFS(particle_lifetime), F_INT },
-	{ "particle_magnitude", FOFS(particle_magnitude), F_INT },
-	{ "alphavel", FOFS(alphavel), F_FLOAT},
-	{ "color", FOFS(color), F_VECTOR4},
-	{ "color_run", FOFS(color_run), F_VECTOR3},
+
+	// func_particle_effect
+	{ "angles_spread", PEOFS(angles_spread), F_INT, FFL_PARTICLES },
+	{ "particle_effect", PEOFS(effect), F_INT, FFL_PARTICLES },
+	{ "particle_rate", PEOFS(rate), F_INT, FFL_PARTICLES },
+	{ "particle_lifetime", PEOFS(lifetime), F_INT, FFL_PARTICLES },
+	{ "particle_magnitude", PEOFS(magnitude), F_INT, FFL_PARTICLES },
+	{ "alphavel", PEOFS(alphavel), F_FLOAT, FFL_PARTICLES },
+	{ "color", PEOFS(color), F_VECTOR4, FFL_PARTICLES },
+	{ "color_run", PEOFS(color_run), F_VECTOR3, FFL_PARTICLES },
 
 	// Area of effects of entity
 	{ "extents", FOFS(s.extents), F_VECTOR3 },
@@ -97,19 +99,19 @@ field_t fields[] =
 	{ "pain", FOFS(pain), F_FUNCTION, FFL_NOSPAWN },
 	{ "die", FOFS(die), F_FUNCTION, FFL_NOSPAWN },
 
-	{ "stand", FOFS(monsterinfo.stand), F_FUNCTION, FFL_NOSPAWN },
-	{ "idle", FOFS(monsterinfo.idle), F_FUNCTION, FFL_NOSPAWN },
-	{ "search", FOFS(monsterinfo.search), F_FUNCTION, FFL_NOSPAWN },
-	{ "walk", FOFS(monsterinfo.walk), F_FUNCTION, FFL_NOSPAWN },
-	{ "run", FOFS(monsterinfo.run), F_FUNCTION, FFL_NOSPAWN },
-	{ "dodge", FOFS(monsterinfo.dodge), F_FUNCTION, FFL_NOSPAWN },
-	{ "attack", FOFS(monsterinfo.attack), F_FUNCTION, FFL_NOSPAWN },
-	{ "melee", FOFS(monsterinfo.melee), F_FUNCTION, FFL_NOSPAWN },
-	{ "sight", FOFS(monsterinfo.sight), F_FUNCTION, FFL_NOSPAWN },
-	{ "checkattack", FOFS(monsterinfo.checkattack), F_FUNCTION, FFL_NOSPAWN },
-	{ "currentmove", FOFS(monsterinfo.currentmove), F_MMOVE, FFL_NOSPAWN },
-
-	{ "endfunc", FOFS(moveinfo.endfunc), F_FUNCTION, FFL_NOSPAWN },
+	{ "stand", MIOFS(stand), F_FUNCTION, FFL_NOSPAWN | FFL_MONSTER },
+	{ "idle", MIOFS(idle), F_FUNCTION, FFL_NOSPAWN | FFL_MONSTER },
+	{ "search", MIOFS(search), F_FUNCTION, FFL_NOSPAWN | FFL_MONSTER },
+	{ "walk", MIOFS(walk), F_FUNCTION, FFL_NOSPAWN | FFL_MONSTER },
+	{ "run", MIOFS(run), F_FUNCTION, FFL_NOSPAWN | FFL_MONSTER },
+	{ "dodge", MIOFS(dodge), F_FUNCTION, FFL_NOSPAWN | FFL_MONSTER },
+	{ "attack", MIOFS(attack), F_FUNCTION, FFL_NOSPAWN | FFL_MONSTER },
+	{ "melee", MIOFS(melee), F_FUNCTION, FFL_NOSPAWN | FFL_MONSTER },
+	{ "sight", MIOFS(sight), F_FUNCTION, FFL_NOSPAWN | FFL_MONSTER },
+	{ "checkattack", MIOFS(checkattack), F_FUNCTION, FFL_NOSPAWN | FFL_MONSTER },
+	{ "currentmove", MIOFS(currentmove), F_MMOVE, FFL_NOSPAWN | FFL_MONSTER },
+
+	{ "endfunc", MVOFS(endfunc), F_FUNCTION, FFL_NOSPAWN | FFL_MOVER },
 	{ "allowed_teams", FOFS(allowed_teams), F_INT, FFL_NOSPAWN },							// Team doors 
 
 	// temp spawn vars -- only valid when the spawn function is called
@@ -232,9 +234,40 @@ void Game_Init ()
 	/* others */
 	aimfix = gi.Cvar_Get("aimfix", "0", CVAR_ARCHIVE);
 
+	// frame profiler, see sv profile
+	sv_profile = gi.Cvar_Get("sv_profile", "0", 0);
+	sv_tracecache = gi.Cvar_Get("sv_tracecache", "1", 0);
+
+	// traces a frame for working out which clients monsters can see
+	sv_sightbudget = gi.Cvar_Get("sv_sightbudget", "1024", 0);
+
+	// navigation graph monsters hunt along, takes effect on the next map
+	sv_nav = gi.Cvar_Get("sv_nav", "1", 0);
+
+	// navigation nodes a frame for working out the flow fields monsters chase along
+	sv_flowbudget = gi.Cvar_Get("sv_flowbudget", "2048", 0);
+
+	// distances from the nearest client where monsters drop to half rate, quarter rate and stop thinking
+	sv_ailod = gi.Cvar_Get("sv_ailod", "1", 0);
+	sv_ailod_half = gi.Cvar_Get("sv_ailod_half", "1024", 0);
+	sv_ailod_quarter = gi.Cvar_Get("sv_ailod_quarter", "2048", 0);
+	sv_ailod_dormant = gi.Cvar_Get("sv_ailod_dormant", "4096", 0);
+
+	// gibs and debris alive at once, the oldest are recycled past this, 0 turns them off
+	sv_maxgibs = gi.Cvar_Get("sv_maxgibs", "64", CVAR_ARCHIVE);
+
+	// integrate gibs and projectiles together before running them
+	sv_physbatch = gi.Cvar_Get("sv_physbatch", "1", 0);
+
 	// items
 	ItemList_Init();
 
+	// builtin classnames
+	Class_Init();
+
+	// spawn function and field lookups, needs the item list
+	ED_InitHashes();
+
 	// initialize all entities for this game
 	game.maxentities = MAX_EDICTS;
 	g_edicts = gi.TagMalloc(game.maxentities * sizeof(g_edicts[0]), TAG_GAME);
@@ -270,6 +303,8 @@ void WriteField1 (FILE *f, field_t *field, uint8_t *base)
 		break;
 
 	case F_LSTRING:
+		*(int32_t *)p = StringTable_Index (*(char **)p);
+		break;
 	case F_GSTRING:
 		if ( *(char **)p )
 			len = (int32_t)strlen(*(char **)p) + 1;
@@ -323,33 +358,9 @@ void WriteField1 (FILE *f, field_t *field, uint8_t *base)
 }
 
 
-void WriteField2 (FILE *f, field_t *field, uint8_t *base)
-{
-	int32_t	len;
-	void*	p;
-
-	if (field->flags & FFL_SPAWNTEMP)
-		return;
-
-	p = (void *)(base + field->ofs);
-	switch (field->type)
-	{
-	case F_LSTRING:
-		if ( *(char **)p )
-		{
-			len = (int32_t)strlen(*(char **)p) + 1;
-			fwrite (*(char **)p, len, 1, f);
-		}
-		break;
-	default:
-		break;
-	}
-}
-
 void ReadField (FILE *f, field_t *field, uint8_t *base)
 {
 	void*	p;
-	int32_t	len;
 	int32_t	index;
 
 	if (field->flags & FFL_SPAWNTEMP)
@@ -368,14 +379,7 @@ void ReadField (FILE *f, field_t *field, uint8_t *base)
 		break;
 
 	case F_LSTRING:
-		len = *(int32_t *)p;
-		if (!len)
-			*(char **)p = NULL;
-		else
-		{
-			*(char **)p = gi.TagMalloc (len, TAG_LEVEL);
-			fread (*(char **)p, len, 1, f);
-		}
+		*(char **)p = StringTable_Get (*(int32_t *)p);
 		break;
 	case F_EDICT:
 		index = *(int32_t *)p;
@@ -447,12 +451,6 @@ void WriteClient (FILE *f, gclient_t *client)
 
 	// write the block
 	fwrite (&temp, sizeof(temp), 1, f);
-
-	// now write any allocated data following the edict
-	for (field=clientfields ; field->name ; field++)
-	{
-		WriteField2 (f, field, (uint8_t*)client);
-	}
 }
 
 /*
@@ -548,6 +546,59 @@ void Game_Read (char *filename)
 //==========================================================
 
 
+/*
+==============
+Edict_WriteComponent
+
+Writes one of ent's components, with its fields' pointers changed the same
+way as the edict's
+==============
+*/
+void Edict_WriteComponent (FILE *f, edict_t *ent, component_type_t type)
+{
+	field_t		*field;
+	uint8_t		*component;
+	union
+	{
+		monsterinfo_t		monster;
+		moveinfo_t			mover;
+		particle_emitter_t	particles;
+	} temp;
+
+	component = *Component_Slot (ent, type);
+	memcpy (&temp, component, Component_Size (type));
+
+	for (field=fields ; field->name ; field++)
+	{
+		if (Component_FieldType (field) == type)
+			WriteField1 (f, field, (uint8_t *)&temp);
+	}
+
+	fwrite (&temp, Component_Size (type), 1, f);
+}
+
+/*
+==============
+Edict_ReadComponent
+
+Gives ent a component of type and reads it back
+==============
+*/
+void Edict_ReadComponent (FILE *f, edict_t *ent, component_type_t type)
+{
+	field_t		*field;
+	uint8_t		*component;
+
+	component = Component_Add (ent, type);
+	fread (component, Component_Size (type), 1, f);
+
+	for (field=fields ; field->name ; field++)
+	{
+		if (Component_FieldType (field) == type)
+			ReadField (f, field, component);
+	}
+}
+
 /*
 ==============
 Edict_Write
@@ -559,6 +610,7 @@ void Edict_Write (FILE* f, edict_t* ent)
 {
 	field_t		*field;
 	edict_t		temp;
+	int32_t		type;
 
 	// all of the ints, floats, and vectors stay as they are
 	temp = *ent;
@@ -566,18 +618,23 @@ void Edict_Write (FILE* f, edict_t* ent)
 	// change the pointers to lengths or indexes
 	for (field=fields ; field->name ; field++)
 	{
-		WriteField1 (f, field, (uint8_t*)&temp);
+		if (Component_FieldType (field) == COMPONENT_NUM_TYPES)
+			WriteField1 (f, field, (uint8_t*)&temp);
 	}
 
+	// and the components to handles, 0 if it doesn't have one
+	for (type = 0; type < COMPONENT_NUM_TYPES; type++)
+		*Component_Slot (&temp, type) = (void *)(intptr_t)Component_Handle (ent, type);
+
 	// write the block
 	fwrite (&temp, sizeof(temp), 1, f);
 
-	// now write any allocated data following the edict
-	for (field=fields ; field->name ; field++)
+	// then each component it has, the same way
+	for (type = 0; type < COMPONENT_NUM_TYPES; type++)
 	{
-		WriteField2 (f, field, (uint8_t*)ent);
+		if (*Component_Slot (ent, type))
+			Edict_WriteComponent (f, ent, type);
 	}
-
 }
 
 /*
@@ -603,12 +660,6 @@ void Level_WriteLocals (FILE *f)
 
 	// write the block
 	fwrite (&temp, sizeof(temp), 1, f);
-
-	// now write any allocated data following the edict
-	for (field=levelfields ; field->name ; field++)
-	{
-		WriteField2 (f, field, (uint8_t *)&level);
-	}
 }
 
 
@@ -622,12 +673,27 @@ All pointer variables (except function pointers) must be handled specially.
 void Edict_Read (FILE *f, edict_t *ent)
 {
 	field_t		*field;
+	void		**slot;
+	int32_t		type;
 
 	fread (ent, sizeof(*ent), 1, f);
 
 	for (field=fields ; field->name ; field++)
 	{
-		ReadField (f, field, (uint8_t *)ent);
+		if (Component_FieldType (field) == COMPONENT_NUM_TYPES)
+			ReadField (f, field, (uint8_t *)ent);
+	}
+
+	// the saved handles only say which components follow
+	for (type = 0; type < COMPONENT_NUM_TYPES; type++)
+	{
+		slot = Component_Slot (ent, type);
+
+		if (!*slot)
+			continue;
+
+		*slot = NULL;
+		Edict_ReadComponent (f, ent, type);
 	}
 }
 
@@ -650,6 +716,26 @@ void Level_ReadLocals (FILE *f)
 	}
 }
 
+/*
+==============
+Level_AddStrings
+
+Adds the strings base's fields of type point at to the string table
+==============
+*/
+void Level_AddStrings (field_t *list, uint8_t *base, component_type_t type)
+{
+	field_t		*field;
+
+	for (field=list ; field->name ; field++)
+	{
+		if (field->type == F_LSTRING
+			&& !(field->flags & FFL_SPAWNTEMP)
+			&& Component_FieldType (field) == type)
+			StringTable_Add (*(char **)(base + field->ofs));
+	}
+}
+
 /*
 =================
 WriteLevel
@@ -667,6 +753,8 @@ void Level_Write (char *filename)
 	if (!f)
 		gi.error ("Couldn't open %s", filename);
 
+	Trace_Begin ("Level_Write", -1);
+
 	// write out edict size for checking
 	i = sizeof(edict_t);
 	fwrite (&i, sizeof(i), 1, f);
@@ -675,22 +763,37 @@ void Level_Write (char *filename)
 	base = (void *)Game_Init;
 	fwrite (&base, sizeof(base), 1, f);
 
+	// write out every string once, the fields only hold indexes into the table
+	StringTable_Begin ();
+	Level_AddStrings (levelfields, (uint8_t *)&level, COMPONENT_NUM_TYPES);
+
+	for (ent = EdictList_Next (NULL) ; ent ; ent = EdictList_Next (ent))
+	{
+		if (ent->flags & FL_NO_SAVE)
+			continue;
+
+		Level_AddStrings (fields, (uint8_t *)ent, COMPONENT_NUM_TYPES);
+
+		for (i = 0; i < COMPONENT_NUM_TYPES; i++)
+		{
+			if (*Component_Slot (ent, i))
+				Level_AddStrings (fields, *Component_Slot (ent, i), i);
+		}
+	}
+
+	StringTable_Write (f);
+
 	// write out level_locals_t
 	Level_WriteLocals (f);
 
 	// write out all the entities
-	for (i=0 ; i<globals.num_edicts ; i++)
+	for (ent = EdictList_Next (NULL) ; ent ; ent = EdictList_Next (ent))
 	{
-		ent = &g_edicts[i];
-
-		// ignore nonexistent edicts
-		if (!ent->inuse)
-			continue;
-
 		// ignore ephemeral stuff
 		if (ent->flags & FL_NO_SAVE)
 			continue;
 
+		i = ent - g_edicts;
 		fwrite (&i, sizeof(i), 1, f);
 		Edict_Write (f, ent);
 	}
@@ -698,6 +801,9 @@ void Level_Write (char *filename)
 	fwrite (&i, sizeof(i), 1, f);
 
 	fclose (f);
+	StringTable_End ();
+
+	Trace_End ();
 }
 
 
@@ -736,6 +842,11 @@ void Level_Read (char *filename)
 	// wipe all the entities
 	memset (g_edicts, 0, game.maxentities*sizeof(g_edicts[0]));
 	globals.num_edicts = sv_maxclients->value+1;
+	Component_Clear ();
+	Batch_Clear ();
+	Spatial_Clear ();
+	TraceCache_Clear ();
+	Nav_Clear (NULL);
 
 	// check edict size
 	fread (&i, sizeof(i), 1, f);
@@ -748,6 +859,9 @@ void Level_Read (char *filename)
 	// check function pointer base address
 	fread (&base, sizeof(base), 1, f);
 
+	// the strings go back in the pool, the fields are indexes into them
+	StringTable_Read (f);
+
 	// load the level locals
 	Level_ReadLocals (f);
 
@@ -769,10 +883,13 @@ void Level_Read (char *filename)
 
 		// let the server rebuild world links for this ent
 		memset (&ent->area, 0, sizeof(ent->area));
-		gi.Edict_Link (ent);
+		ent->spatial_linked = false;
+		ent->batch_slot = 0;
+		Edict_Link (ent);
 	}
 
 	fclose (f);
+	StringTable_End ();
 
 	// mark all clients as unconnected
 	for (i=0 ; i<sv_maxclients->value ; i++)
@@ -782,6 +899,17 @@ void Level_Read (char *filename)
 		ent->client->pers.connected = false;
 	}
 
+	// the think wheel, free slot, projectile slab, targetname, class, gib pool and physics batch links weren't saved meaningfully, rebuild them
+	EdictList_Rebuild ();
+	ProjectilePool_Rebuild ();
+	EdictQueue_Rebuild ();
+	Targetname_Rebuild ();
+	Class_Rebuild ();
+	ThinkWheel_Rebuild ();
+	GibPool_Rebuild ();
+	Batch_Rebuild ();
+	Nav_Init ();
+
 	// do any load time things at this point
 	for (i=0 ; i<globals.num_edicts ; i++)
 	{
@@ -791,8 +919,7 @@ void Level_Read (char *filename)
 			continue;
 
 		// fire any cross-level triggers
-		if (ent->classname)
-			if (strcmp(ent->classname, "target_crosslevel_target") == 0)
-				ent->nextthink = level.time + ent->delay;
+		if (ent->classid == CLASS_TARGET_CROSSLEVEL_TARGET)
+				Edict_SetNextThink(ent, level.time + ent->delay);
 	}
 }
@@ -152,21 +152,21 @@ void Game_TransitionToNextMatch (edict_t *targ)
 	level.exitintermission = 0;
 
 	// find an intermission spot
-	ent = Game_FindEdictByValue (NULL, FOFS(classname), "info_player_intermission");
+	ent = Edict_FindByClass (NULL, CLASS_INFO_PLAYER_INTERMISSION);
 	if (!ent)
 	{	// the map creator forgot to put in an intermission point, so use the unassigned MP start...
-		ent = Game_FindEdictByValue (NULL, FOFS(classname), "info_player_start");
+		ent = Edict_FindByClass (NULL, CLASS_INFO_PLAYER_START);
 		if (!ent)
-			ent = Game_FindEdictByValue (NULL, FOFS(classname), "info_player_deathmatch");
+			ent = Edict_FindByClass (NULL, CLASS_INFO_PLAYER_DEATHMATCH);
 	}
 	else
 	{	// chose one of four spots
 		i = rand() & 3;
 		while (i--)
 		{
-			ent = Game_FindEdictByValue (ent, FOFS(classname), "info_player_intermission");
+			ent = Edict_FindByClass (ent, CLASS_INFO_PLAYER_INTERMISSION);
 			if (!ent)	// wrap around the list
-				ent = Game_FindEdictByValue (ent, FOFS(classname), "info_player_intermission");
+				ent = Edict_FindByClass (ent, CLASS_INFO_PLAYER_INTERMISSION);
 		}
 	}
 
@@ -294,8 +294,8 @@ G_SetStats
 void GameUI_SetStats (edict_t *ent)
 {
 	gitem_t			*item;
-	loadout_entry_t* cells = Loadout_GetItem(ent, "cells");
-	loadout_entry_t* armor = Armor_GetCurrent(ent);
+	gloadout_entry_t* cells = Loadout_GetItem(ent, "cells");
+	gloadout_entry_t* armor = Armor_GetCurrent(ent);
 
 	int32_t			power_armor_type;
 
@@ -308,14 +308,14 @@ void GameUI_SetStats (edict_t *ent)
 	//
 	// ammo
 	//
-	if (!ent->client->loadout_current_ammo->item_name)
+	if (!ent->client->loadout_current_ammo)
 	{
 		ent->client->ps.stats[STAT_AMMO_ICON] = 0;
 		ent->client->ps.stats[STAT_AMMO] = 0;
 	}
 	else
 	{
-		item = Item_FindByPickupName(ent->client->loadout_current_ammo->item_name);
+		item = Loadout_EntryGetItem(ent->client->loadout_current_ammo);
 		
 		if (!item)
 		{
@@ -354,7 +354,7 @@ void GameUI_SetStats (edict_t *ent)
 	}
 	else if (armor)
 	{
-		ent->client->ps.stats[STAT_ARMOR_ICON] = gi.imageindex(armor->icon);
+		ent->client->ps.stats[STAT_ARMOR_ICON] = gi.imageindex(Loadout_EntryGetItem(armor)->icon);
 		ent->client->ps.stats[STAT_ARMOR] = armor->amount;
 	}
 	else
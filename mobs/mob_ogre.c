@@ -66,7 +66,7 @@ mmove_t ogre_move_stand1 = { FRAME_stand1, FRAME_stand15, ogre_frames_stand1, og
 
 void ogre_stand(edict_t* self)
 {
-	self->monsterinfo.currentmove = &ogre_move_stand1;
+	self->monsterinfo->currentmove = &ogre_move_stand1;
 }
 
 //
@@ -76,7 +76,7 @@ void ogre_stand(edict_t* self)
 void ogre_walk1_random(edict_t* self)
 {
 	if (random() > 0.1)
-		self->monsterinfo.nextframe = FRAME_walk1;
+		self->monsterinfo->nextframe = FRAME_walk1;
 }
 
 mframe_t ogre_frames_walk1[] =
@@ -106,7 +106,7 @@ mmove_t ogre_move_walk1 = { FRAME_walk1, FRAME_walk19, ogre_frames_walk1, NULL }
 void ogre_walk(edict_t* self)
 {
 	// use random to get multiple types of run anim when we have the new ogre models
-	self->monsterinfo.currentmove = &ogre_move_walk1;
+	self->monsterinfo->currentmove = &ogre_move_walk1;
 }
 
 //
@@ -149,20 +149,20 @@ mmove_t ogre_move_run = { FRAME_run3, FRAME_run18, ogre_frames_run, NULL };
 
 void ogre_run(edict_t* self)
 {
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &ogre_move_stand1;
+		self->monsterinfo->currentmove = &ogre_move_stand1;
 		return;
 	}
 
-	if (self->monsterinfo.currentmove == &ogre_move_walk1 ||
-		self->monsterinfo.currentmove == &ogre_move_start_run)
+	if (self->monsterinfo->currentmove == &ogre_move_walk1 ||
+		self->monsterinfo->currentmove == &ogre_move_start_run)
 	{
-		self->monsterinfo.currentmove = &ogre_move_run;
+		self->monsterinfo->currentmove = &ogre_move_run;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &ogre_move_start_run;
+		self->monsterinfo->currentmove = &ogre_move_start_run;
 	}
 }
 
@@ -273,8 +273,8 @@ void ogre_pain(edict_t* self, edict_t* other, float kick, int32_t damage)
 
 	if (level.time < self->pain_debounce_time)
 	{
-		if ((self->velocity[2] > 100) && ((self->monsterinfo.currentmove == &ogre_move_pain1) || (self->monsterinfo.currentmove == &ogre_move_pain2) || (self->monsterinfo.currentmove == &ogre_move_pain3)))
-			self->monsterinfo.currentmove = &ogre_move_pain4;
+		if ((self->velocity[2] > 100) && ((self->monsterinfo->currentmove == &ogre_move_pain1) || (self->monsterinfo->currentmove == &ogre_move_pain2) || (self->monsterinfo->currentmove == &ogre_move_pain3)))
+			self->monsterinfo->currentmove = &ogre_move_pain4;
 		return;
 	}
 
@@ -290,7 +290,7 @@ void ogre_pain(edict_t* self, edict_t* other, float kick, int32_t damage)
 
 	if (self->velocity[2] > 100)
 	{
-		self->monsterinfo.currentmove = &ogre_move_pain4;
+		self->monsterinfo->currentmove = &ogre_move_pain4;
 		return;
 	}
 
@@ -300,11 +300,11 @@ void ogre_pain(edict_t* self, edict_t* other, float kick, int32_t damage)
 	r = random();
 
 	if (r < 0.33)
-		self->monsterinfo.currentmove = &ogre_move_pain1;
+		self->monsterinfo->currentmove = &ogre_move_pain1;
 	else if (r < 0.66)
-		self->monsterinfo.currentmove = &ogre_move_pain2;
+		self->monsterinfo->currentmove = &ogre_move_pain2;
 	else
-		self->monsterinfo.currentmove = &ogre_move_pain3;
+		self->monsterinfo->currentmove = &ogre_move_pain3;
 }
 
 
@@ -352,9 +352,9 @@ void ogre_attack1_refire1(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_atta2;
+		self->monsterinfo->nextframe = FRAME_atta2;
 	else
-		self->monsterinfo.nextframe = FRAME_atta10;
+		self->monsterinfo->nextframe = FRAME_atta10;
 }
 
 void ogre_attack1_refire2(edict_t* self)
@@ -366,7 +366,7 @@ void ogre_attack1_refire2(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_atta2;
+		self->monsterinfo->nextframe = FRAME_atta2;
 }
 
 mframe_t ogre_frames_attack1[] =
@@ -396,9 +396,9 @@ void ogre_attack2_refire1(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_attb4;
+		self->monsterinfo->nextframe = FRAME_attb4;
 	else
-		self->monsterinfo.nextframe = FRAME_attb14;
+		self->monsterinfo->nextframe = FRAME_attb14;
 }
 
 void ogre_attack2_refire2(edict_t* self)
@@ -410,7 +410,7 @@ void ogre_attack2_refire2(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_attb4;
+		self->monsterinfo->nextframe = FRAME_attb4;
 }
 
 mframe_t ogre_frames_attack2[] =
@@ -437,27 +437,27 @@ mmove_t ogre_move_attack2 = { FRAME_attb1, FRAME_attb14, ogre_frames_attack2, og
 
 void ogre_duck_down(edict_t* self)
 {
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (self->monsterinfo->aiflags & AI_DUCKED)
 		return;
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	self->monsterinfo->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
-	gi.Edict_Link(self);
+	self->monsterinfo->pausetime = level.time + 1;
+	Edict_Link(self);
 }
 
 void ogre_duck_up(edict_t* self)
 {
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	self->monsterinfo->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 void ogre_attack3_refire(edict_t* self)
 {
-	if ((level.time + 0.4) < self->monsterinfo.pausetime)
-		self->monsterinfo.nextframe = FRAME_attc3;
+	if ((level.time + 0.4) < self->monsterinfo->pausetime)
+		self->monsterinfo->nextframe = FRAME_attc3;
 }
 
 mframe_t ogre_frames_attack3[] =
@@ -489,7 +489,7 @@ void ogre_attack6_refire(edict_t* self)
 		return;
 
 	if (skill->value == 3)
-		self->monsterinfo.nextframe = FRAME_run3;
+		self->monsterinfo->nextframe = FRAME_run3;
 }
 
 mframe_t ogre_frames_attack6[] =
@@ -519,9 +519,9 @@ mmove_t ogre_move_attack6 = { FRAME_run1, FRAME_run18, ogre_frames_attack6, ogre
 void ogre_attack(edict_t* self)
 {
 	if (random() < 0.5)
-		self->monsterinfo.currentmove = &ogre_move_attack1;
+		self->monsterinfo->currentmove = &ogre_move_attack1;
 	else
-		self->monsterinfo.currentmove = &ogre_move_attack2;
+		self->monsterinfo->currentmove = &ogre_move_attack2;
 }
 
 //
@@ -538,7 +538,7 @@ void ogre_sight(edict_t* self, edict_t* other)
 	if ((skill->value > 0) && (AI_GetRange(self, self->enemy) >= RANGE_MID))
 	{
 		if (random() > 0.5)
-			self->monsterinfo.currentmove = &ogre_move_attack6;
+			self->monsterinfo->currentmove = &ogre_move_attack6;
 	}
 }
 
@@ -548,10 +548,10 @@ void ogre_sight(edict_t* self, edict_t* other)
 
 void ogre_duck_hold(edict_t* self)
 {
-	if (level.time >= self->monsterinfo.pausetime)
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+	if (level.time >= self->monsterinfo->pausetime)
+		self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	else
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 }
 
 mframe_t ogre_frames_duck[] =
@@ -577,32 +577,32 @@ void ogre_dodge(edict_t* self, edict_t* attacker, float eta)
 
 	if (skill->value == 0)
 	{
-		self->monsterinfo.currentmove = &ogre_move_duck;
+		self->monsterinfo->currentmove = &ogre_move_duck;
 		return;
 	}
 
-	self->monsterinfo.pausetime = level.time + eta + 0.3f;
+	self->monsterinfo->pausetime = level.time + eta + 0.3f;
 	r = random();
 
 	if (skill->value == 1)
 	{
 		if (r > 0.33f)
-			self->monsterinfo.currentmove = &ogre_move_duck;
+			self->monsterinfo->currentmove = &ogre_move_duck;
 		else
-			self->monsterinfo.currentmove = &ogre_move_attack3;
+			self->monsterinfo->currentmove = &ogre_move_attack3;
 		return;
 	}
 
 	if (skill->value >= 2)
 	{
 		if (r > 0.66f)
-			self->monsterinfo.currentmove = &ogre_move_duck;
+			self->monsterinfo->currentmove = &ogre_move_duck;
 		else
-			self->monsterinfo.currentmove = &ogre_move_attack3;
+			self->monsterinfo->currentmove = &ogre_move_attack3;
 		return;
 	}
 
-	self->monsterinfo.currentmove = &ogre_move_attack3;
+	self->monsterinfo->currentmove = &ogre_move_attack3;
 }
 
 
@@ -616,8 +616,8 @@ void ogre_dead(edict_t* self)
 	VectorSet3(self->maxs, 16, 16, -8);
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
-	self->nextthink = 0;
-	gi.Edict_Link(self);
+	Edict_SetNextThink(self, 0);
+	Edict_Link(self);
 }
 
 mframe_t ogre_frames_death1[] =
@@ -694,9 +694,9 @@ void ogre_die(edict_t* self, edict_t* inflictor, edict_t* attacker, int32_t dama
 
 	n = rand() % 2;
 	if (n == 0)
-		self->monsterinfo.currentmove = &ogre_move_death1;
+		self->monsterinfo->currentmove = &ogre_move_death1;
 	else if (n == 1)
-		self->monsterinfo.currentmove = &ogre_move_death2;
+		self->monsterinfo->currentmove = &ogre_move_death2;
 
 	// TODO: temp until not fucked animations
 	Edict_Free(self);
@@ -708,17 +708,19 @@ void ogre_die(edict_t* self, edict_t* inflictor, edict_t* attacker, int32_t dama
 
 void SP_monster_ogre_x(edict_t* self)
 {
-	self->classname = "monster_ogre"; // for Bamfuslicator
+	Component_Add(self, COMPONENT_MONSTER);
+
+	Edict_SetClassname(self, "monster_ogre"); // for Bamfuslicator
 	self->s.modelindex = gi.modelindex("models/monsters/ogre/tris.md2");
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->scale = MODEL_SCALE;
 	VectorSet3(self->mins, -12, -12, -24);
 	VectorSet3(self->maxs, 12, 12, 24);
 	self->movetype = MOVETYPE_STEP;
 	self->solid = SOLID_BBOX;
-	self->monsterinfo.aiflags |= AI_WANDER;
+	self->monsterinfo->aiflags |= AI_WANDER;
 	// move this?
-	self->monsterinfo.wander_steps_min = 30;
-	self->monsterinfo.wander_steps_max = 50;
+	self->monsterinfo->wander_steps_min = 30;
+	self->monsterinfo->wander_steps_max = 50;
 
 	sound_idle = gi.soundindex("ogre/ogre_idle.wav");
 	sound_sight1 = gi.soundindex("ogre/ogre_sight1.wav");
@@ -732,17 +734,17 @@ void SP_monster_ogre_x(edict_t* self)
 	self->pain = ogre_pain;
 	self->die = ogre_die;
 
-	self->monsterinfo.stand = ogre_stand;
-	self->monsterinfo.walk = ogre_walk;
-	self->monsterinfo.run = ogre_run;
-	self->monsterinfo.dodge = ogre_dodge;
-	self->monsterinfo.attack = ogre_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = ogre_sight;
+	self->monsterinfo->stand = ogre_stand;
+	self->monsterinfo->walk = ogre_walk;
+	self->monsterinfo->run = ogre_run;
+	self->monsterinfo->dodge = ogre_dodge;
+	self->monsterinfo->attack = ogre_attack;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = ogre_sight;
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 
-	self->monsterinfo.stand(self);
+	self->monsterinfo->stand(self);
 
 	AI_MonsterWalkStart(self);
 }
@@ -67,7 +67,7 @@ mmove_t zombie_move_stand1 = { FRAME_stand1, FRAME_stand15, zombie_frames_stand1
 
 void zombie_stand(edict_t* self)
 {
-	self->monsterinfo.currentmove = &zombie_move_stand1;
+	self->monsterinfo->currentmove = &zombie_move_stand1;
 }
 
 //
@@ -77,7 +77,7 @@ void zombie_stand(edict_t* self)
 void zombie_walk1_random(edict_t* self)
 {
 	if (random() > 0.1)
-		self->monsterinfo.nextframe = FRAME_walk1;
+		self->monsterinfo->nextframe = FRAME_walk1;
 }
 
 mframe_t zombie_frames_walk1[] =
@@ -107,7 +107,7 @@ mmove_t zombie_move_walk1 = { FRAME_walk1, FRAME_walk19, zombie_frames_walk1, NU
 void zombie_walk(edict_t* self)
 {
 	// use random to get multiple types of run anim when we have the new zombie models
-	self->monsterinfo.currentmove = &zombie_move_walk1;
+	self->monsterinfo->currentmove = &zombie_move_walk1;
 }
 
 //
@@ -150,20 +150,20 @@ mmove_t zombie_move_run = { FRAME_run3, FRAME_run18, zombie_frames_run, NULL };
 
 void zombie_run(edict_t* self)
 {
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &zombie_move_stand1;
+		self->monsterinfo->currentmove = &zombie_move_stand1;
 		return;
 	}
 
-	if (self->monsterinfo.currentmove == &zombie_move_walk1 ||
-		self->monsterinfo.currentmove == &zombie_move_start_run)
+	if (self->monsterinfo->currentmove == &zombie_move_walk1 ||
+		self->monsterinfo->currentmove == &zombie_move_start_run)
 	{
-		self->monsterinfo.currentmove = &zombie_move_run;
+		self->monsterinfo->currentmove = &zombie_move_run;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &zombie_move_start_run;
+		self->monsterinfo->currentmove = &zombie_move_start_run;
 	}
 }
 
@@ -275,8 +275,8 @@ void zombie_pain(edict_t* self, edict_t* other, float kick, int32_t damage)
 
 	if (level.time < self->pain_debounce_time)
 	{
-		if ((self->velocity[2] > 100) && ((self->monsterinfo.currentmove == &zombie_move_pain1) || (self->monsterinfo.currentmove == &zombie_move_pain2) || (self->monsterinfo.currentmove == &zombie_move_pain3)))
-			self->monsterinfo.currentmove = &zombie_move_pain4;
+		if ((self->velocity[2] > 100) && ((self->monsterinfo->currentmove == &zombie_move_pain1) || (self->monsterinfo->currentmove == &zombie_move_pain2) || (self->monsterinfo->currentmove == &zombie_move_pain3)))
+			self->monsterinfo->currentmove = &zombie_move_pain4;
 		return;
 	}
 
@@ -292,7 +292,7 @@ void zombie_pain(edict_t* self, edict_t* other, float kick, int32_t damage)
 
 	if (self->velocity[2] > 100)
 	{
-		self->monsterinfo.currentmove = &zombie_move_pain4;
+		self->monsterinfo->currentmove = &zombie_move_pain4;
 		return;
 	}
 
@@ -302,11 +302,11 @@ void zombie_pain(edict_t* self, edict_t* other, float kick, int32_t damage)
 	r = random();
 
 	if (r < 0.33)
-		self->monsterinfo.currentmove = &zombie_move_pain1;
+		self->monsterinfo->currentmove = &zombie_move_pain1;
 	else if (r < 0.66)
-		self->monsterinfo.currentmove = &zombie_move_pain2;
+		self->monsterinfo->currentmove = &zombie_move_pain2;
 	else
-		self->monsterinfo.currentmove = &zombie_move_pain3;
+		self->monsterinfo->currentmove = &zombie_move_pain3;
 }
 
 
@@ -335,9 +335,9 @@ void zombie_attack1_refire1(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_atta2;
+		self->monsterinfo->nextframe = FRAME_atta2;
 	else
-		self->monsterinfo.nextframe = FRAME_atta10;
+		self->monsterinfo->nextframe = FRAME_atta10;
 }
 
 void zombie_attack1_refire2(edict_t* self)
@@ -349,7 +349,7 @@ void zombie_attack1_refire2(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_atta2;
+		self->monsterinfo->nextframe = FRAME_atta2;
 }
 
 mframe_t zombie_frames_attack1[] =
@@ -379,9 +379,9 @@ void zombie_attack2_refire1(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_attb4;
+		self->monsterinfo->nextframe = FRAME_attb4;
 	else
-		self->monsterinfo.nextframe = FRAME_attb14;
+		self->monsterinfo->nextframe = FRAME_attb14;
 }
 
 void zombie_attack2_refire2(edict_t* self)
@@ -393,7 +393,7 @@ void zombie_attack2_refire2(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_attb4;
+		self->monsterinfo->nextframe = FRAME_attb4;
 }
 
 mframe_t zombie_frames_attack2[] =
@@ -420,27 +420,27 @@ mmove_t zombie_move_attack2 = { FRAME_attb1, FRAME_attb14, zombie_frames_attack2
 
 void zombie_duck_down(edict_t* self)
 {
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (self->monsterinfo->aiflags & AI_DUCKED)
 		return;
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	self->monsterinfo->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
-	gi.Edict_Link(self);
+	self->monsterinfo->pausetime = level.time + 1;
+	Edict_Link(self);
 }
 
 void zombie_duck_up(edict_t* self)
 {
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	self->monsterinfo->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 void zombie_attack3_refire(edict_t* self)
 {
-	if ((level.time + 0.4) < self->monsterinfo.pausetime)
-		self->monsterinfo.nextframe = FRAME_attc3;
+	if ((level.time + 0.4) < self->monsterinfo->pausetime)
+		self->monsterinfo->nextframe = FRAME_attc3;
 }
 
 mframe_t zombie_frames_attack3[] =
@@ -472,7 +472,7 @@ void zombie_attack6_refire(edict_t* self)
 		return;
 
 	if (skill->value == 3)
-		self->monsterinfo.nextframe = FRAME_run3;
+		self->monsterinfo->nextframe = FRAME_run3;
 }
 
 mframe_t zombie_frames_attack6[] =
@@ -502,9 +502,9 @@ mmove_t zombie_move_attack6 = { FRAME_run1, FRAME_run18, zombie_frames_attack6,
 void zombie_attack(edict_t* self)
 {
 	if (random() < 0.5)
-		self->monsterinfo.currentmove = &zombie_move_attack1;
+		self->monsterinfo->currentmove = &zombie_move_attack1;
 	else
-		self->monsterinfo.currentmove = &zombie_move_attack2;
+		self->monsterinfo->currentmove = &zombie_move_attack2;
 }
 
 //
@@ -521,7 +521,7 @@ void zombie_sight(edict_t* self, edict_t* other)
 	if ((skill->value > 0) && (AI_GetRange(self, self->enemy) >= RANGE_MID))
 	{
 		if (random() > 0.5)
-			self->monsterinfo.currentmove = &zombie_move_attack6;
+			self->monsterinfo->currentmove = &zombie_move_attack6;
 	}
 }
 
@@ -531,10 +531,10 @@ void zombie_sight(edict_t* self, edict_t* other)
 
 void zombie_duck_hold(edict_t* self)
 {
-	if (level.time >= self->monsterinfo.pausetime)
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+	if (level.time >= self->monsterinfo->pausetime)
+		self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	else
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 }
 
 mframe_t zombie_frames_duck[] =
@@ -560,32 +560,32 @@ void zombie_dodge(edict_t* self, edict_t* attacker, float eta)
 
 	if (skill->value == 0)
 	{
-		self->monsterinfo.currentmove = &zombie_move_duck;
+		self->monsterinfo->currentmove = &zombie_move_duck;
 		return;
 	}
 
-	self->monsterinfo.pausetime = level.time + eta + 0.3f;
+	self->monsterinfo->pausetime = level.time + eta + 0.3f;
 	r = random();
 
 	if (skill->value == 1)
 	{
 		if (r > 0.33f)
-			self->monsterinfo.currentmove = &zombie_move_duck;
+			self->monsterinfo->currentmove = &zombie_move_duck;
 		else
-			self->monsterinfo.currentmove = &zombie_move_attack3;
+			self->monsterinfo->currentmove = &zombie_move_attack3;
 		return;
 	}
 
 	if (skill->value >= 2)
 	{
 		if (r > 0.66f)
-			self->monsterinfo.currentmove = &zombie_move_duck;
+			self->monsterinfo->currentmove = &zombie_move_duck;
 		else
-			self->monsterinfo.currentmove = &zombie_move_attack3;
+			self->monsterinfo->currentmove = &zombie_move_attack3;
 		return;
 	}
 
-	self->monsterinfo.currentmove = &zombie_move_attack3;
+	self->monsterinfo->currentmove = &zombie_move_attack3;
 }
 
 
@@ -599,8 +599,8 @@ void zombie_dead(edict_t* self)
 	VectorSet3(self->maxs, 16, 16, -8);
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
-	self->nextthink = 0;
-	gi.Edict_Link(self);
+	Edict_SetNextThink(self, 0);
+	Edict_Link(self);
 }
 
 mframe_t zombie_frames_death1[] =
@@ -678,9 +678,9 @@ void zombie_die(edict_t* self, edict_t* inflictor, edict_t* attacker, int32_t da
 
 	n = rand() % 2;
 	if (n == 0)
-		self->monsterinfo.currentmove = &zombie_move_death1;
+		self->monsterinfo->currentmove = &zombie_move_death1;
 	else if (n == 1)
-		self->monsterinfo.currentmove = &zombie_move_death2;
+		self->monsterinfo->currentmove = &zombie_move_death2;
 
 	// TODO: temp until not fucked animations
 	Edict_Free(self);
@@ -692,17 +692,19 @@ void zombie_die(edict_t* self, edict_t* inflictor, edict_t* attacker, int32_t da
 
 void SP_monster_zombie_x(edict_t* self)
 {
-	self->classname = "monster_zombie"; // for Bamfuslicator
+	Component_Add(self, COMPONENT_MONSTER);
+
+	Edict_SetClassname(self, "monster_zombie"); // for Bamfuslicator
 	self->s.modelindex = gi.modelindex("models/monsters/zombie/tris.md2");
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->scale = MODEL_SCALE;
 	VectorSet3(self->mins, -12, -12, -24);
 	VectorSet3(self->maxs, 12, 12, 24);
 	self->movetype = MOVETYPE_STEP;
 	self->solid = SOLID_BBOX;
-	self->monsterinfo.aiflags |= AI_WANDER;
+	self->monsterinfo->aiflags |= AI_WANDER;
 	// move this?
-	self->monsterinfo.wander_steps_min = 20;
-	self->monsterinfo.wander_steps_max = 100;
+	self->monsterinfo->wander_steps_min = 20;
+	self->monsterinfo->wander_steps_max = 100;
 
 	sound_idle = gi.soundindex("zombie/idle_w2.wav");
 	sound_sight1 = gi.soundindex("zombie/z_idle.wav");
@@ -717,17 +719,17 @@ void SP_monster_zombie_x(edict_t* self)
 	self->pain = zombie_pain;
 	self->die = zombie_die;
 
-	self->monsterinfo.stand = zombie_stand;
-	self->monsterinfo.walk = zombie_walk;
-	self->monsterinfo.run = zombie_run;
-	self->monsterinfo.dodge = zombie_dodge;
-	self->monsterinfo.attack = zombie_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = zombie_sight;
+	self->monsterinfo->stand = zombie_stand;
+	self->monsterinfo->walk = zombie_walk;
+	self->monsterinfo->run = zombie_run;
+	self->monsterinfo->dodge = zombie_dodge;
+	self->monsterinfo->attack = zombie_attack;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = zombie_sight;
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 
-	self->monsterinfo.stand(self);
+	self->monsterinfo->stand(self);
 
 	AI_MonsterWalkStart(self);
 }
@@ -79,7 +79,7 @@ mmove_t zombie_fast_move_stand1 = { FRAME_stand1, FRAME_stand15, zombie_fast_fra
 
 void zombie_fast_stand(edict_t* self)
 {
-	self->monsterinfo.currentmove = &zombie_fast_move_stand1;
+	self->monsterinfo->currentmove = &zombie_fast_move_stand1;
 }
 
 //
@@ -89,7 +89,7 @@ void zombie_fast_stand(edict_t* self)
 void zombie_fast_walk1_random(edict_t* self)
 {
 	if (random() > 0.1)
-		self->monsterinfo.nextframe = FRAME_walk1;
+		self->monsterinfo->nextframe = FRAME_walk1;
 }
 
 mframe_t zombie_fast_frames_walk1[] =
@@ -119,7 +119,7 @@ mmove_t zombie_fast_move_walk1 = { FRAME_walk1, FRAME_walk19, zombie_fast_frames
 void zombie_fast_walk(edict_t* self)
 {
 	// use random to get multiple types of run anim when we have the new zombie models
-	self->monsterinfo.currentmove = &zombie_fast_move_walk1;
+	self->monsterinfo->currentmove = &zombie_fast_move_walk1;
 }
 
 //
@@ -162,20 +162,20 @@ mmove_t zombie_fast_move_run = { FRAME_run3, FRAME_run18, zombie_fast_frames_run
 
 void zombie_fast_run(edict_t* self)
 {
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &zombie_fast_move_stand1;
+		self->monsterinfo->currentmove = &zombie_fast_move_stand1;
 		return;
 	}
 
-	if (self->monsterinfo.currentmove == &zombie_fast_move_walk1 ||
-		self->monsterinfo.currentmove == &zombie_fast_move_start_run)
+	if (self->monsterinfo->currentmove == &zombie_fast_move_walk1 ||
+		self->monsterinfo->currentmove == &zombie_fast_move_start_run)
 	{
-		self->monsterinfo.currentmove = &zombie_fast_move_run;
+		self->monsterinfo->currentmove = &zombie_fast_move_run;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &zombie_fast_move_start_run;
+		self->monsterinfo->currentmove = &zombie_fast_move_start_run;
 	}
 }
 
@@ -287,8 +287,8 @@ void zombie_fast_pain(edict_t* self, edict_t* other, float kick, int32_t damage)
 
 	if (level.time < self->pain_debounce_time)
 	{
-		if ((self->velocity[2] > 100) && ((self->monsterinfo.currentmove == &zombie_fast_move_pain1) || (self->monsterinfo.currentmove == &zombie_fast_move_pain2) || (self->monsterinfo.currentmove == &zombie_fast_move_pain3)))
-			self->monsterinfo.currentmove = &zombie_fast_move_pain4;
+		if ((self->velocity[2] > 100) && ((self->monsterinfo->currentmove == &zombie_fast_move_pain1) || (self->monsterinfo->currentmove == &zombie_fast_move_pain2) || (self->monsterinfo->currentmove == &zombie_fast_move_pain3)))
+			self->monsterinfo->currentmove = &zombie_fast_move_pain4;
 		return;
 	}
 
@@ -304,7 +304,7 @@ void zombie_fast_pain(edict_t* self, edict_t* other, float kick, int32_t damage)
 
 	if (self->velocity[2] > 100)
 	{
-		self->monsterinfo.currentmove = &zombie_fast_move_pain4;
+		self->monsterinfo->currentmove = &zombie_fast_move_pain4;
 		return;
 	}
 
@@ -314,11 +314,11 @@ void zombie_fast_pain(edict_t* self, edict_t* other, float kick, int32_t damage)
 	r = random();
 
 	if (r < 0.33)
-		self->monsterinfo.currentmove = &zombie_fast_move_pain1;
+		self->monsterinfo->currentmove = &zombie_fast_move_pain1;
 	else if (r < 0.66)
-		self->monsterinfo.currentmove = &zombie_fast_move_pain2;
+		self->monsterinfo->currentmove = &zombie_fast_move_pain2;
 	else
-		self->monsterinfo.currentmove = &zombie_fast_move_pain3;
+		self->monsterinfo->currentmove = &zombie_fast_move_pain3;
 }
 
 
@@ -347,9 +347,9 @@ void zombie_fast_attack1_refire1(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_atta2;
+		self->monsterinfo->nextframe = FRAME_atta2;
 	else
-		self->monsterinfo.nextframe = FRAME_atta10;
+		self->monsterinfo->nextframe = FRAME_atta10;
 }
 
 void zombie_fast_attack1_refire2(edict_t* self)
@@ -361,7 +361,7 @@ void zombie_fast_attack1_refire2(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_atta2;
+		self->monsterinfo->nextframe = FRAME_atta2;
 }
 
 mframe_t zombie_fast_frames_attack1[] =
@@ -391,9 +391,9 @@ void zombie_fast_attack2_refire1(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_attb4;
+		self->monsterinfo->nextframe = FRAME_attb4;
 	else
-		self->monsterinfo.nextframe = FRAME_attb14;
+		self->monsterinfo->nextframe = FRAME_attb14;
 }
 
 void zombie_fast_attack2_refire2(edict_t* self)
@@ -405,7 +405,7 @@ void zombie_fast_attack2_refire2(edict_t* self)
 		return;
 
 	if (((skill->value == 3) && (random() < 0.5)) || (AI_GetRange(self, self->enemy) == RANGE_MELEE))
-		self->monsterinfo.nextframe = FRAME_attb4;
+		self->monsterinfo->nextframe = FRAME_attb4;
 }
 
 mframe_t zombie_fast_frames_attack2[] =
@@ -432,27 +432,27 @@ mmove_t zombie_fast_move_attack2 = { FRAME_attb1, FRAME_attb14, zombie_fast_fram
 
 void zombie_fast_duck_down(edict_t* self)
 {
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (self->monsterinfo->aiflags & AI_DUCKED)
 		return;
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	self->monsterinfo->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
-	gi.Edict_Link(self);
+	self->monsterinfo->pausetime = level.time + 1;
+	Edict_Link(self);
 }
 
 void zombie_fast_duck_up(edict_t* self)
 {
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	self->monsterinfo->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
-	gi.Edict_Link(self);
+	Edict_Link(self);
 }
 
 void zombie_fast_attack3_refire(edict_t* self)
 {
-	if ((level.time + 0.4) < self->monsterinfo.pausetime)
-		self->monsterinfo.nextframe = FRAME_attc3;
+	if ((level.time + 0.4) < self->monsterinfo->pausetime)
+		self->monsterinfo->nextframe = FRAME_attc3;
 }
 
 mframe_t zombie_fast_frames_attack3[] =
@@ -484,7 +484,7 @@ void zombie_fast_attack6_refire(edict_t* self)
 		return;
 
 	if (skill->value == 3)
-		self->monsterinfo.nextframe = FRAME_run3;
+		self->monsterinfo->nextframe = FRAME_run3;
 }
 
 // for fastzombies this is a charge
@@ -515,9 +515,9 @@ mmove_t zombie_fast_move_attack6 = { FRAME_run1, FRAME_run18, zombie_fast_frames
 void zombie_fast_attack(edict_t* self)
 {
 	if (random() < 0.5)
-		self->monsterinfo.currentmove = &zombie_fast_move_attack1;
+		self->monsterinfo->currentmove = &zombie_fast_move_attack1;
 	else
-		self->monsterinfo.currentmove = &zombie_fast_move_attack2;
+		self->monsterinfo->currentmove = &zombie_fast_move_attack2;
 }
 
 //
@@ -534,7 +534,7 @@ void zombie_fast_sight(edict_t* self, edict_t* other)
 	if ((skill->value > 0) && (AI_GetRange(self, self->enemy) >= RANGE_MID))
 	{
 		if (random() > 0.5)
-			self->monsterinfo.currentmove = &zombie_fast_move_attack6;
+			self->monsterinfo->currentmove = &zombie_fast_move_attack6;
 	}
 }
 
@@ -544,10 +544,10 @@ void zombie_fast_sight(edict_t* self, edict_t* other)
 
 void zombie_fast_duck_hold(edict_t* self)
 {
-	if (level.time >= self->monsterinfo.pausetime)
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+	if (level.time >= self->monsterinfo->pausetime)
+		self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	else
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 }
 
 mframe_t zombie_fast_frames_duck[] =
@@ -573,32 +573,32 @@ void zombie_fast_dodge(edict_t* self, edict_t* attacker, float eta)
 
 	if (skill->value == 0)
 	{
-		self->monsterinfo.currentmove = &zombie_fast_move_duck;
+		self->monsterinfo->currentmove = &zombie_fast_move_duck;
 		return;
 	}
 
-	self->monsterinfo.pausetime = level.time + eta + 0.3f;
+	self->monsterinfo->pausetime = level.time + eta + 0.3f;
 	r = random();
 
 	if (skill->value == 1)
 	{
 		if (r > 0.33f)
-			self->monsterinfo.currentmove = &zombie_fast_move_duck;
+			self->monsterinfo->currentmove = &zombie_fast_move_duck;
 		else
-			self->monsterinfo.currentmove = &zombie_fast_move_attack3;
+			self->monsterinfo->currentmove = &zombie_fast_move_attack3;
 		return;
 	}
 
 	if (skill->value >= 2)
 	{
 		if (r > 0.66f)
-			self->monsterinfo.currentmove = &zombie_fast_move_duck;
+			self->monsterinfo->currentmove = &zombie_fast_move_duck;
 		else
-			self->monsterinfo.currentmove = &zombie_fast_move_attack3;
+			self->monsterinfo->currentmove = &zombie_fast_move_attack3;
 		return;
 	}
 
-	self->monsterinfo.currentmove = &zombie_fast_move_attack3;
+	self->monsterinfo->currentmove = &zombie_fast_move_attack3;
 }
 
 
@@ -612,8 +612,8 @@ void zombie_fast_dead(edict_t* self)
 	VectorSet3(self->maxs, 16, 16, -8);
 	self->movetype = MOVETYPE_TOSS;
 	self->svflags |= SVF_DEADMONSTER;
-	self->nextthink = 0;
-	gi.Edict_Link(self);
+	Edict_SetNextThink(self, 0);
+	Edict_Link(self);
 }
 
 mframe_t zombie_fast_frames_death1[] =
@@ -691,9 +691,9 @@ void zombie_fast_die(edict_t* self, edict_t* inflictor, edict_t* attacker, int32
 
 	n = rand() % 2;
 	if (n == 0)
-		self->monsterinfo.currentmove = &zombie_fast_move_death1;
+		self->monsterinfo->currentmove = &zombie_fast_move_death1;
 	else if (n == 1)
-		self->monsterinfo.currentmove = &zombie_fast_move_death2;
+		self->monsterinfo->currentmove = &zombie_fast_move_death2;
 
 	// TODO: temp until not fucked animations
 	Edict_Free(self);
@@ -706,17 +706,19 @@ void zombie_fast_die(edict_t* self, edict_t* inflictor, edict_t* attacker, int32
 
 void SP_monster_zombie_fast_x(edict_t* self)
 {
-	self->classname = "monster_zombie_fast"; // for Bamfuslicator
+	Component_Add(self, COMPONENT_MONSTER);
+
+	Edict_SetClassname(self, "monster_zombie_fast"); // for Bamfuslicator
 	self->s.modelindex = gi.modelindex("models/monsters/zombie_fast/tris.md2");
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->scale = MODEL_SCALE;
 	VectorSet3(self->mins, -16, -16, -24);
 	VectorSet3(self->maxs, 16, 16, 32);
 	self->movetype = MOVETYPE_STEP;
 	self->solid = SOLID_BBOX;
-	self->monsterinfo.aiflags |= AI_WANDER;
+	self->monsterinfo->aiflags |= AI_WANDER;
 	// move this?
-	self->monsterinfo.wander_steps_min = 5;
-	self->monsterinfo.wander_steps_max = 20;
+	self->monsterinfo->wander_steps_min = 5;
+	self->monsterinfo->wander_steps_max = 20;
 
 	sound_idle = gi.soundindex("zombie/idle_w2.wav");
 	sound_sight1 = gi.soundindex("zombie/z_idle.wav");
@@ -731,17 +733,17 @@ void SP_monster_zombie_fast_x(edict_t* self)
 	self->pain = zombie_fast_pain;
 	self->die = zombie_fast_die;
 
-	self->monsterinfo.stand = zombie_fast_stand;
-	self->monsterinfo.walk = zombie_fast_walk;
-	self->monsterinfo.run = zombie_fast_run;
-	self->monsterinfo.dodge = zombie_fast_dodge;
-	self->monsterinfo.attack = zombie_fast_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = zombie_fast_sight;
+	self->monsterinfo->stand = zombie_fast_stand;
+	self->monsterinfo->walk = zombie_fast_walk;
+	self->monsterinfo->run = zombie_fast_run;
+	self->monsterinfo->dodge = zombie_fast_dodge;
+	self->monsterinfo->attack = zombie_fast_attack;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = zombie_fast_sight;
 
-	gi.Edict_Link(self);
+	Edict_Link(self);
 
-	self->monsterinfo.stand(self);
+	self->monsterinfo->stand(self);
 
 	AI_MonsterWalkStart(self);
 }
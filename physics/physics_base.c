@@ -55,7 +55,7 @@ edict_t* SV_TestEntityPosition(edict_t* ent)
 		mask = ent->clipmask;
 	else
 		mask = MASK_SOLID;
-	trace = gi.trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin, ent, mask);
+	trace = Game_Trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin, ent, mask);
 
 	if (trace.startsolid)
 		return g_edicts;
@@ -102,12 +102,12 @@ bool SV_RunThink(edict_t* ent)
 	if (thinktime > level.time + 0.001)
 		return true;
 
-	ent->nextthink = 0;
+	Edict_SetNextThink(ent, 0);
 
 	if (!ent->think)
 		gi.error("NULL ent->think");
 
-	ent->think(ent);
+	Profile_CallThink(ent);
 
 	return false;
 }
@@ -127,10 +127,10 @@ void SV_Impact(edict_t* e1, trace_t* trace)
 	e2 = trace->ent;
 
 	if (e1->touch && e1->solid != SOLID_NOT)
-		e1->touch(e1, e2, &trace->plane, trace->surface);
+		Profile_CallTouch(e1, e2, &trace->plane, trace->surface);
 
 	if (e2->touch && e2->solid != SOLID_NOT)
-		e2->touch(e2, e1, NULL, NULL);
+		Profile_CallTouch(e2, e1, NULL, NULL);
 }
 
 
@@ -212,7 +212,7 @@ int32_t SV_FlyMove(edict_t* ent, float time, int32_t mask)
 		for (i = 0; i < 3; i++)
 			end[i] = ent->s.origin[i] + time_left * ent->velocity[i];
 
-		trace = gi.trace(ent->s.origin, ent->mins, ent->maxs, end, ent, mask);
+		trace = Game_Trace(ent->s.origin, ent->mins, ent->maxs, end, ent, mask);
 
 		if (trace.allsolid)
 		{	// entity is trapped in another solid
@@ -357,10 +357,10 @@ retry:
 	else
 		mask = MASK_SOLID;
 
-	trace = gi.trace(start, ent->mins, ent->maxs, end, ent, mask);
+	trace = Game_Trace(start, ent->mins, ent->maxs, end, ent, mask);
 
 	VectorCopy3(trace.endpos, ent->s.origin);
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 
 	if (trace.fraction != 1.0)
 	{
@@ -371,7 +371,7 @@ retry:
 		{
 			// move the pusher back and try again
 			VectorCopy3(start, ent->s.origin);
-			gi.Edict_Link(ent);
+			Edict_Link(ent);
 			goto retry;
 		}
 	}
@@ -390,7 +390,9 @@ typedef struct
 	vec3_t	angles;
 	float	deltayaw;
 } pushed_t;
-pushed_t	pushed[MAX_EDICTS], * pushed_p;
+
+// from the frame arena for each SV_Physics_Pusher
+static pushed_t* pushed, * pushed_p, * pushed_end;
 
 edict_t* obstacle;
 
@@ -404,7 +406,7 @@ otherwise riders would continue to slide.
 */
 bool SV_Push(edict_t* pusher, vec3_t move, vec3_t amove)
 {
-	int			i, e;
+	int			i;
 	edict_t* check, * block;
 	vec3_t		mins, maxs;
 	pushed_t* p;
@@ -435,6 +437,9 @@ bool SV_Push(edict_t* pusher, vec3_t move, vec3_t amove)
 	AngleVectors(org, forward, right, up);
 
 	// save the pusher's original position
+	if (pushed_p >= pushed_end)
+		gi.error("SV_Push: out of room in the pushed list");
+
 	pushed_p->ent = pusher;
 	VectorCopy3(pusher->s.origin, pushed_p->origin);
 	VectorCopy3(pusher->s.angles, pushed_p->angles);
@@ -445,14 +450,11 @@ bool SV_Push(edict_t* pusher, vec3_t move, vec3_t amove)
 	// move the pusher to it's final position
 	VectorAdd3(pusher->s.origin, move, pusher->s.origin);
 	VectorAdd3(pusher->s.angles, amove, pusher->s.angles);
-	gi.Edict_Link(pusher);
+	Edict_Link(pusher);
 
 	// see if any solid entities are inside the final position
-	check = g_edicts + 1;
-	for (e = 1; e < globals.num_edicts; e++, check++)
+	for (check = EdictList_Next(g_edicts); check; check = EdictList_Next(check))
 	{
-		if (!check->inuse)
-			continue;
 		if (check->movetype == MOVETYPE_PUSH
 			|| check->movetype == MOVETYPE_STOP
 			|| check->movetype == MOVETYPE_NONE
@@ -482,6 +484,9 @@ bool SV_Push(edict_t* pusher, vec3_t move, vec3_t amove)
 		if ((pusher->movetype == MOVETYPE_PUSH) || (check->groundentity == pusher))
 		{
 			// move this entity
+			if (pushed_p >= pushed_end)
+				gi.error("SV_Push: out of room in the pushed list");
+
 			pushed_p->ent = check;
 			VectorCopy3(check->s.origin, pushed_p->origin);
 			VectorCopy3(check->s.angles, pushed_p->angles);
@@ -509,7 +514,7 @@ bool SV_Push(edict_t* pusher, vec3_t move, vec3_t amove)
 			block = SV_TestEntityPosition(check);
 			if (!block)
 			{	// pushed ok
-				gi.Edict_Link(check);
+				Edict_Link(check);
 				// impact?
 				continue;
 			}
@@ -540,7 +545,7 @@ bool SV_Push(edict_t* pusher, vec3_t move, vec3_t amove)
 			{
 				p->ent->client->ps.pmove.delta_angles[YAW] = p->deltayaw;
 			}
-			gi.Edict_Link(p->ent);
+			Edict_Link(p->ent);
 		}
 		return false;
 	}
@@ -565,11 +570,28 @@ void SV_Physics_Pusher(edict_t* ent)
 {
 	vec3_t		move, amove;
 	edict_t* part, * mv;
+	int32_t		parts, count, mark;
 
 	// if not a team captain, so movement will be handled elsewhere
 	if (ent->flags & FL_TEAMSLAVE)
 		return;
 
+	// each part pushes itself and at most every other edict once, capped at the
+	// MAX_EDICTS the fixed list used to hold so a long team still fits in the arena
+	parts = 0;
+
+	for (part = ent; part; part = part->teamchain)
+		parts++;
+
+	count = parts * globals.num_edicts;
+
+	if (count > MAX_EDICTS)
+		count = MAX_EDICTS;
+
+	mark = FrameArena_Mark();
+	pushed = FrameArena_Array(pushed_t, count);
+	pushed_end = pushed + count;
+
 	// make sure all team slaves can move before commiting
 	// any moves or calling any think functions
 	// if the move is blocked, all moved objects will be backed out
@@ -588,8 +610,7 @@ void SV_Physics_Pusher(edict_t* ent)
 				break;	// move was blocked
 		}
 	}
-	if (pushed_p > &pushed[MAX_EDICTS])
-		gi.error(ERR_FATAL, "pushed_p > &pushed[MAX_EDICTS], memory corrupted");
+	FrameArena_Release(mark);
 
 	if (part)
 	{
@@ -597,7 +618,7 @@ void SV_Physics_Pusher(edict_t* ent)
 		for (mv = ent; mv; mv = mv->teamchain)
 		{
 			if (mv->nextthink > 0)
-				mv->nextthink += TICK_TIME;
+				Edict_SetNextThink(mv, mv->nextthink + TICK_TIME);
 		}
 
 		// if the pusher has a "blocked" function, call it
@@ -646,7 +667,7 @@ void SV_Physics_Noclip(edict_t* ent)
 	VectorMA3(ent->s.angles, TICK_TIME, ent->avelocity, ent->s.angles);
 	VectorMA3(ent->s.origin, TICK_TIME, ent->velocity, ent->s.origin);
 
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 }
 
 /*
@@ -738,7 +759,7 @@ void SV_Physics_Toss(edict_t* ent)
 
 	// check for water transition
 	wasinwater = (ent->watertype & MASK_WATER);
-	ent->watertype = gi.pointcontents(ent->s.origin);
+	ent->watertype = Game_PointContents(ent->s.origin);
 	isinwater = ent->watertype & MASK_WATER;
 
 	if (isinwater)
@@ -755,8 +776,74 @@ void SV_Physics_Toss(edict_t* ent)
 	for (slave = ent->teamchain; slave; slave = slave->teamchain)
 	{
 		VectorCopy3(ent->s.origin, slave->s.origin);
-		gi.Edict_Link(slave);
+		Edict_Link(slave);
+	}
+}
+
+/*
+=============
+SV_Physics_Gib
+
+Toss and bounce for pooled gibs and debris. They are SOLID_NOT and never
+touch anything, so this leaves out the triggers, water checks, team slaves
+and touch retries SV_Physics_Toss does, and only relinks them if they moved.
+=============
+*/
+void SV_Physics_Gib(edict_t* ent)
+{
+	trace_t		trace;
+	vec3_t		end;
+	float		backoff;
+
+	SV_RunThink(ent);
+
+	if (!ent->inuse)
+		return;
+
+	if (ent->velocity[2] > 0)
+		ent->groundentity = NULL;
+
+	if (ent->groundentity
+		&& !ent->groundentity->inuse)
+		ent->groundentity = NULL;
+
+	if (ent->groundentity)
+		return;
+
+	if (!Batch_Take(ent, end))
+	{
+		SV_CheckVelocity(ent);
+		SV_AddGravity(ent);
+		VectorMA3(ent->s.origin, TICK_TIME, ent->velocity, end);
 	}
+
+	VectorMA3(ent->s.angles, TICK_TIME, ent->avelocity, ent->s.angles);
+
+	trace = Game_Trace(ent->s.origin, ent->mins, ent->maxs, end, ent, MASK_SOLID);
+
+	if (trace.fraction > 0)
+	{
+		VectorCopy3(trace.endpos, ent->s.origin);
+		Edict_Link(ent);
+	}
+
+	if (trace.fraction < 1)
+	{
+		backoff = (ent->movetype == MOVETYPE_BOUNCE) ? 1.5f : 1.0f;
+		ClipVelocity(ent->velocity, trace.plane.normal, ent->velocity, backoff);
+
+		// stop if on ground
+		if (trace.plane.normal[2] > 0.7
+			&& (ent->velocity[2] < 60 || ent->movetype != MOVETYPE_BOUNCE))
+		{
+			ent->groundentity = trace.ent;
+			ent->groundentity_linkcount = trace.ent->linkcount;
+			VectorCopy3(vec3_origin, ent->velocity);
+			VectorCopy3(vec3_origin, ent->avelocity);
+		}
+	}
+
+	Batch_Sync(ent);
 }
 
 /*
@@ -911,7 +998,7 @@ void SV_Physics_Step(edict_t* ent)
 
 		SV_FlyMove(ent, TICK_TIME, mask);
 
-		gi.Edict_Link(ent);
+		Edict_Link(ent);
 
 		Edict_TouchTriggers(ent);
 
@@ -941,6 +1028,8 @@ G_RunEntity
 */
 void Physics_RunEntity(edict_t* ent)
 {
+	Trace_Begin(ent->classid ? Class_Name(ent->classid) : "entity", ent - g_edicts);
+
 	if (ent->prethink)
 		ent->prethink(ent);
 
@@ -961,6 +1050,11 @@ void Physics_RunEntity(edict_t* ent)
 		break;
 	case MOVETYPE_TOSS:
 	case MOVETYPE_BOUNCE:
+		if (ent->gib_pooled)
+			SV_Physics_Gib(ent);
+		else
+			SV_Physics_Toss(ent);
+		break;
 	case MOVETYPE_FLY:
 	case MOVETYPE_FLYMISSILE:
 		SV_Physics_Toss(ent);
@@ -968,4 +1062,94 @@ void Physics_RunEntity(edict_t* ent)
 	default:
 		gi.error("SV_Physics: bad movetype %i", (int32_t)ent->movetype);
 	}
+
+	Trace_End();
+}
+
+/*
+================
+Physics_RunProjectile
+
+Runs a pooled projectile for the frame. They are all toss, bounce or fly
+missiles with no prethink or team, so this does what G_RunFrame and
+SV_Physics_Toss would for one, without going through the dispatch,
+per-entity tracing and class profiling.
+================
+*/
+void Physics_RunProjectile(edict_t* ent)
+{
+	trace_t		trace;
+	vec3_t		move, end;
+	vec3_t		old_origin;
+	bool		wasinwater;
+
+	level.current_entity = ent;
+	VectorCopy3(ent->s.origin, ent->s.old_origin);
+
+	// grenades resting on something that has moved
+	if (ent->groundentity
+		&& (!ent->groundentity->inuse || ent->groundentity->linkcount != ent->groundentity_linkcount))
+		ent->groundentity = NULL;
+
+	SV_RunThink(ent);
+
+	if (!ent->inuse)
+		return;
+
+	if (ent->velocity[2] > 0)
+		ent->groundentity = NULL;
+
+	if (ent->groundentity)
+		return;
+
+	VectorCopy3(ent->s.origin, old_origin);
+
+	if (Batch_Take(ent, end))
+	{
+		VectorSubtract3(end, ent->s.origin, move);
+	}
+	else
+	{
+		SV_CheckVelocity(ent);
+
+		if (ent->movetype != MOVETYPE_FLY
+			&& ent->movetype != MOVETYPE_FLYMISSILE)
+			SV_AddGravity(ent);
+
+		VectorScale3(ent->velocity, TICK_TIME, move);
+	}
+
+	VectorMA3(ent->s.angles, TICK_TIME, ent->avelocity, ent->s.angles);
+
+	trace = SV_PushEntity(ent, move);
+
+	if (!ent->inuse)
+		return;
+
+	if (trace.fraction < 1)
+	{
+		ClipVelocity(ent->velocity, trace.plane.normal, ent->velocity, (ent->movetype == MOVETYPE_BOUNCE) ? 1.5f : 1.0f);
+
+		// stop if on ground
+		if (trace.plane.normal[2] > 0.7
+			&& (ent->velocity[2] < 60 || ent->movetype != MOVETYPE_BOUNCE))
+		{
+			ent->groundentity = trace.ent;
+			ent->groundentity_linkcount = trace.ent->linkcount;
+			VectorCopy3(vec3_origin, ent->velocity);
+			VectorCopy3(vec3_origin, ent->avelocity);
+		}
+	}
+
+	// the explosions go by waterlevel
+	wasinwater = (ent->watertype & MASK_WATER);
+	ent->watertype = Game_PointContents(ent->s.origin);
+	ent->waterlevel = (ent->watertype & MASK_WATER) ? 1 : 0;
+
+	if (!wasinwater && ent->waterlevel)
+		gi.positioned_sound(old_origin, g_edicts, CHAN_AUTO, gi.soundindex("misc/h2ohit1.wav"), 1, 1, 0);
+	else if (wasinwater && !ent->waterlevel)
+		gi.positioned_sound(ent->s.origin, g_edicts, CHAN_AUTO, gi.soundindex("misc/h2ohit1.wav"), 1, 1, 0);
+
+	Batch_Sync(ent);
 }
@@ -0,0 +1,315 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// physics_batch.c : Batched integration for gibs and projectiles
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+BALLISTIC MIRROR
+
+==============================================================================
+
+The velocity clamp, gravity and integration steps of SV_Physics_Gib and
+Physics_RunProjectile only read origin, velocity, gravity and movetype, but
+running them one entity at a time pulls in the whole edict_t for each. The
+mirror keeps those fields for every pooled gib and projectile in parallel
+arrays, and Batch_Integrate runs the three steps for all of them at the
+start of the frame as plain loops over the arrays, which the compiler turns
+into SIMD. The entity's own step then picks up its new velocity and the end
+point to trace to with Batch_Take.
+
+The mirror is written when one of them is linked, and by Batch_Sync when its
+own step finishes or something else changes its velocity (Edict_Wake). An
+entry written after Batch_Integrate ran is stale for this frame, as is one
+whose edict no longer matches it, and Batch_Take refuses it so the step does
+the work itself. sv_physbatch 0 turns the
+batching off.
+*/
+
+#define BATCH_MAX		MAX_EDICTS
+
+typedef struct batch_stats_s
+{
+	int32_t		integrated;		// entries Batch_Integrate moved last frame
+	int32_t		taken;			// ...that were used
+} batch_stats_t;
+
+// the arrays are split by axis so each loop runs over one contiguous run of floats
+static float			batch_origin[3][BATCH_MAX];
+static float			batch_velocity[3][BATCH_MAX];
+static float			batch_next[3][BATCH_MAX];		// velocity after this frame's clamp and gravity
+static float			batch_end[3][BATCH_MAX];
+static float			batch_gravity[BATCH_MAX];		// ent->gravity, 0 for fly missiles
+static float			batch_airborne[BATCH_MAX];		// 1 if off the ground, 0 if resting
+static uint8_t			batch_fresh[BATCH_MAX];			// integrated this frame and not written since
+static int32_t			batch_ent[BATCH_MAX];
+static int32_t			batch_count;
+
+static batch_stats_t	batch_stats;
+
+static bool Batch_Wants(edict_t* ent)
+{
+	return (ent->inuse
+		&& (ent->gib_pooled || ent->projectile_pooled));
+}
+
+/*
+=============
+Batch_Sync
+
+Copies ent's hot fields into the mirror, adding it if it isn't there yet
+=============
+*/
+void Batch_Sync(edict_t* ent)
+{
+	int32_t	slot, axis;
+
+	if (!ent->batch_slot)
+	{
+		if (!Batch_Wants(ent)
+			|| batch_count >= BATCH_MAX)
+			return;
+
+		batch_ent[batch_count] = ent - g_edicts;
+		ent->batch_slot = ++batch_count;
+	}
+
+	slot = ent->batch_slot - 1;
+
+	for (axis = 0; axis < 3; axis++)
+	{
+		batch_origin[axis][slot] = ent->s.origin[axis];
+		batch_velocity[axis][slot] = ent->velocity[axis];
+	}
+
+	if (ent->movetype == MOVETYPE_FLY
+		|| ent->movetype == MOVETYPE_FLYMISSILE)
+		batch_gravity[slot] = 0;
+	else
+		batch_gravity[slot] = ent->gravity;
+
+	batch_airborne[slot] = ent->groundentity ? 0.0f : 1.0f;
+	batch_fresh[slot] = false;
+}
+
+/*
+=============
+Batch_Remove
+
+Takes ent out of the mirror, called when it is freed or recycled
+=============
+*/
+void Batch_Remove(edict_t* ent)
+{
+	int32_t	slot, last, axis;
+
+	if (!ent->batch_slot)
+		return;
+
+	slot = ent->batch_slot - 1;
+	last = --batch_count;
+	ent->batch_slot = 0;
+
+	if (slot == last)
+		return;
+
+	// move the last entry into the hole
+	for (axis = 0; axis < 3; axis++)
+	{
+		batch_origin[axis][slot] = batch_origin[axis][last];
+		batch_velocity[axis][slot] = batch_velocity[axis][last];
+		batch_next[axis][slot] = batch_next[axis][last];
+		batch_end[axis][slot] = batch_end[axis][last];
+	}
+
+	batch_gravity[slot] = batch_gravity[last];
+	batch_airborne[slot] = batch_airborne[last];
+	batch_fresh[slot] = batch_fresh[last];
+	batch_ent[slot] = batch_ent[last];
+	g_edicts[batch_ent[slot]].batch_slot = slot + 1;
+}
+
+/*
+=============
+Batch_Clear
+
+Empties the mirror, called when the edicts are wiped for a new level
+=============
+*/
+void Batch_Clear()
+{
+	batch_count = 0;
+}
+
+/*
+=============
+Batch_Rebuild
+
+Refills the mirror after a level load, the saved slots are meaningless
+=============
+*/
+void Batch_Rebuild()
+{
+	edict_t*	ent;
+	int32_t		i;
+
+	Batch_Clear();
+
+	for (i = 0, ent = g_edicts; i < globals.num_edicts; i++, ent++)
+	{
+		ent->batch_slot = 0;
+		Batch_Sync(ent);
+	}
+}
+
+/*
+=============
+Batch_Integrate
+
+Clamps, adds gravity to and moves every entry in the mirror, the same steps
+SV_CheckVelocity, SV_AddGravity and the move in SV_Physics_Toss take. Called
+once a frame before anything is run.
+=============
+*/
+void Batch_Integrate()
+{
+	float	max_velocity, gravity;
+	float*	velocity;
+	float*	next;
+	float*	origin;
+	float*	end;
+	int32_t	i, axis, count;
+
+	count = batch_count;
+	batch_stats.integrated = batch_stats.taken = 0;
+
+	if (sv_physbatch->value <= 0)
+	{
+		memset(batch_fresh, 0, count);
+		return;
+	}
+
+	max_velocity = sv_maxvelocity->value;
+	gravity = sv_gravity->value;
+
+	// the mirror itself is only written by Batch_Sync, so an entry that isn't taken
+	// this frame doesn't get its gravity twice
+	for (axis = 0; axis < 3; axis++)
+	{
+		velocity = batch_velocity[axis];
+		next = batch_next[axis];
+
+		for (i = 0; i < count; i++)
+			next[i] = (velocity[i] > max_velocity) ? max_velocity : ((velocity[i] < -max_velocity) ? -max_velocity : velocity[i]);
+	}
+
+	// resting entries have 0 for airborne, so they don't pick up any speed
+	next = batch_next[2];
+
+	for (i = 0; i < count; i++)
+		next[i] -= batch_gravity[i] * gravity * TICK_TIME * batch_airborne[i];
+
+	for (axis = 0; axis < 3; axis++)
+	{
+		next = batch_next[axis];
+		origin = batch_origin[axis];
+		end = batch_end[axis];
+
+		for (i = 0; i < count; i++)
+			end[i] = origin[i] + next[i] * TICK_TIME;
+	}
+
+	for (i = 0; i < count; i++)
+		batch_fresh[i] = (batch_airborne[i] != 0.0f);
+
+	batch_stats.integrated = count;
+}
+
+/*
+=============
+Batch_Take
+
+If Batch_Integrate has already moved ent this frame, gives it the velocity
+it worked out, puts where it should move to in end and returns true.
+Otherwise ent has to do it itself.
+=============
+*/
+bool Batch_Take(edict_t* ent, vec3_t end)
+{
+	int32_t	slot, axis;
+
+	if (!ent->batch_slot)
+		return false;
+
+	slot = ent->batch_slot - 1;
+
+	if (!batch_fresh[slot])
+		return false;
+
+	batch_fresh[slot] = false;
+
+	// something moved it without telling the mirror, a think or a push
+	for (axis = 0; axis < 3; axis++)
+	{
+		if (ent->s.origin[axis] != batch_origin[axis][slot]
+			|| ent->velocity[axis] != batch_velocity[axis][slot])
+			return false;
+	}
+
+	for (axis = 0; axis < 3; axis++)
+	{
+		ent->velocity[axis] = batch_next[axis][slot];
+		end[axis] = batch_end[axis][slot];
+	}
+
+	batch_stats.taken++;
+	return true;
+}
+
+/*
+=============
+Batch_Link
+
+Called by Edict_Link so the mirror follows anything moving its entities
+=============
+*/
+void Batch_Link(edict_t* ent)
+{
+	if (ent->batch_slot
+		|| Batch_Wants(ent))
+		Batch_Sync(ent);
+}
+
+/*
+=============
+Batch_PrintStats
+
+Prints the mirror for sv stats
+=============
+*/
+void Batch_PrintStats()
+{
+	gi.cprintf(NULL, PRINT_HIGH, "Physics batch:%s\n", (sv_physbatch->value > 0) ? "" : " (off)");
+	gi.cprintf(NULL, PRINT_HIGH, "  last frame  %5i integrated, %i moved from the batch, %i in it now\n",
+		batch_stats.integrated, batch_stats.taken, batch_count);
+}
@@ -54,7 +54,7 @@ bool M_CheckBottom(edict_t* ent)
 		{
 			start[0] = x ? maxs[0] : mins[0];
 			start[1] = y ? maxs[1] : mins[1];
-			if (gi.pointcontents(start) != CONTENTS_SOLID)
+			if (Game_PointContents(start) != CONTENTS_SOLID)
 				goto realcheck;
 		}
 
@@ -72,7 +72,7 @@ realcheck:
 	start[0] = stop[0] = (mins[0] + maxs[0]) * 0.5f;
 	start[1] = stop[1] = (mins[1] + maxs[1]) * 0.5f;
 	stop[2] = start[2] - 2 * STEPSIZE;
-	trace = gi.trace(start, vec3_origin, vec3_origin, stop, ent, MASK_MONSTERSOLID);
+	trace = Game_Trace(start, vec3_origin, vec3_origin, stop, ent, MASK_MONSTERSOLID);
 
 	if (trace.fraction == 1.0)
 		return false;
@@ -85,7 +85,7 @@ realcheck:
 			start[0] = stop[0] = x ? maxs[0] : mins[0];
 			start[1] = stop[1] = y ? maxs[1] : mins[1];
 
-			trace = gi.trace(start, vec3_origin, vec3_origin, stop, ent, MASK_MONSTERSOLID);
+			trace = Game_Trace(start, vec3_origin, vec3_origin, stop, ent, MASK_MONSTERSOLID);
 
 			if (trace.fraction != 1.0 && trace.endpos[2] > bottom)
 				bottom = trace.endpos[2];
@@ -156,7 +156,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 						neworg[2] += dz;
 				}
 			}
-			trace = gi.trace(ent->s.origin, ent->mins, ent->maxs, neworg, ent, MASK_MONSTERSOLID);
+			trace = Game_Trace(ent->s.origin, ent->mins, ent->maxs, neworg, ent, MASK_MONSTERSOLID);
 
 			// fly monsters don't enter water voluntarily
 			if (ent->flags & FL_FLY)
@@ -166,7 +166,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 					test[0] = trace.endpos[0];
 					test[1] = trace.endpos[1];
 					test[2] = trace.endpos[2] + ent->mins[2] + 1;
-					contents = gi.pointcontents(test);
+					contents = Game_PointContents(test);
 					if (contents & MASK_WATER)
 						return false;
 				}
@@ -180,7 +180,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 					test[0] = trace.endpos[0];
 					test[1] = trace.endpos[1];
 					test[2] = trace.endpos[2] + ent->mins[2] + 1;
-					contents = gi.pointcontents(test);
+					contents = Game_PointContents(test);
 					if (!(contents & MASK_WATER))
 						return false;
 				}
@@ -191,7 +191,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 				VectorCopy3(trace.endpos, ent->s.origin);
 				if (relink)
 				{
-					gi.Edict_Link(ent);
+					Edict_Link(ent);
 					Edict_TouchTriggers(ent);
 				}
 				return true;
@@ -205,7 +205,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 	}
 
 	// push down from a step height above the wished position
-	if (!(ent->monsterinfo.aiflags & AI_NOSTEP))
+	if (!(ent->monsterinfo->aiflags & AI_NOSTEP))
 		stepsize = STEPSIZE;
 	else
 		stepsize = 1;
@@ -214,7 +214,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 	VectorCopy3(neworg, end);
 	end[2] -= stepsize * 2;
 
-	trace = gi.trace(neworg, ent->mins, ent->maxs, end, ent, MASK_MONSTERSOLID);
+	trace = Game_Trace(neworg, ent->mins, ent->maxs, end, ent, MASK_MONSTERSOLID);
 
 	if (trace.allsolid)
 		return false;
@@ -222,7 +222,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 	if (trace.startsolid)
 	{
 		neworg[2] -= stepsize;
-		trace = gi.trace(neworg, ent->mins, ent->maxs, end, ent, MASK_MONSTERSOLID);
+		trace = Game_Trace(neworg, ent->mins, ent->maxs, end, ent, MASK_MONSTERSOLID);
 		if (trace.allsolid || trace.startsolid)
 			return false;
 	}
@@ -234,7 +234,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 		test[0] = trace.endpos[0];
 		test[1] = trace.endpos[1];
 		test[2] = trace.endpos[2] + ent->mins[2] + 1;
-		contents = gi.pointcontents(test);
+		contents = Game_PointContents(test);
 
 		if (contents & MASK_WATER)
 			return false;
@@ -248,7 +248,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 			VectorAdd3(ent->s.origin, move, ent->s.origin);
 			if (relink)
 			{
-				gi.Edict_Link(ent);
+				Edict_Link(ent);
 				Edict_TouchTriggers(ent);
 			}
 			ent->groundentity = NULL;
@@ -268,7 +268,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 			// and is trying to correct
 			if (relink)
 			{
-				gi.Edict_Link(ent);
+				Edict_Link(ent);
 				Edict_TouchTriggers(ent);
 			}
 			return true;
@@ -287,7 +287,7 @@ bool SV_movestep(edict_t* ent, vec3_t move, bool relink)
 	// the move is ok
 	if (relink)
 	{
-		gi.Edict_Link(ent);
+		Edict_Link(ent);
 		Edict_TouchTriggers(ent);
 	}
 	return true;
@@ -372,11 +372,11 @@ bool SV_StepDirection(edict_t* ent, float yaw, float dist)
 		{		// not turned far enough, so don't take the step
 			VectorCopy3(oldorigin, ent->s.origin);
 		}
-		gi.Edict_Link(ent);
+		Edict_Link(ent);
 		Edict_TouchTriggers(ent);
 		return true;
 	}
-	gi.Edict_Link(ent);
+	Edict_Link(ent);
 	Edict_TouchTriggers(ent);
 	return false;
 }
@@ -405,6 +405,7 @@ void SV_NewChaseDir(edict_t* actor, edict_t* enemy, float dist)
 {
 	float	deltax, deltay;
 	float	d[3];
+	vec3_t	flow;
 	float	tdir, olddir, turnaround;
 
 	//FIXME: how did we get here with no enemy
@@ -416,6 +417,16 @@ void SV_NewChaseDir(edict_t* actor, edict_t* enemy, float dist)
 
 	deltax = enemy->s.origin[0] - actor->s.origin[0];
 	deltay = enemy->s.origin[1] - actor->s.origin[1];
+
+	// chasing something the navigation graph leads to, try the way its flow field goes first
+	if (enemy == actor->enemy
+		&& !(actor->flags & (FL_FLY | FL_SWIM))
+		&& Nav_FlowDirection(actor, enemy, flow))
+	{
+		deltax = flow[0];
+		deltay = flow[1];
+	}
+
 	if (deltax > 10)
 		d[1] = 0;
 	else if (deltax < -10)
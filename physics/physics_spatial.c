@@ -0,0 +1,551 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// physics_spatial.c : Game side spatial hash
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+SPATIAL HASH
+
+==============================================================================
+
+Every edict that is linked into the world is also filed in a uniform grid,
+keyed on the cell its bounding box centre is in. The cells are hashed into a
+fixed number of buckets, so the grid has no bounds and costs nothing for
+empty space. Edicts are refiled whenever they are linked.
+
+Radius queries measure to the bounding box centre, same as findradius, so
+the centre is all that is needed to find them. Box queries have to allow for
+the size of the edict, so anything reaching more than half a cell out from
+its centre goes in a separate list that every box query checks.
+
+If a query would have to look at more cells than there are edicts in the
+grid, every edict in the grid is checked instead.
+*/
+
+#define SPATIAL_CELL_SIZE		256
+#define SPATIAL_HASH_SIZE		4096
+
+edict_t*	spatial_hash[SPATIAL_HASH_SIZE];
+edict_t*	spatial_large;				// edicts too big for box queries to find through their cell
+int32_t		spatial_count;				// edicts in the grid, including spatial_large
+int32_t		spatial_query;				// stamped on edicts so a query only returns them once
+
+static edict_t* spatial_results[MAX_EDICTS];
+
+static int32_t Spatial_Cell(float v)
+{
+	return (int32_t)floorf(v / SPATIAL_CELL_SIZE);
+}
+
+static int32_t Spatial_Bucket(int32_t x, int32_t y, int32_t z)
+{
+	return ((uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u ^ (uint32_t)z * 83492791u) & (SPATIAL_HASH_SIZE - 1);
+}
+
+static void Spatial_Centre(edict_t* ent, vec3_t centre)
+{
+	int32_t i;
+
+	for (i = 0; i < 3; i++)
+		centre[i] = ent->s.origin[i] + (ent->mins[i] + ent->maxs[i]) * 0.5f;
+}
+
+static void Spatial_Insert(edict_t** list, edict_t* ent)
+{
+	ent->spatial_prev = NULL;
+	ent->spatial_next = *list;
+
+	if (*list)
+		(*list)->spatial_prev = ent;
+
+	*list = ent;
+	ent->spatial_linked = true;
+	spatial_count++;
+}
+
+/*
+=============
+Spatial_Unlink
+
+Takes the edict out of the grid, called when it is unlinked from the world
+=============
+*/
+void Spatial_Unlink(edict_t* ent)
+{
+	if (!ent->spatial_linked)
+		return;
+
+	if (ent->spatial_prev)
+		ent->spatial_prev->spatial_next = ent->spatial_next;
+	else if (ent->spatial_large)
+		spatial_large = ent->spatial_next;
+	else
+		spatial_hash[ent->spatial_bucket] = ent->spatial_next;
+
+	if (ent->spatial_next)
+		ent->spatial_next->spatial_prev = ent->spatial_prev;
+
+	ent->spatial_prev = ent->spatial_next = NULL;
+	ent->spatial_linked = false;
+	spatial_count--;
+}
+
+/*
+=============
+Spatial_Link
+
+Files the edict in the cell it is now in, called every time it is linked
+=============
+*/
+void Spatial_Link(edict_t* ent)
+{
+	vec3_t	centre;
+	int32_t	bucket, i;
+	bool	large;
+
+	// the server never links the world either
+	if (!ent->inuse
+		|| ent == g_edicts)
+	{
+		Spatial_Unlink(ent);
+		return;
+	}
+
+	Spatial_Centre(ent, centre);
+
+	// absmin/absmax aren't always centred on it (rotated brush models)
+	large = false;
+
+	for (i = 0; i < 3; i++)
+	{
+		if (ent->absmax[i] - centre[i] > SPATIAL_CELL_SIZE / 2
+			|| centre[i] - ent->absmin[i] > SPATIAL_CELL_SIZE / 2)
+			large = true;
+	}
+	bucket = Spatial_Bucket(Spatial_Cell(centre[0]), Spatial_Cell(centre[1]), Spatial_Cell(centre[2]));
+
+	// most moves stay in the same cell
+	if (ent->spatial_linked
+		&& ent->spatial_large == large
+		&& (large || ent->spatial_bucket == bucket))
+		return;
+
+	Spatial_Unlink(ent);
+
+	ent->spatial_large = large;
+	ent->spatial_bucket = bucket;
+
+	if (large)
+		Spatial_Insert(&spatial_large, ent);
+	else
+		Spatial_Insert(&spatial_hash[bucket], ent);
+}
+
+/*
+=============
+Spatial_Clear
+
+Empties the grid, called when the edicts are wiped
+=============
+*/
+void Spatial_Clear()
+{
+	memset(spatial_hash, 0, sizeof(spatial_hash));
+	spatial_large = NULL;
+	spatial_count = 0;
+}
+
+static int Spatial_CompareEdicts(const void* a, const void* b)
+{
+	edict_t* e1 = *(edict_t**)a;
+	edict_t* e2 = *(edict_t**)b;
+
+	return (e1 > e2) - (e1 < e2);
+}
+
+/*
+=============
+Spatial_Walk
+
+Calls check once on every edict filed in a cell touching mins/maxs, and on
+everything in the large list. Fills list with the edicts check accepted, in
+edict order.
+=============
+*/
+static int32_t Spatial_Walk(vec3_t mins, vec3_t maxs, edict_t** list, int32_t maxcount,
+	bool (*check)(edict_t* ent, void* parms), void* parms)
+{
+	int32_t		lo[3], hi[3];
+	int32_t		x, y, z, count;
+	int64_t		cells;
+	edict_t*	ent;
+
+	spatial_query++;
+	count = 0;
+
+	for (x = 0; x < 3; x++)
+	{
+		lo[x] = Spatial_Cell(mins[x]);
+		hi[x] = Spatial_Cell(maxs[x]);
+	}
+
+	cells = (int64_t)(hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1);
+
+	if (cells > spatial_count)
+	{
+		// cheaper to check everything in the grid than all those cells
+		for (ent = EdictList_Next(NULL); ent && count < maxcount; ent = EdictList_Next(ent))
+		{
+			if (!ent->spatial_linked)
+				continue;
+
+			if (check(ent, parms))
+				list[count++] = ent;
+		}
+
+		return count;
+	}
+
+	for (x = lo[0]; x <= hi[0]; x++)
+	{
+		for (y = lo[1]; y <= hi[1]; y++)
+		{
+			for (z = lo[2]; z <= hi[2]; z++)
+			{
+				for (ent = spatial_hash[Spatial_Bucket(x, y, z)]; ent; ent = ent->spatial_next)
+				{
+					// other cells share buckets
+					if (ent->spatial_query == spatial_query)
+						continue;
+
+					ent->spatial_query = spatial_query;
+
+					if (count < maxcount && check(ent, parms))
+						list[count++] = ent;
+				}
+			}
+		}
+	}
+
+	for (ent = spatial_large; ent; ent = ent->spatial_next)
+	{
+		if (count < maxcount && check(ent, parms))
+			list[count++] = ent;
+	}
+
+	// keep the edict order findradius and G_Find callers are used to
+	qsort(list, count, sizeof(list[0]), Spatial_CompareEdicts);
+	return count;
+}
+
+typedef struct spatial_radius_s
+{
+	float*		org;
+	float		radius;
+	bool		(*filter)(edict_t* ent);
+} spatial_radius_t;
+
+static bool Spatial_CheckRadius(edict_t* ent, void* parms)
+{
+	spatial_radius_t*	radius = parms;
+	vec3_t				eorg;
+	int32_t				j;
+
+	if (ent->solid == SOLID_NOT)
+		return false;
+
+	for (j = 0; j < 3; j++)
+		eorg[j] = radius->org[j] - (ent->s.origin[j] + (ent->mins[j] + ent->maxs[j]) * 0.5f);
+
+	if (VectorLength3(eorg) > radius->radius)
+		return false;
+
+	return !radius->filter || radius->filter(ent);
+}
+
+/*
+=============
+Spatial_FindInRadius
+
+findradius for the whole radius at once. Fills list with every non SOLID_NOT
+edict whose bounding box centre is within radius of org, in edict order.
+=============
+*/
+int32_t Spatial_FindInRadius(vec3_t org, float radius, edict_t** list, int32_t maxcount)
+{
+	spatial_radius_t	parms;
+	vec3_t				mins, maxs;
+	int32_t				i;
+
+	for (i = 0; i < 3; i++)
+	{
+		mins[i] = org[i] - radius;
+		maxs[i] = org[i] + radius;
+	}
+
+	parms.org = org;
+	parms.radius = radius;
+	parms.filter = NULL;
+
+	return Spatial_Walk(mins, maxs, list, maxcount, Spatial_CheckRadius, &parms);
+}
+
+typedef struct spatial_box_s
+{
+	float*		mins;
+	float*		maxs;
+	int32_t		areatype;
+} spatial_box_t;
+
+static bool Spatial_CheckBox(edict_t* ent, void* parms)
+{
+	spatial_box_t*	box = parms;
+	int32_t			i;
+
+	if (box->areatype == AREA_TRIGGERS)
+	{
+		if (ent->solid != SOLID_TRIGGER)
+			return false;
+	}
+	else if (ent->solid == SOLID_NOT
+		|| ent->solid == SOLID_TRIGGER)
+	{
+		return false;
+	}
+
+	for (i = 0; i < 3; i++)
+	{
+		if (ent->absmin[i] > box->maxs[i]
+			|| ent->absmax[i] < box->mins[i])
+			return false;
+	}
+
+	return true;
+}
+
+/*
+=============
+Spatial_BoxEdicts
+
+gi.BoxEdicts through the grid
+=============
+*/
+int32_t Spatial_BoxEdicts(vec3_t mins, vec3_t maxs, edict_t** list, int32_t maxcount, int32_t areatype)
+{
+	spatial_box_t	parms;
+	vec3_t			search_mins, search_maxs;
+	int32_t			i;
+
+	// anything in a normal cell sticks out of it by at most half a cell
+	for (i = 0; i < 3; i++)
+	{
+		search_mins[i] = mins[i] - SPATIAL_CELL_SIZE / 2;
+		search_maxs[i] = maxs[i] + SPATIAL_CELL_SIZE / 2;
+	}
+
+	parms.mins = mins;
+	parms.maxs = maxs;
+	parms.areatype = areatype;
+
+	return Spatial_Walk(search_mins, search_maxs, list, maxcount, Spatial_CheckBox, &parms);
+}
+
+// corner to corner across the +/-4096 the engine lets anything be linked in, a
+// radius past this finds nothing more and would overflow Spatial_Cell
+#define SPATIAL_MAX_RADIUS		14190
+
+/*
+=============
+Spatial_FindNearest
+
+Fills list with up to count of the edicts nearest org (by bounding box
+centre) that filter accepts, nearest first. Only searches out to maxdist.
+=============
+*/
+int32_t Spatial_FindNearest(vec3_t org, float maxdist, edict_t** list, int32_t count, bool (*filter)(edict_t* ent))
+{
+	spatial_radius_t	parms;
+	vec3_t				mins, maxs, eorg;
+	float				radius, dist;
+	float*				best_dist;
+	int32_t				found, kept, i, j, k, mark;
+	edict_t*			ent;
+
+	if (count <= 0)
+		return 0;
+
+	// the walk never finds more than this
+	if (count > MAX_EDICTS)
+		count = MAX_EDICTS;
+
+	if (!(maxdist <= SPATIAL_MAX_RADIUS))		// catches NaN too
+		maxdist = SPATIAL_MAX_RADIUS;
+
+	parms.org = org;
+	parms.filter = filter;
+
+	// grow the search until it has enough, everything inside the radius is closer than anything outside it
+	for (radius = SPATIAL_CELL_SIZE; ; radius *= 2)
+	{
+		if (radius > maxdist)
+			radius = maxdist;
+
+		for (i = 0; i < 3; i++)
+		{
+			mins[i] = org[i] - radius;
+			maxs[i] = org[i] + radius;
+		}
+
+		parms.radius = radius;
+		found = Spatial_Walk(mins, maxs, spatial_results, MAX_EDICTS, Spatial_CheckRadius, &parms);
+
+		if (found >= count
+			|| radius >= maxdist)
+			break;
+	}
+
+	// keep the nearest count in list, sorted, so a crowded radius costs found * count rather than found squared
+	mark = FrameArena_Mark();
+	best_dist = FrameArena_Array(float, count);
+	kept = 0;
+
+	for (i = 0; i < found; i++)
+	{
+		ent = spatial_results[i];
+
+		for (j = 0; j < 3; j++)
+			eorg[j] = org[j] - (ent->s.origin[j] + (ent->mins[j] + ent->maxs[j]) * 0.5f);
+
+		dist = VectorLength3(eorg);
+
+		if (kept == count)
+		{
+			if (dist >= best_dist[kept - 1])
+				continue;
+
+			kept--;
+		}
+
+		for (k = kept; k > 0 && best_dist[k - 1] > dist; k--)
+		{
+			list[k] = list[k - 1];
+			best_dist[k] = best_dist[k - 1];
+		}
+
+		list[k] = ent;
+		best_dist[k] = dist;
+		kept++;
+	}
+
+	FrameArena_Release(mark);
+	return kept;
+}
+
+/*
+=============
+Spatial_Benchmark
+
+sv spatialbench [count]
+
+Drops temporary trigger edicts around the level and times radius queries
+through the grid against the linear findradius scan, checking that both
+return the same edicts. The edicts are freed again before the command
+returns.
+=============
+*/
+void Spatial_Benchmark(int32_t count)
+{
+	static int32_t	sizes[] = { 100, 500, 1000 };
+	edict_t*		ents[1000];
+	edict_t*		found[MAX_EDICTS];
+	edict_t*		ent;
+	vec3_t			org;
+	int64_t			start, linear_ns, grid_ns;
+	int32_t			run, i, j, n, num_linear, num_grid, mismatches;
+	int32_t			queries = 1000;
+	float			radius = 256;
+
+	for (run = 0; run < (int32_t)(sizeof(sizes) / sizeof(sizes[0])); run++)
+	{
+		n = (count > 0) ? count : sizes[run];
+
+		if (n > 1000)
+			n = 1000;
+
+		if (globals.num_edicts + n >= game.maxentities)
+		{
+			gi.cprintf(NULL, PRINT_HIGH, "Not enough free edicts for %i benchmark entities\n", n);
+			return;
+		}
+
+		srand(1);
+
+		for (i = 0; i < n; i++)
+		{
+			ent = ents[i] = Edict_Spawn();
+			Edict_SetClassname(ent, "spatial_benchmark");
+			ent->solid = SOLID_TRIGGER;
+			VectorSet3(ent->mins, -16, -16, -16);
+			VectorSet3(ent->maxs, 16, 16, 16);
+
+			for (j = 0; j < 3; j++)
+				ent->s.origin[j] = (rand() % 8192) - 4096;
+
+			Edict_Link(ent);
+		}
+
+		linear_ns = grid_ns = 0;
+		mismatches = 0;
+
+		for (i = 0; i < queries; i++)
+		{
+			for (j = 0; j < 3; j++)
+				org[j] = (rand() % 8192) - 4096;
+
+			start = Sys_Nanoseconds();
+			num_linear = 0;
+
+			for (ent = NULL; (ent = Game_FindEdictsWithinRadius(ent, org, radius)) != NULL; )
+				num_linear++;
+
+			linear_ns += Sys_Nanoseconds() - start;
+
+			start = Sys_Nanoseconds();
+			num_grid = Spatial_FindInRadius(org, radius, found, MAX_EDICTS);
+			grid_ns += Sys_Nanoseconds() - start;
+
+			if (num_grid != num_linear)
+				mismatches++;
+		}
+
+		gi.cprintf(NULL, PRINT_HIGH, "%4i entities: linear %8.2f us/query, grid %8.2f us/query, %i mismatches\n",
+			n, linear_ns / 1000.0 / queries, grid_ns / 1000.0 / queries, mismatches);
+
+		for (i = 0; i < n; i++)
+			Edict_Free(ents[i]);
+
+		if (count > 0)
+			break;
+	}
+}
@@ -0,0 +1,455 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// physics_think.c : Think scheduling
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+THINK WHEEL
+
+==============================================================================
+
+Hierarchical timer wheel keyed by level.framenum. Every nextthink assignment
+goes through Edict_SetNextThink, which files the entity into the slot for the
+tick its think is due on.
+
+Entities that never move (MOVETYPE_NONE, no prethink, not a client, not
+riding anything) are put to sleep after they have been run, and G_RunFrame
+skips them entirely until the wheel fires their think or they are relinked.
+
+Toss, bounce and step entities that aren't live monsters (gibs, debris,
+dropped items, bodies) go to sleep the same way once they have sat on the
+ground without moving for THINK_REST_TICKS frames. Anything that moves them
+relinks them, Edict_Wake is called when they are damaged or something sets
+their velocity, and relinking whatever they rest on wakes them so they can
+notice it has moved. Each entity keeps a list of what went to sleep on it for
+that, which is only emptied when it is relinked, so it can hold entities that
+have since woken up or moved off.
+
+Level 0 has one slot per tick, each higher level has one slot per
+THINK_WHEEL_SLOTS ticks of the level below it; when the lower level wraps,
+the next slot of the level above is cascaded down into it.
+*/
+
+#define THINK_WHEEL_BITS		6
+#define THINK_WHEEL_SLOTS		(1 << THINK_WHEEL_BITS)
+#define THINK_WHEEL_MASK		(THINK_WHEEL_SLOTS - 1)
+#define THINK_WHEEL_LEVELS		4
+
+// frames a toss or step entity has to sit still on the ground before it sleeps
+#define THINK_REST_TICKS		8
+
+// furthest a timer can be filed ahead of the wheel, ~4.8 days at 40hz
+#define THINK_WHEEL_MAX_DELTA	((1 << (THINK_WHEEL_BITS * THINK_WHEEL_LEVELS)) - 1)
+
+edict_t*	think_wheel[THINK_WHEEL_LEVELS * THINK_WHEEL_SLOTS];
+int32_t		think_wheel_tick;		// last tick the wheel was advanced to
+
+static void ThinkWheel_Insert(edict_t* ent)
+{
+	int32_t	delta, tick, level, slot;
+
+	delta = ent->think_tick - think_wheel_tick;
+	tick = ent->think_tick;
+
+	if (delta > THINK_WHEEL_MAX_DELTA)
+	{
+		// park it in the last slot it can reach, it will be refiled when it cascades
+		delta = THINK_WHEEL_MAX_DELTA;
+		tick = think_wheel_tick + delta;
+	}
+
+	for (level = 0; level < THINK_WHEEL_LEVELS - 1; level++)
+	{
+		if (delta < (1 << (THINK_WHEEL_BITS * (level + 1))))
+			break;
+	}
+
+	slot = level * THINK_WHEEL_SLOTS + ((tick >> (THINK_WHEEL_BITS * level)) & THINK_WHEEL_MASK);
+
+	ent->think_slot = slot;
+	ent->think_queued = true;
+	ent->think_prev = NULL;
+	ent->think_next = think_wheel[slot];
+
+	if (think_wheel[slot])
+		think_wheel[slot]->think_prev = ent;
+
+	think_wheel[slot] = ent;
+}
+
+/*
+=============
+ThinkWheel_Remove
+
+Takes the entity out of whatever slot it is filed in
+=============
+*/
+void ThinkWheel_Remove(edict_t* ent)
+{
+	if (!ent->think_queued)
+		return;
+
+	if (ent->think_prev)
+		ent->think_prev->think_next = ent->think_next;
+	else
+		think_wheel[ent->think_slot] = ent->think_next;
+
+	if (ent->think_next)
+		ent->think_next->think_prev = ent->think_prev;
+
+	ent->think_prev = ent->think_next = NULL;
+	ent->think_queued = false;
+}
+
+/*
+=============
+ThinkWheel_Cascade
+
+Refiles every entity in a higher level slot now that the levels below it have
+wrapped. Returns the index that was cascaded so the caller knows whether the
+next level has to be cascaded too.
+=============
+*/
+static int32_t ThinkWheel_Cascade(int32_t level)
+{
+	edict_t*	ent;
+	edict_t*	next;
+	int32_t		index;
+
+	index = (think_wheel_tick >> (THINK_WHEEL_BITS * level)) & THINK_WHEEL_MASK;
+
+	ent = think_wheel[level * THINK_WHEEL_SLOTS + index];
+	think_wheel[level * THINK_WHEEL_SLOTS + index] = NULL;
+
+	for (; ent; ent = next)
+	{
+		next = ent->think_next;
+		ent->think_queued = false;
+		ent->think_prev = ent->think_next = NULL;
+
+		if (ent->think_tick <= think_wheel_tick)
+			ent->think_asleep = false;
+		else
+			ThinkWheel_Insert(ent);
+	}
+
+	return index;
+}
+
+/*
+=============
+ThinkWheel_Clear
+
+Empties the wheel, called when the edicts are wiped for a new level
+=============
+*/
+void ThinkWheel_Clear()
+{
+	memset(think_wheel, 0, sizeof(think_wheel));
+	think_wheel_tick = level.framenum;
+}
+
+/*
+=============
+ThinkWheel_Rebuild
+
+Refiles every entity from its nextthink. The wheel links are saved along
+with the rest of the edict, so they are meaningless after a level load.
+=============
+*/
+void ThinkWheel_Rebuild()
+{
+	int32_t		i;
+	edict_t*	ent;
+
+	ThinkWheel_Clear();
+
+	for (i = 0, ent = g_edicts; i < globals.num_edicts; i++, ent++)
+	{
+		ent->think_queued = false;
+		ent->think_asleep = false;
+		ent->think_prev = ent->think_next = NULL;
+		ent->think_carried = ent->think_carrier = NULL;
+		ent->think_carried_prev = ent->think_carried_next = NULL;
+
+		if (!ent->inuse)
+			continue;
+
+		if (ent->nextthink > 0)
+			Edict_SetNextThink(ent, ent->nextthink);
+	}
+}
+
+/*
+=============
+ThinkWheel_Advance
+
+Called at the start of every frame. Wakes every entity whose think is due
+on or before tick.
+=============
+*/
+void ThinkWheel_Advance(int32_t tick)
+{
+	edict_t*	ent;
+	edict_t*	next;
+	int32_t		index, level;
+
+	// the level time went backwards (intermission exit), start again
+	if (tick < think_wheel_tick)
+	{
+		ThinkWheel_Rebuild();
+		return;
+	}
+
+	while (think_wheel_tick < tick)
+	{
+		think_wheel_tick++;
+
+		index = think_wheel_tick & THINK_WHEEL_MASK;
+
+		// cascade down any levels that have wrapped
+		for (level = 1; !index && level < THINK_WHEEL_LEVELS; level++)
+			index = ThinkWheel_Cascade(level);
+
+		index = think_wheel_tick & THINK_WHEEL_MASK;
+		ent = think_wheel[index];
+		think_wheel[index] = NULL;
+
+		for (; ent; ent = next)
+		{
+			next = ent->think_next;
+			ent->think_queued = false;
+			ent->think_prev = ent->think_next = NULL;
+			ent->think_asleep = false;
+		}
+	}
+}
+
+/*
+=============
+ThinkWheel_AtRest
+
+True if ent can't move again until something else moves it
+=============
+*/
+static bool ThinkWheel_AtRest(edict_t* ent)
+{
+	if (ent->movetype == MOVETYPE_NONE)
+		return !ent->groundentity;
+
+	if (ent->movetype != MOVETYPE_TOSS
+		&& ent->movetype != MOVETYPE_BOUNCE
+		&& ent->movetype != MOVETYPE_STEP)
+		return false;
+
+	// live monsters walk about from their thinks, which can come every frame
+	if ((ent->svflags & SVF_MONSTER)
+		&& ent->health > 0)
+		return false;
+
+	if (!ent->groundentity
+		|| !ent->groundentity->inuse)
+		return false;
+
+	return (VectorCompare3(ent->velocity, vec3_origin)
+		&& VectorCompare3(ent->avelocity, vec3_origin));
+}
+
+/*
+=============
+ThinkWheel_TrySleep
+
+Called after an entity has been run for the frame. Puts it to sleep if it
+can't do anything on its own until its next think.
+=============
+*/
+void ThinkWheel_TrySleep(edict_t* ent)
+{
+	if (ent->prethink
+		|| ent->client
+		|| !ThinkWheel_AtRest(ent))
+	{
+		ent->think_rest = 0;
+		return;
+	}
+
+	if (ent->movetype != MOVETYPE_NONE
+		&& ++ent->think_rest < THINK_REST_TICKS)
+		return;
+
+	// its think was due but it hasn't run yet (set after it was run this frame)
+	if (ent->nextthink > 0
+		&& !ent->think_queued)
+	{
+		Edict_SetNextThink(ent, ent->nextthink);
+
+		if (!ent->think_queued)
+			return;
+	}
+
+	// so it is woken if the ground is relinked
+	if (ent->groundentity
+		&& ent->think_carrier != ent->groundentity)
+	{
+		ThinkWheel_Uncarry(ent);
+
+		ent->think_carrier = ent->groundentity;
+		ent->think_carried_prev = NULL;
+		ent->think_carried_next = ent->groundentity->think_carried;
+
+		if (ent->think_carried_next)
+			ent->think_carried_next->think_carried_prev = ent;
+
+		ent->groundentity->think_carried = ent;
+	}
+
+	ent->think_asleep = true;
+}
+
+/*
+=============
+ThinkWheel_Uncarry
+
+Takes ent off the carried list of what it went to sleep on, called when it
+is freed or recycled
+=============
+*/
+void ThinkWheel_Uncarry(edict_t* ent)
+{
+	if (!ent->think_carrier)
+		return;
+
+	if (ent->think_carried_prev)
+		ent->think_carried_prev->think_carried_next = ent->think_carried_next;
+	else
+		ent->think_carrier->think_carried = ent->think_carried_next;
+
+	if (ent->think_carried_next)
+		ent->think_carried_next->think_carried_prev = ent->think_carried_prev;
+
+	ent->think_carrier = NULL;
+	ent->think_carried_prev = ent->think_carried_next = NULL;
+}
+
+/*
+=============
+Edict_Wake
+
+Wakes ent if it is asleep and makes it sit still for THINK_REST_TICKS frames
+again before it can go back to sleep. Call it after changing something
+G_RunFrame has to act on, such as the velocity.
+=============
+*/
+void Edict_Wake(edict_t* ent)
+{
+	ent->think_asleep = false;
+	ent->think_rest = 0;
+
+	if (ent->batch_slot)
+		Batch_Sync(ent);
+}
+
+/*
+=============
+ThinkWheel_WakeCarried
+
+Wakes everything asleep on ground, which has just been relinked
+=============
+*/
+static void ThinkWheel_WakeCarried(edict_t* ground)
+{
+	edict_t*	ent;
+	edict_t*	next;
+
+	ent = ground->think_carried;
+	ground->think_carried = NULL;
+
+	for (; ent; ent = next)
+	{
+		next = ent->think_carried_next;
+		ent->think_carrier = NULL;
+		ent->think_carried_prev = ent->think_carried_next = NULL;
+
+		// it may have woken or moved off since
+		if (ent->think_asleep
+			&& ent->groundentity == ground)
+			Edict_Wake(ent);
+	}
+}
+
+/*
+=============
+ThinkWheel_Link
+
+Called by Edict_Link and Edict_Unlink so that anything moving a sleeping
+entity, or what it is resting on, wakes it up
+=============
+*/
+void ThinkWheel_Link(edict_t* ent)
+{
+	ent->think_asleep = false;
+
+	if (ent->think_carried)
+		ThinkWheel_WakeCarried(ent);
+}
+
+void ThinkWheel_Unlink(edict_t* ent)
+{
+	if (ent->think_carried)
+		ThinkWheel_WakeCarried(ent);
+}
+
+/*
+=============
+Edict_SetNextThink
+
+Sets the time the entity will next think and files it in the think wheel.
+A time of 0 cancels the think.
+=============
+*/
+void Edict_SetNextThink(edict_t* ent, float time)
+{
+	int32_t	tick;
+
+	ent->nextthink = time;
+
+	ThinkWheel_Remove(ent);
+
+	if (time <= 0)
+		return;
+
+	// round to the nearest tick, so float error can only make it early. SV_RunThink still
+	// checks nextthink against level.time, and an early entity is refiled by ThinkWheel_TrySleep
+	tick = (int32_t)(time / TICK_TIME + 0.5f);
+
+	if (tick <= think_wheel_tick)
+	{
+		// due right now
+		ent->think_asleep = false;
+		return;
+	}
+
+	ent->think_tick = tick;
+	ThinkWheel_Insert(ent);
+}
@@ -0,0 +1,208 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// physics_tracecache.c : Per frame trace memoisation
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+TRACE CACHE
+
+==============================================================================
+
+Monsters trace to the same places several times a frame (Edict_CanSee from
+the sight, attack and run code, the player trail), so Game_Trace remembers
+what it was told for the rest of the frame. Traces are keyed on their exact
+points and box, the pass edict and the mask. Rounding the points would let
+more traces share an answer, but pmove nudges the player by fractions of a
+unit to find out whether it is stuck, and those must not share one.
+
+What a trace hits can only change when something solid is linked or
+unlinked. Bounding boxes are always clipped as CONTENTS_MONSTER, so moving
+one only forgets the traces that could hit it. Anything else (brush models,
+or an edict leaving the world whose old solid type is not known) forgets
+everything, and so does the next frame.
+
+sv_tracecache 0 turns it off.
+*/
+
+#define TRACECACHE_SIZE		2048		// must be a power of two
+
+typedef struct tracecache_entry_s
+{
+	vec3_t		key[4];					// start, end, mins, maxs
+	edict_t*	passent;
+	int32_t		contentmask;
+	int32_t		stamp;					// tracecache_stamp when it was stored
+	int32_t		box_stamp;				// tracecache_box_stamp when it was stored
+	trace_t		trace;
+} tracecache_entry_t;
+
+typedef struct tracecache_stats_s
+{
+	int64_t		hits;
+	int64_t		misses;
+	int64_t		flushes;				// everything forgotten by a link
+	int64_t		box_flushes;			// box traces forgotten by a link
+} tracecache_stats_t;
+
+static tracecache_entry_t	tracecache[TRACECACHE_SIZE];
+static int32_t				tracecache_stamp = 1;		// changes every frame and whenever everything is forgotten
+static int32_t				tracecache_box_stamp = 1;	// changes whenever a bounding box moves
+static tracecache_stats_t	tracecache_stats;
+static tracecache_stats_t	tracecache_last_frame;		// tracecache_stats at the start of the frame
+static tracecache_stats_t	tracecache_frame;			// what the last whole frame did
+
+/*
+=============
+TraceCache_Invalidate
+
+Forgets the traces the edict could change, ent is about to be linked or unlinked
+=============
+*/
+void TraceCache_Invalidate(edict_t* ent, bool linking)
+{
+	if (linking && ent->solid == SOLID_BBOX)
+	{
+		tracecache_box_stamp++;
+		tracecache_stats.box_flushes++;
+	}
+	else if ((linking && ent->solid == SOLID_BSP)
+		|| ent->area.prev)
+	{
+		tracecache_stamp++;
+		tracecache_stats.flushes++;
+	}
+}
+
+
+/*
+=============
+TraceCache_Clear
+
+Forgets everything, called at the start of every frame and when the edicts are wiped
+=============
+*/
+void TraceCache_Clear()
+{
+	tracecache_stamp++;
+}
+
+/*
+=============
+TraceCache_EndFrame
+
+Keeps what the frame did for sv stats
+=============
+*/
+void TraceCache_EndFrame()
+{
+	tracecache_frame.hits = tracecache_stats.hits - tracecache_last_frame.hits;
+	tracecache_frame.misses = tracecache_stats.misses - tracecache_last_frame.misses;
+	tracecache_frame.flushes = tracecache_stats.flushes - tracecache_last_frame.flushes;
+	tracecache_frame.box_flushes = tracecache_stats.box_flushes - tracecache_last_frame.box_flushes;
+	tracecache_last_frame = tracecache_stats;
+
+	TraceCache_Clear();
+}
+
+/*
+=============
+TraceCache_Trace
+
+gi.trace, answered from the cache when the same trace was already made this frame
+=============
+*/
+trace_t TraceCache_Trace(vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, edict_t* passent, int32_t contentmask)
+{
+	tracecache_entry_t*	entry;
+	vec3_t				key[4];
+	uint32_t			hash, bits;
+	int32_t				i;
+
+	if (!sv_tracecache->value)
+		return gi.trace(start, mins, maxs, end, passent, contentmask);
+
+	// a NULL box is the same trace as a zero one
+	memset(key, 0, sizeof(key));
+	VectorCopy3(start, key[0]);
+	VectorCopy3(end, key[1]);
+
+	if (mins)
+		VectorCopy3(mins, key[2]);
+
+	if (maxs)
+		VectorCopy3(maxs, key[3]);
+
+	hash = (uint32_t)((uintptr_t)passent >> 4) * 2654435761u ^ (uint32_t)contentmask;
+
+	for (i = 0; i < 12; i++)
+	{
+		memcpy(&bits, &key[i / 3][i % 3], sizeof(bits));
+		hash = (hash ^ bits) * 16777619u;
+	}
+
+	entry = &tracecache[hash & (TRACECACHE_SIZE - 1)];
+
+	if (entry->stamp == tracecache_stamp
+		&& (!(contentmask & CONTENTS_MONSTER) || entry->box_stamp == tracecache_box_stamp)
+		&& entry->passent == passent
+		&& entry->contentmask == contentmask
+		&& !memcmp(entry->key, key, sizeof(key)))
+	{
+		tracecache_stats.hits++;
+		return entry->trace;
+	}
+
+	tracecache_stats.misses++;
+
+	entry->trace = gi.trace(start, mins, maxs, end, passent, contentmask);
+	memcpy(entry->key, key, sizeof(key));
+	entry->passent = passent;
+	entry->contentmask = contentmask;
+	entry->stamp = tracecache_stamp;
+	entry->box_stamp = tracecache_box_stamp;
+
+	return entry->trace;
+}
+
+/*
+=============
+TraceCache_PrintStats
+
+Prints the hit rate for sv stats
+=============
+*/
+void TraceCache_PrintStats()
+{
+	int64_t total, frame_total;
+
+	total = tracecache_stats.hits + tracecache_stats.misses;
+	frame_total = tracecache_frame.hits + tracecache_frame.misses;
+
+	gi.cprintf(NULL, PRINT_HIGH, "Trace cache:%s\n", sv_tracecache->value ? "" : " (off)");
+	gi.cprintf(NULL, PRINT_HIGH, "  last frame  %5lli traces, %lli hits (%.1f%%), %lli flushes, %lli box flushes\n",
+		(long long)frame_total, (long long)tracecache_frame.hits, frame_total ? 100.0 * tracecache_frame.hits / frame_total : 0.0,
+		(long long)tracecache_frame.flushes, (long long)tracecache_frame.box_flushes);
+	gi.cprintf(NULL, PRINT_HIGH, "  total       %5lli traces, %lli hits (%.1f%%)\n",
+		(long long)total, (long long)tracecache_stats.hits, total ? 100.0 * tracecache_stats.hits / total : 0.0);
+}
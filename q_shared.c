@@ -934,6 +934,38 @@ int32_t Q_strcasecmp(char* s1, char* s2)
 	return Q_strncasecmp(s1, s2, 99999);
 }
 
+// FNV-1a
+uint32_t Q_HashString(const char* s)
+{
+	uint32_t	hash = 2166136261u;
+
+	while (*s)
+	{
+		hash ^= (uint8_t)*s++;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+// case insensitive FNV-1a, so that strings that Q_stricmp equal hash the same
+uint32_t Q_HashStringNoCase(char* s)
+{
+	uint32_t	hash = 2166136261u;
+	int32_t		c;
+
+	while ((c = *s++))
+	{
+		if (c >= 'A' && c <= 'Z')
+			c += ('a' - 'A');
+
+		hash ^= (uint8_t)c;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
 void Com_sprintf(char* dest, int32_t size, char* fmt, ...)
 {
 	char bigbuffer[0x10000];
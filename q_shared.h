@@ -227,6 +227,8 @@ void Com_PageInMemory(uint8_t* buffer, int32_t size);
 int32_t Q_stricmp(char* s1, char* s2);
 int32_t Q_strcasecmp(char* s1, char* s2);
 int32_t Q_strncasecmp(char* s1, char* s2, int32_t n);
+uint32_t Q_HashString(const char* s);
+uint32_t Q_HashStringNoCase(char* s);
 
 //=============================================
 
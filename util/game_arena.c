@@ -0,0 +1,151 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// game_arena.c -- scratch memory that only lives for a frame
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+FRAME ARENA
+
+==============================================================================
+
+Touch lists, push lists and the like used to be MAX_EDICTS arrays on the
+stack or in globals. They now come from the frame arena, which hands out
+memory by bumping a pointer. Callers size them for the edicts actually in
+use (globals.num_edicts) rather than MAX_EDICTS.
+
+Anything that can be called more than once a frame, or from inside itself,
+takes a FrameArena_Mark before allocating and gives it back with
+FrameArena_Release when it is done, so the arena only ever holds what is on
+the call stack. G_RunFrame resets it at the start of each frame in case
+something didn't.
+
+Running out is a gi.error, the peak is printed by sv stats so
+FRAME_ARENA_SIZE can be checked against real levels.
+*/
+
+#define FRAME_ARENA_SIZE		(512 * 1024)
+#define FRAME_ARENA_ALIGN		16
+
+typedef struct frame_arena_s
+{
+	union
+	{
+		uint8_t	bytes[FRAME_ARENA_SIZE];
+		double	align;
+	} memory;
+
+	int32_t		used;
+	int32_t		peak;				// most ever in use at once
+	int32_t		frame_peak;			// ...this frame
+	int32_t		last_frame_peak;
+	int32_t		frame_allocs;
+	int32_t		last_frame_allocs;
+} frame_arena_t;
+
+static frame_arena_t	frame_arena;
+
+/*
+=============
+FrameArena_Reset
+
+Frees everything, called at the start of G_RunFrame
+=============
+*/
+void FrameArena_Reset()
+{
+	frame_arena.used = 0;
+	frame_arena.last_frame_peak = frame_arena.frame_peak;
+	frame_arena.last_frame_allocs = frame_arena.frame_allocs;
+	frame_arena.frame_peak = 0;
+	frame_arena.frame_allocs = 0;
+}
+
+/*
+=============
+FrameArena_Alloc
+
+Returns size bytes of uninitialised scratch memory
+=============
+*/
+void* FrameArena_Alloc(int32_t size)
+{
+	void*	p;
+	int32_t	start;
+
+	start = (frame_arena.used + FRAME_ARENA_ALIGN - 1) & ~(FRAME_ARENA_ALIGN - 1);
+
+	if (size < 0
+		|| start + size > FRAME_ARENA_SIZE)
+		gi.error("FrameArena_Alloc: %i bytes with %i of %i in use", size, frame_arena.used, FRAME_ARENA_SIZE);
+
+	p = frame_arena.memory.bytes + start;
+	frame_arena.used = start + size;
+	frame_arena.frame_allocs++;
+
+	if (frame_arena.used > frame_arena.frame_peak)
+		frame_arena.frame_peak = frame_arena.used;
+
+	if (frame_arena.used > frame_arena.peak)
+		frame_arena.peak = frame_arena.used;
+
+	return p;
+}
+
+/*
+=============
+FrameArena_Mark
+
+Returns the current top of the arena for FrameArena_Release
+=============
+*/
+int32_t FrameArena_Mark()
+{
+	return frame_arena.used;
+}
+
+/*
+=============
+FrameArena_Release
+
+Frees everything allocated since mark was taken
+=============
+*/
+void FrameArena_Release(int32_t mark)
+{
+	frame_arena.used = mark;
+}
+
+/*
+=============
+FrameArena_PrintStats
+
+Prints the arena's high-water marks for sv stats
+=============
+*/
+void FrameArena_PrintStats()
+{
+	gi.cprintf(NULL, PRINT_HIGH, "Frame arena:\n");
+	gi.cprintf(NULL, PRINT_HIGH, "  last frame  %5i bytes at most, %i allocations\n", frame_arena.last_frame_peak, frame_arena.last_frame_allocs);
+	gi.cprintf(NULL, PRINT_HIGH, "  peak      %7i bytes of %i\n", frame_arena.peak, FRAME_ARENA_SIZE);
+}
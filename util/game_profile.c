@@ -0,0 +1,573 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// game_profile.c -- frame profiler
+
+#include <game_local.h>
+
+void Game_Init();
+
+/*
+==============================================================================
+
+FRAME PROFILER
+
+==============================================================================
+
+Set sv_profile 1 and Game_RunFrame times each of its phases, every entity it
+runs (by class), every think and touch function it calls and every
+Game_Trace and Game_PointContents call site. The time each of them took is
+added up over the frame and kept for the last PROFILE_SAMPLES frames they ran
+in, "sv profile" prints the worst of them.
+
+With sv_profile 0 the only cost is a test of profile_enabled at each timing
+point.
+*/
+
+#define PROFILE_SAMPLES			128		// frames kept for the percentiles, must be a power of two
+#define PROFILE_MAX_FUNCTIONS	1024	// must be a power of two
+#define PROFILE_MAX_SITES		512		// must be a power of two
+
+typedef struct profile_ring_s
+{
+	int32_t		samples[PROFILE_SAMPLES];	// ns taken in each of the last frames it ran in
+	int32_t		head;						// next sample to write
+	int32_t		count;						// samples written, up to PROFILE_SAMPLES
+	int64_t		frame_ns;					// ns taken so far this frame
+	int32_t		frame_calls;				// times it ran this frame
+	int64_t		frames;						// frames it has run in
+	int64_t		calls;						// times it has run
+} profile_ring_t;
+
+typedef struct profile_function_s
+{
+	void*			function;
+	int32_t			kind;					// PROFILE_THINK or PROFILE_TOUCH
+	int32_t			classid;				// first class seen calling it, to tell them apart
+	profile_ring_t	ring;
+} profile_function_t;
+
+typedef struct profile_site_s
+{
+	const char*		function;				// __func__ of the caller
+	int32_t			line;
+	bool			point;					// pointcontents rather than trace
+	vec3_t			hull;					// largest box traced from here, zero for lines
+	profile_ring_t	ring;
+} profile_site_t;
+
+enum
+{
+	PROFILE_THINK,
+	PROFILE_TOUCH
+};
+
+static char* profile_phase_names[PROFILE_NUM_PHASES] =
+{
+	"frame",
+	"sight",
+	"flow fields",
+	"entities",
+	"projectiles",
+	"gamemode",
+	"client frames",
+};
+
+bool					profile_enabled;
+
+static profile_ring_t		profile_phases[PROFILE_NUM_PHASES];
+static profile_ring_t		profile_classes[MAX_CLASSES];
+static profile_function_t	profile_functions[PROFILE_MAX_FUNCTIONS];
+static int32_t				profile_num_functions;
+static profile_site_t		profile_sites[PROFILE_MAX_SITES];
+static int32_t				profile_num_sites;
+
+// everything that ran this frame, flushed into the rings by Profile_EndFrame
+static profile_ring_t*		profile_touched[PROFILE_NUM_PHASES + MAX_CLASSES + PROFILE_MAX_FUNCTIONS + PROFILE_MAX_SITES];
+static int32_t				profile_num_touched;
+
+/*
+=============
+Profile_Reset
+
+Forgets everything measured so far
+=============
+*/
+void Profile_Reset()
+{
+	memset(profile_phases, 0, sizeof(profile_phases));
+	memset(profile_classes, 0, sizeof(profile_classes));
+	memset(profile_functions, 0, sizeof(profile_functions));
+	profile_num_functions = 0;
+	memset(profile_sites, 0, sizeof(profile_sites));
+	profile_num_sites = 0;
+	profile_num_touched = 0;
+}
+
+static void Profile_Add(profile_ring_t* ring, int64_t ns)
+{
+	if (!ring->frame_calls)
+		profile_touched[profile_num_touched++] = ring;
+
+	ring->frame_ns += ns;
+	ring->frame_calls++;
+}
+
+static void Profile_Flush(profile_ring_t* ring)
+{
+	ring->samples[ring->head] = (ring->frame_ns > INT32_MAX) ? INT32_MAX : (int32_t)ring->frame_ns;
+	ring->head = (ring->head + 1) & (PROFILE_SAMPLES - 1);
+
+	if (ring->count < PROFILE_SAMPLES)
+		ring->count++;
+
+	ring->frames++;
+	ring->calls += ring->frame_calls;
+	ring->frame_ns = 0;
+	ring->frame_calls = 0;
+}
+
+/*
+=============
+Profile_BeginFrame
+
+Picks up changes to sv_profile, called at the start of every frame
+=============
+*/
+void Profile_BeginFrame()
+{
+	if (sv_profile->modified)
+	{
+		sv_profile->modified = false;
+		Profile_Reset();
+	}
+
+	profile_enabled = (sv_profile->value != 0);
+}
+
+/*
+=============
+Profile_EndFrame
+
+Files this frame's times in the rings
+=============
+*/
+void Profile_EndFrame()
+{
+	int32_t i;
+
+	if (!profile_enabled)
+		return;
+
+	for (i = 0; i < profile_num_touched; i++)
+		Profile_Flush(profile_touched[i]);
+
+	profile_num_touched = 0;
+}
+
+void Profile_AddPhase(int32_t phase, int64_t start)
+{
+	Profile_Add(&profile_phases[phase], Sys_Nanoseconds() - start);
+}
+
+void Profile_AddClass(int32_t classid, int64_t start)
+{
+	if (classid < 0 || classid >= MAX_CLASSES)
+		return;
+
+	Profile_Add(&profile_classes[classid], Sys_Nanoseconds() - start);
+}
+
+static profile_function_t* Profile_FindFunction(void* function, int32_t kind, int32_t classid)
+{
+	profile_function_t*	entry;
+	uint32_t			slot;
+
+	slot = (uint32_t)(((uintptr_t)function >> 4) * 2654435761u) & (PROFILE_MAX_FUNCTIONS - 1);
+
+	while (1)
+	{
+		entry = &profile_functions[slot];
+
+		if (entry->function == function
+			&& entry->kind == kind)
+			return entry;
+
+		if (!entry->function)
+		{
+			// keep one slot empty so lookups always end
+			if (profile_num_functions == PROFILE_MAX_FUNCTIONS - 1)
+				return NULL;
+
+			profile_num_functions++;
+			entry->function = function;
+			entry->kind = kind;
+			entry->classid = classid;
+			return entry;
+		}
+
+		slot = (slot + 1) & (PROFILE_MAX_FUNCTIONS - 1);
+	}
+}
+
+static void Profile_AddFunction(void* function, int32_t kind, int32_t classid, int64_t start)
+{
+	profile_function_t* entry;
+	int64_t				ns;
+
+	ns = Sys_Nanoseconds() - start;
+	entry = Profile_FindFunction(function, kind, classid);
+
+	if (entry)
+		Profile_Add(&entry->ring, ns);
+}
+
+/*
+=============
+Profile_CallThink
+
+Runs ent->think, timing it if the profiler is on
+=============
+*/
+void Profile_CallThink(edict_t* ent)
+{
+	void	(*think)(edict_t* self);
+	int64_t	start;
+	int32_t	classid;
+
+	if (!profile_enabled)
+	{
+		ent->think(ent);
+		return;
+	}
+
+	// the think can free the entity
+	think = ent->think;
+	classid = ent->classid;
+	start = Sys_Nanoseconds();
+	think(ent);
+	Profile_AddFunction((void*)think, PROFILE_THINK, classid, start);
+}
+
+/*
+=============
+Profile_CallTouch
+
+Runs self->touch, timing it if the profiler is on
+=============
+*/
+void Profile_CallTouch(edict_t* self, edict_t* other, cplane_t* plane, csurface_t* surf)
+{
+	void	(*touch)(edict_t* self, edict_t* other, cplane_t* plane, csurface_t* surf);
+	int64_t	start;
+	int32_t	classid;
+
+	if (!profile_enabled)
+	{
+		self->touch(self, other, plane, surf);
+		return;
+	}
+
+	touch = self->touch;
+	classid = self->classid;
+	start = Sys_Nanoseconds();
+	touch(self, other, plane, surf);
+	Profile_AddFunction((void*)touch, PROFILE_TOUCH, classid, start);
+}
+
+/*
+==============================================================================
+
+COLLISION SITES
+
+==============================================================================
+*/
+
+static profile_site_t* Profile_FindSite(const char* function, int32_t line, bool point)
+{
+	profile_site_t*	site;
+	uint32_t		slot;
+
+	slot = (uint32_t)((((uintptr_t)function >> 2) + line) * 2654435761u) & (PROFILE_MAX_SITES - 1);
+
+	while (1)
+	{
+		site = &profile_sites[slot];
+
+		if (site->function == function
+			&& site->line == line)
+			return site;
+
+		if (!site->function)
+		{
+			if (profile_num_sites == PROFILE_MAX_SITES - 1)
+				return NULL;
+
+			profile_num_sites++;
+			site->function = function;
+			site->line = line;
+			site->point = point;
+			return site;
+		}
+
+		slot = (slot + 1) & (PROFILE_MAX_SITES - 1);
+	}
+}
+
+/*
+=============
+Profile_Trace
+
+Game_Trace, timed and counted against the line that called it
+=============
+*/
+trace_t Profile_Trace(const char* function, int32_t line, vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, edict_t* passent, int32_t contentmask)
+{
+	profile_site_t*	site;
+	trace_t			trace;
+	int64_t			time;
+	int32_t			i;
+
+	time = Sys_Nanoseconds();
+	trace = TraceCache_Trace(start, mins, maxs, end, passent, contentmask);
+	time = Sys_Nanoseconds() - time;
+
+	site = Profile_FindSite(function, line, false);
+
+	if (!site)
+		return trace;
+
+	Profile_Add(&site->ring, time);
+
+	if (mins && maxs)
+	{
+		for (i = 0; i < 3; i++)
+		{
+			if (maxs[i] - mins[i] > site->hull[i])
+				site->hull[i] = maxs[i] - mins[i];
+		}
+	}
+
+	return trace;
+}
+
+/*
+=============
+Profile_PointContents
+
+gi.pointcontents, timed and counted against the line that called it
+=============
+*/
+int32_t Profile_PointContents(const char* function, int32_t line, vec3_t point)
+{
+	profile_site_t*	site;
+	int32_t			contents;
+	int64_t			time;
+
+	time = Sys_Nanoseconds();
+	contents = gi.pointcontents(point);
+	time = Sys_Nanoseconds() - time;
+
+	site = Profile_FindSite(function, line, true);
+
+	if (site)
+		Profile_Add(&site->ring, time);
+
+	return contents;
+}
+
+/*
+==============================================================================
+
+REPORTING
+
+==============================================================================
+*/
+
+typedef struct profile_summary_s
+{
+	char		name[64];
+	int64_t		total;			// ns over the window
+	int32_t		p50, p99, max;
+	float		calls;			// per frame it ran in
+} profile_summary_t;
+
+static int Profile_CompareSamples(const void* a, const void* b)
+{
+	int32_t s1 = *(int32_t*)a;
+	int32_t s2 = *(int32_t*)b;
+
+	return (s1 > s2) - (s1 < s2);
+}
+
+static int Profile_CompareSummaries(const void* a, const void* b)
+{
+	const profile_summary_t* s1 = a;
+	const profile_summary_t* s2 = b;
+
+	return (s1->total < s2->total) - (s1->total > s2->total);
+}
+
+static void Profile_Summarise(profile_ring_t* ring, profile_summary_t* summary)
+{
+	int32_t	sorted[PROFILE_SAMPLES];
+	int32_t	i;
+
+	summary->total = 0;
+
+	for (i = 0; i < ring->count; i++)
+	{
+		sorted[i] = ring->samples[i];
+		summary->total += sorted[i];
+	}
+
+	qsort(sorted, ring->count, sizeof(sorted[0]), Profile_CompareSamples);
+
+	summary->p50 = sorted[ring->count / 2];
+	summary->p99 = sorted[(ring->count * 99) / 100];
+	summary->max = sorted[ring->count - 1];
+	summary->calls = (float)ring->calls / ring->frames;
+}
+
+static void Profile_PrintSummary(profile_summary_t* summary)
+{
+	gi.cprintf(NULL, PRINT_HIGH, "%-40s %8.1f %8.1f %8.1f %8.1f\n", summary->name,
+		summary->p50 / 1000.0f, summary->p99 / 1000.0f, summary->max / 1000.0f, summary->calls);
+}
+
+/*
+=============
+Profile_Print
+
+sv profile [count]
+sv profile reset
+
+Prints the phases, then the count classes and functions that took the most
+time over the frames kept
+=============
+*/
+void Profile_Print(int32_t count)
+{
+	static profile_summary_t	summaries[MAX_CLASSES + PROFILE_MAX_FUNCTIONS + PROFILE_MAX_SITES];
+	profile_summary_t			summary;
+	profile_function_t*			entry;
+	profile_site_t*				site;
+	int32_t						i, num;
+
+	if (!profile_enabled)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "The profiler is off, set sv_profile 1 to turn it on\n");
+		return;
+	}
+
+	if (count <= 0)
+		count = 10;
+
+	gi.cprintf(NULL, PRINT_HIGH, "%-40s %8s %8s %8s %8s\n", "last frames (us)", "p50", "p99", "max", "calls");
+
+	for (i = 0; i < PROFILE_NUM_PHASES; i++)
+	{
+		if (!profile_phases[i].count)
+			continue;
+
+		Profile_Summarise(&profile_phases[i], &summary);
+		Com_sprintf(summary.name, sizeof(summary.name), "%s", profile_phase_names[i]);
+		Profile_PrintSummary(&summary);
+	}
+
+	AI_PrintLODStats();
+
+	// classes
+	num = 0;
+
+	for (i = 0; i < MAX_CLASSES; i++)
+	{
+		if (!profile_classes[i].count)
+			continue;
+
+		Profile_Summarise(&profile_classes[i], &summaries[num]);
+		Com_sprintf(summaries[num].name, sizeof(summaries[num].name), "class %s", i ? Class_Name(i) : "(none)");
+		num++;
+	}
+
+	qsort(summaries, num, sizeof(summaries[0]), Profile_CompareSummaries);
+
+	gi.cprintf(NULL, PRINT_HIGH, "\n");
+
+	for (i = 0; i < num && i < count; i++)
+		Profile_PrintSummary(&summaries[i]);
+
+	// think and touch functions, named by their offset like the save files do
+	num = 0;
+
+	for (i = 0; i < PROFILE_MAX_FUNCTIONS; i++)
+	{
+		entry = &profile_functions[i];
+
+		if (!entry->function
+			|| !entry->ring.count)
+			continue;
+
+		Profile_Summarise(&entry->ring, &summaries[num]);
+		Com_sprintf(summaries[num].name, sizeof(summaries[num].name), "%s %+lli (%s)",
+			(entry->kind == PROFILE_THINK) ? "think" : "touch",
+			(long long)((uint8_t*)entry->function - (uint8_t*)Game_Init),
+			entry->classid ? Class_Name(entry->classid) : "(none)");
+		num++;
+	}
+
+	qsort(summaries, num, sizeof(summaries[0]), Profile_CompareSummaries);
+
+	gi.cprintf(NULL, PRINT_HIGH, "\n");
+
+	for (i = 0; i < num && i < count; i++)
+		Profile_PrintSummary(&summaries[i]);
+
+	// collision queries by the line that made them
+	num = 0;
+
+	for (i = 0; i < PROFILE_MAX_SITES; i++)
+	{
+		site = &profile_sites[i];
+
+		if (!site->function
+			|| !site->ring.count)
+			continue;
+
+		Profile_Summarise(&site->ring, &summaries[num]);
+
+		if (site->point)
+			Com_sprintf(summaries[num].name, sizeof(summaries[num].name), "contents %s:%i", site->function, site->line);
+		else if (VectorCompare3(site->hull, vec3_origin))
+			Com_sprintf(summaries[num].name, sizeof(summaries[num].name), "trace %s:%i", site->function, site->line);
+		else
+			Com_sprintf(summaries[num].name, sizeof(summaries[num].name), "trace %s:%i %gx%gx%g", site->function, site->line,
+				site->hull[0], site->hull[1], site->hull[2]);
+
+		num++;
+	}
+
+	qsort(summaries, num, sizeof(summaries[0]), Profile_CompareSummaries);
+
+	gi.cprintf(NULL, PRINT_HIGH, "\n");
+
+	for (i = 0; i < num && i < count; i++)
+		Profile_PrintSummary(&summaries[i]);
+}
@@ -0,0 +1,362 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// game_strings.c -- interned level strings and the string table in saves
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+STRING POOL
+
+==============================================================================
+
+Every string spawn key (classname, target, targetname, message...) used to get
+its own TagMalloc, so a map with a hundred lights had a hundred copies of
+"light" scattered over the heap. ED_NewString now interns them instead: each
+distinct string is copied once into a slab taken from TAG_LEVEL, and a hash
+finds it again for the next entity that uses it. The slab is sized from the
+entity string, which no string key can be longer than, so it only runs out if
+something interns strings after the level has spawned. Those fall back to
+their own TagMalloc and are counted.
+
+Because the strings are shared, nothing may write into one. func_clock, the
+only entity that formats its own message, keeps a buffer of its own.
+
+Saves write every string the level's edicts, components and level locals
+point at once, as a table before the level locals, and string fields hold an
+index into it (0 for NULL) rather than a length followed by the string. The
+load reads the table straight into a new slab.
+*/
+
+#define STRING_HASH_SIZE		(MAX_EDICTS * 8)		// power of two, at most half full
+#define STRING_MAX				(STRING_HASH_SIZE / 2)
+#define STRING_POOL_SLACK		4096					// room left after a load for strings interned later
+
+typedef struct string_hash_s
+{
+	int32_t*	slots;				// index + 1 into strings, 0 if empty
+	char**		strings;
+	int32_t		count;
+} string_hash_t;
+
+typedef struct string_pool_s
+{
+	char*		slab;
+	int32_t		size;
+	int32_t		used;
+
+	int32_t		interned;			// calls to StringPool_Intern
+	int32_t		overflowed;			// ...that had to TagMalloc
+	int32_t		overflow_bytes;
+} string_pool_t;
+
+static int32_t			string_pool_slots[STRING_HASH_SIZE];
+static char*			string_pool_strings[STRING_MAX];
+
+static string_pool_t	string_pool;
+static string_hash_t	string_pool_hash = { string_pool_slots, string_pool_strings };
+
+// the table being saved or loaded, only exists inside Level_Write and Level_Read
+static string_hash_t	string_table;
+static int32_t			string_table_mark;
+static int32_t			string_table_bytes;
+
+/*
+=============
+StringHash_Find
+
+Returns the slot s is in, or the empty one it would go in
+=============
+*/
+static int32_t StringHash_Find(string_hash_t* hash, const char* s)
+{
+	int32_t	slot;
+
+	slot = Q_HashString(s) & (STRING_HASH_SIZE - 1);
+
+	while (hash->slots[slot]
+		&& strcmp(hash->strings[hash->slots[slot] - 1], s))
+		slot = (slot + 1) & (STRING_HASH_SIZE - 1);
+
+	return slot;
+}
+
+static void StringHash_Insert(string_hash_t* hash, int32_t slot, char* s)
+{
+	hash->strings[hash->count++] = s;
+	hash->slots[slot] = hash->count;
+}
+
+/*
+=============
+StringPool_Reset
+
+Takes a new size byte slab from TAG_LEVEL and forgets everything interned in
+the last one. Called after TAG_LEVEL is freed.
+=============
+*/
+void StringPool_Reset(int32_t size)
+{
+	memset(string_pool_slots, 0, sizeof(string_pool_slots));
+	string_pool_hash.count = 0;
+
+	string_pool.slab = (size > 0) ? gi.TagMalloc(size, TAG_LEVEL) : NULL;
+	string_pool.size = size;
+	string_pool.used = 0;
+	string_pool.interned = string_pool.overflowed = string_pool.overflow_bytes = 0;
+}
+
+/*
+=============
+StringPool_Intern
+
+Returns the pool's copy of s, adding it if it isn't there yet. The result is
+shared and must not be written to.
+=============
+*/
+char* StringPool_Intern(const char* s)
+{
+	char*	copy;
+	int32_t	slot, len;
+
+	string_pool.interned++;
+	slot = StringHash_Find(&string_pool_hash, s);
+
+	if (string_pool_slots[slot])
+		return string_pool_strings[string_pool_slots[slot] - 1];
+
+	len = (int32_t)strlen(s) + 1;
+
+	if (string_pool.used + len > string_pool.size
+		|| string_pool_hash.count >= STRING_MAX)
+	{
+		string_pool.overflowed++;
+		string_pool.overflow_bytes += len;
+		copy = gi.TagMalloc(len, TAG_LEVEL);
+		memcpy(copy, s, len);
+		return copy;
+	}
+
+	copy = string_pool.slab + string_pool.used;
+	memcpy(copy, s, len);
+	string_pool.used += len;
+
+	StringHash_Insert(&string_pool_hash, slot, copy);
+	return copy;
+}
+
+/*
+=============
+StringPool_Owns
+
+True if s is in the slab, and so may be shared
+=============
+*/
+bool StringPool_Owns(const char* s)
+{
+	return (s
+		&& string_pool.slab
+		&& s >= string_pool.slab
+		&& s < string_pool.slab + string_pool.size);
+}
+
+/*
+=============
+StringTable_Begin
+
+Starts an empty table for Level_Write, which adds every string it will save
+to it with StringTable_Add before writing it out
+=============
+*/
+void StringTable_Begin()
+{
+	string_table_mark = FrameArena_Mark();
+	string_table.slots = FrameArena_Array(int32_t, STRING_HASH_SIZE);
+	string_table.strings = FrameArena_Array(char*, STRING_MAX);
+	string_table.count = 0;
+	string_table_bytes = 0;
+
+	memset(string_table.slots, 0, STRING_HASH_SIZE * sizeof(int32_t));
+}
+
+/*
+=============
+StringTable_Add
+=============
+*/
+void StringTable_Add(char* s)
+{
+	int32_t	slot;
+
+	if (!s)
+		return;
+
+	slot = StringHash_Find(&string_table, s);
+
+	if (string_table.slots[slot])
+		return;
+
+	if (string_table.count >= STRING_MAX)
+		gi.error("StringTable_Add: more than %i strings to save", STRING_MAX);
+
+	StringHash_Insert(&string_table, slot, s);
+	string_table_bytes += (int32_t)strlen(s) + 1;
+}
+
+/*
+=============
+StringTable_Index
+
+Returns what a string field is saved as, 0 for NULL
+=============
+*/
+int32_t StringTable_Index(char* s)
+{
+	int32_t	slot;
+
+	if (!s)
+		return 0;
+
+	slot = StringHash_Find(&string_table, s);
+
+	if (!string_table.slots[slot])
+		gi.error("StringTable_Index: \"%s\" isn't in the string table", s);
+
+	return string_table.slots[slot];
+}
+
+/*
+=============
+StringTable_Write
+
+Writes the table as a count, a size in bytes and then every string
+=============
+*/
+void StringTable_Write(FILE* f)
+{
+	int32_t	i;
+
+	fwrite(&string_table.count, sizeof(string_table.count), 1, f);
+	fwrite(&string_table_bytes, sizeof(string_table_bytes), 1, f);
+
+	for (i = 0; i < string_table.count; i++)
+		fwrite(string_table.strings[i], strlen(string_table.strings[i]) + 1, 1, f);
+}
+
+/*
+=============
+StringTable_Read
+
+Reads a table written by StringTable_Write into a new pool slab, after
+TAG_LEVEL has been freed
+=============
+*/
+void StringTable_Read(FILE* f)
+{
+	char*	s;
+	char*	end;
+	int32_t	count, bytes, slot;
+
+	if (fread(&count, sizeof(count), 1, f) != 1
+		|| fread(&bytes, sizeof(bytes), 1, f) != 1
+		|| count < 0 || count > STRING_MAX
+		|| bytes < count)
+		gi.error("StringTable_Read: bad string table");
+
+	StringPool_Reset(bytes + STRING_POOL_SLACK);
+
+	if (bytes
+		&& fread(string_pool.slab, bytes, 1, f) != 1)
+		gi.error("StringTable_Read: string table is truncated");
+
+	string_table_mark = FrameArena_Mark();
+	string_table.strings = FrameArena_Array(char*, count);
+	string_table.count = 0;
+
+	// the strings were all different when they were written, so the slab is already the pool
+	s = string_pool.slab;
+	end = string_pool.slab + bytes;
+
+	while (string_table.count < count)
+	{
+		if (s >= end
+			|| !memchr(s, 0, end - s))
+			gi.error("StringTable_Read: string table is truncated");
+
+		slot = StringHash_Find(&string_pool_hash, s);
+
+		if (!string_pool_slots[slot])
+			StringHash_Insert(&string_pool_hash, slot, s);
+
+		string_table.strings[string_table.count++] = s;
+		s += strlen(s) + 1;
+	}
+
+	string_pool.used = bytes;
+}
+
+/*
+=============
+StringTable_Get
+
+Returns the string a field was saved as index for
+=============
+*/
+char* StringTable_Get(int32_t index)
+{
+	if (!index)
+		return NULL;
+
+	if (index < 0
+		|| index > string_table.count)
+		gi.error("StringTable_Get: bad string index %i", index);
+
+	return string_table.strings[index - 1];
+}
+
+/*
+=============
+StringTable_End
+
+Frees the table, once the level has been written or read
+=============
+*/
+void StringTable_End()
+{
+	FrameArena_Release(string_table_mark);
+	memset(&string_table, 0, sizeof(string_table));
+}
+
+/*
+=============
+StringPool_PrintStats
+
+Prints the pool for sv stats
+=============
+*/
+void StringPool_PrintStats()
+{
+	gi.cprintf(NULL, PRINT_HIGH, "Level strings:\n");
+	gi.cprintf(NULL, PRINT_HIGH, "  interned    %5i (%i distinct, %i bytes of %i)\n",
+		string_pool.interned, string_pool_hash.count, string_pool.used, string_pool.size);
+	gi.cprintf(NULL, PRINT_HIGH, "  overflowed  %5i (%i bytes)\n", string_pool.overflowed, string_pool.overflow_bytes);
+}
@@ -0,0 +1,287 @@
+/*
+Copyright (C) 1997-2001 Id Software, Inc.
+Copyright (C) 2023-2024 starfrost
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// game_trace.c -- frame timeline recorder
+
+#include <game_local.h>
+
+/*
+==============================================================================
+
+TIMELINE RECORDER
+
+==============================================================================
+
+"sv trace start" records begin and end events for frames, entities, monster
+thinks, damage, spawning and saving into a fixed buffer, and writes them to a
+JSON file in the Chrome trace event format (chrome://tracing, ui.perfetto.dev).
+
+Nothing is formatted while the events are being recorded, the buffer is
+written out after each frame (outside the frame's own event) and before a
+new level reuses the class ids the events are named by. If a frame fills it the
+rest of that frame's events are dropped, keeping room for the end events of
+everything already begun so the file stays balanced.
+*/
+
+#define TRACE_MAX_EVENTS	65536
+
+typedef struct trace_event_s
+{
+	const char*	name;			// NULL for end events
+	int64_t		time;			// Sys_Nanoseconds
+	int32_t		arg;			// edict number or frame, -1 for none
+	char		phase;			// 'B' or 'E'
+} trace_event_t;
+
+bool					trace_enabled;
+
+static trace_event_t*	trace_events;
+static int32_t			trace_num_events;
+static int32_t			trace_depth;			// begun and recorded, not yet ended
+static int32_t			trace_dropped_depth;	// begun and dropped, not yet ended
+static int64_t			trace_dropped;
+static int64_t			trace_written;
+static int64_t			trace_start_time;
+static int32_t			trace_frames_left;		// stop after this many frames, 0 to run until stopped
+static FILE*			trace_file;
+static char				trace_filename[MAX_QPATH * 2];
+
+/*
+=============
+Trace_BeginEvent
+
+Records the start of name, arg is the edict or frame number (or -1)
+=============
+*/
+void Trace_BeginEvent(const char* name, int32_t arg)
+{
+	trace_event_t* event;
+
+	// leave room for the ends of everything already begun
+	if (trace_dropped_depth
+		|| trace_num_events + trace_depth + 1 >= TRACE_MAX_EVENTS)
+	{
+		trace_dropped_depth++;
+		trace_dropped++;
+		return;
+	}
+
+	event = &trace_events[trace_num_events++];
+	event->name = name;
+	event->time = Sys_Nanoseconds();
+	event->arg = arg;
+	event->phase = 'B';
+	trace_depth++;
+}
+
+/*
+=============
+Trace_EndEvent
+
+Records the end of the last thing begun
+=============
+*/
+void Trace_EndEvent()
+{
+	trace_event_t* event;
+
+	if (trace_dropped_depth)
+	{
+		trace_dropped_depth--;
+		return;
+	}
+
+	if (!trace_depth)
+		return;
+
+	event = &trace_events[trace_num_events++];
+	event->name = NULL;
+	event->time = Sys_Nanoseconds();
+	event->arg = -1;
+	event->phase = 'E';
+	trace_depth--;
+}
+
+// classnames come from the map, so they may need escaping
+static void Trace_WriteString(const char* string)
+{
+	fputc('"', trace_file);
+
+	for (; *string; string++)
+	{
+		if (*string == '"' || *string == '\\')
+			fputc('\\', trace_file);
+
+		if ((uint8_t)*string >= ' ')
+			fputc(*string, trace_file);
+	}
+
+	fputc('"', trace_file);
+}
+
+/*
+=============
+Trace_Flush
+
+Writes out the buffered events
+=============
+*/
+void Trace_Flush()
+{
+	trace_event_t*	event;
+	int32_t			i;
+	double			us;
+
+	if (!trace_file)
+		return;
+
+	for (i = 0; i < trace_num_events; i++)
+	{
+		event = &trace_events[i];
+		us = (event->time - trace_start_time) / 1000.0;
+
+		if (event->phase == 'E')
+		{
+			fprintf(trace_file, ",\n{\"ph\":\"E\",\"ts\":%.3f,\"pid\":1,\"tid\":1}", us);
+		}
+		else
+		{
+			fprintf(trace_file, ",\n{\"name\":");
+			Trace_WriteString(event->name);
+			fprintf(trace_file, ",\"ph\":\"B\",\"ts\":%.3f,\"pid\":1,\"tid\":1", us);
+
+			if (event->arg >= 0)
+				fprintf(trace_file, ",\"args\":{\"n\":%i}", event->arg);
+
+			fprintf(trace_file, "}");
+		}
+	}
+
+	trace_written += trace_num_events;
+	trace_num_events = 0;
+}
+
+/*
+=============
+Trace_Start
+
+sv trace start [frames] [filename]
+=============
+*/
+void Trace_Start(int32_t frames, char* filename)
+{
+	cvar_t* game;
+
+	if (trace_file)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Already tracing to %s\n", trace_filename);
+		return;
+	}
+
+	if (filename && filename[0])
+	{
+		Com_sprintf(trace_filename, sizeof(trace_filename), "%s", filename);
+	}
+	else
+	{
+		game = gi.Cvar_Get("game_asset_path", "", 0);
+		Com_sprintf(trace_filename, sizeof(trace_filename), "%s/trace.json", game->string[0] ? game->string : GAME_NAME);
+	}
+
+	trace_file = fopen(trace_filename, "w");
+
+	if (!trace_file)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Couldn't open %s\n", trace_filename);
+		return;
+	}
+
+	trace_events = gi.TagMalloc(TRACE_MAX_EVENTS * sizeof(trace_events[0]), TAG_GAME);
+	trace_num_events = trace_depth = trace_dropped_depth = 0;
+	trace_dropped = trace_written = 0;
+	trace_frames_left = frames;
+	trace_start_time = Sys_Nanoseconds();
+
+	fprintf(trace_file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	fprintf(trace_file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"game\"}}");
+
+	trace_enabled = true;
+
+	if (frames > 0)
+		gi.cprintf(NULL, PRINT_HIGH, "Tracing %i frames to %s\n", frames, trace_filename);
+	else
+		gi.cprintf(NULL, PRINT_HIGH, "Tracing to %s, \"sv trace stop\" to finish\n", trace_filename);
+}
+
+/*
+=============
+Trace_Stop
+
+Writes out the rest of the events and closes the file
+=============
+*/
+void Trace_Stop()
+{
+	if (!trace_file)
+		return;
+
+	// close anything still open so the viewer doesn't stretch it to the end
+	while (trace_depth)
+		Trace_EndEvent();
+
+	Trace_Flush();
+
+	fprintf(trace_file, "\n]}\n");
+	fclose(trace_file);
+	trace_file = NULL;
+	trace_enabled = false;
+
+	gi.TagFree(trace_events);
+	trace_events = NULL;
+
+	gi.cprintf(NULL, PRINT_HIGH, "Wrote %lli events to %s", (long long)trace_written, trace_filename);
+
+	if (trace_dropped)
+		gi.cprintf(NULL, PRINT_HIGH, " (%lli dropped, the buffer filled up)", (long long)trace_dropped);
+
+	gi.cprintf(NULL, PRINT_HIGH, "\n");
+}
+
+/*
+=============
+Trace_EndFrame
+
+Called between frames to write out the frame's events
+=============
+*/
+void Trace_EndFrame()
+{
+	if (!trace_enabled)
+		return;
+
+	if (trace_frames_left > 0
+		&& --trace_frames_left == 0)
+	{
+		Trace_Stop();
+		return;
+	}
+
+	Trace_Flush();
+}
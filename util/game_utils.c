@@ -22,6 +22,10 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 
 #include <game_local.h>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 
 void Game_ProjectSource(vec3_t point, vec3_t distance, vec3_t forward, vec3_t right, vec3_t result)
 {
@@ -47,15 +51,8 @@ edict_t* Game_FindEdictByValue(edict_t* from, int32_t fieldofs, char* match)
 {
 	char* s;
 
-	if (!from)
-		from = g_edicts;
-	else
-		from++;
-
-	for (; from < &g_edicts[globals.num_edicts]; from++)
+	for (from = EdictList_Next(from); from; from = EdictList_Next(from))
 	{
-		if (!from->inuse)
-			continue;
 		s = *(char**)((uint8_t*)from + fieldofs);
 		if (!s)
 			continue;
@@ -81,14 +78,8 @@ edict_t* Game_FindEdictsWithinRadius(edict_t* from, vec3_t org, float rad)
 	vec3_t	eorg;
 	int32_t	j;
 
-	if (!from)
-		from = g_edicts;
-	else
-		from++;
-	for (; from < &g_edicts[globals.num_edicts]; from++)
+	for (from = EdictList_Next(from); from; from = EdictList_Next(from))
 	{
-		if (!from->inuse)
-			continue;
 		if (from->solid == SOLID_NOT)
 			continue;
 		for (j = 0; j < 3; j++)
@@ -101,6 +92,142 @@ edict_t* Game_FindEdictsWithinRadius(edict_t* from, vec3_t org, float rad)
 	return NULL;
 }
 
+/*
+==============================================================================
+
+TARGETNAME INDEX
+
+==============================================================================
+
+Every edict with a targetname is chained into a hash bucket keyed on the
+lowercased name. Each chain is kept sorted by edict number, so walking it
+visits matches in the same order as a full G_Find scan would.
+*/
+
+#define TARGETNAME_HASH_SIZE	256
+
+edict_t*	targetname_hash[TARGETNAME_HASH_SIZE];
+
+void Targetname_Link(edict_t* ent)
+{
+	edict_t**	link;
+	int32_t		bucket;
+
+	if (ent->targetname_linked)
+		Targetname_Unlink(ent);
+
+	if (!ent->targetname)
+		return;
+
+	bucket = Q_HashStringNoCase(ent->targetname) & (TARGETNAME_HASH_SIZE - 1);
+
+	for (link = &targetname_hash[bucket]; *link && *link < ent; link = &(*link)->targetname_next)
+		;
+
+	ent->targetname_next = *link;
+	ent->targetname_bucket = bucket;
+	ent->targetname_linked = true;
+	*link = ent;
+}
+
+void Targetname_Unlink(edict_t* ent)
+{
+	edict_t** link;
+
+	if (!ent->targetname_linked)
+		return;
+
+	for (link = &targetname_hash[ent->targetname_bucket]; *link; link = &(*link)->targetname_next)
+	{
+		if (*link == ent)
+		{
+			*link = ent->targetname_next;
+			break;
+		}
+	}
+
+	ent->targetname_next = NULL;
+	ent->targetname_linked = false;
+}
+
+void Targetname_Clear()
+{
+	memset(targetname_hash, 0, sizeof(targetname_hash));
+}
+
+/*
+=============
+Targetname_Rebuild
+
+Relinks every edict, after the edicts have been loaded
+=============
+*/
+void Targetname_Rebuild()
+{
+	int32_t		i;
+	edict_t*	ent;
+
+	Targetname_Clear();
+
+	// walk backwards so every link goes on the front of its chain
+	for (i = globals.num_edicts - 1; i >= 0; i--)
+	{
+		ent = &g_edicts[i];
+		ent->targetname_next = NULL;
+		ent->targetname_linked = false;
+
+		if (ent->inuse)
+			Targetname_Link(ent);
+	}
+}
+
+/*
+=============
+Edict_SetTargetname
+
+Changes an edict's targetname at runtime
+=============
+*/
+void Edict_SetTargetname(edict_t* ent, char* targetname)
+{
+	ent->targetname = targetname;
+	Targetname_Link(ent);
+}
+
+/*
+=============
+Edict_FindByTargetname
+
+G_Find (from, FOFS(targetname), targetname) through the targetname index.
+Returns the next edict after from with a matching targetname, or the first
+one if from is NULL. from doesn't have to still be linked, so it is fine to
+free matches while iterating.
+=============
+*/
+edict_t* Edict_FindByTargetname(edict_t* from, char* targetname)
+{
+	edict_t*	ent;
+	int32_t		bucket;
+
+	bucket = Q_HashStringNoCase(targetname) & (TARGETNAME_HASH_SIZE - 1);
+
+	if (from && from->targetname_linked && from->targetname_bucket == bucket)
+		ent = from->targetname_next;
+	else
+	{
+		for (ent = targetname_hash[bucket]; ent && from && ent <= from; ent = ent->targetname_next)
+			;
+	}
+
+	for (; ent; ent = ent->targetname_next)
+	{
+		if (!Q_stricmp(ent->targetname, targetname))
+			return ent;
+	}
+
+	return NULL;
+}
+
 /*
 =============
 G_PickTarget
@@ -129,7 +256,7 @@ edict_t* Edict_PickTarget(char* targetname)
 
 	while (1)
 	{
-		ent = Game_FindEdictByValue(ent, FOFS(targetname), targetname);
+		ent = Edict_FindByTargetname(ent, targetname);
 		if (!ent)
 			break;
 		choice[num_choices++] = ent;
@@ -179,8 +306,8 @@ void Edict_UseTargets(edict_t* ent, edict_t* activator)
 	{
 		// create a temp object to fire at a later time
 		t = Edict_Spawn();
-		t->classname = "DelayedUse";
-		t->nextthink = level.time + ent->delay;
+		Edict_SetClassname(t, "DelayedUse");
+		Edict_SetNextThink(t, level.time + ent->delay);
 		t->think = Think_Delay;
 		t->activator = activator;
 		if (!activator)
@@ -210,7 +337,7 @@ void Edict_UseTargets(edict_t* ent, edict_t* activator)
 	if (ent->killtarget)
 	{
 		t = NULL;
-		while ((t = Game_FindEdictByValue(t, FOFS(targetname), ent->killtarget)))
+		while ((t = Edict_FindByTargetname(t, ent->killtarget)))
 		{
 			Edict_Free(t);
 			if (!ent->inuse)
@@ -227,11 +354,11 @@ void Edict_UseTargets(edict_t* ent, edict_t* activator)
 	if (ent->target)
 	{
 		t = NULL;
-		while ((t = Game_FindEdictByValue(t, FOFS(targetname), ent->target)))
+		while ((t = Edict_FindByTargetname(t, ent->target)))
 		{
 			// doors fire area portals in a specific way
-			if (!Q_stricmp(t->classname, "func_areaportal") &&
-				(!Q_stricmp(ent->classname, "func_door") || !Q_stricmp(ent->classname, "func_door_rotating")))
+			if (t->classid == CLASS_FUNC_AREAPORTAL &&
+				(ent->classid == CLASS_FUNC_DOOR || ent->classid == CLASS_FUNC_DOOR_ROTATING))
 				continue;
 
 			if (t == ent)
@@ -396,12 +523,266 @@ char* Game_CopyString(char* in)
 }
 
 
+/*
+==============================================================================
+
+LIVE EDICT LIST
+
+==============================================================================
+
+One bit per edict slot that is in use. Loops over the live entities walk the
+set bits in edict number order, so they skip runs of free slots 32 at a time
+and stay valid when entities are spawned or freed while iterating.
+*/
+
+#define EDICT_LIST_WORDS	(MAX_EDICTS / 32)
+
+uint32_t	edict_list_bits[EDICT_LIST_WORDS];
+int32_t		edict_list_count;				// number of live edicts
+
+static int32_t EdictList_LowestBit(uint32_t word)
+{
+#ifdef _MSC_VER
+	unsigned long	index;
+
+	_BitScanForward(&index, word);
+	return (int32_t)index;
+#else
+	return __builtin_ctz(word);
+#endif
+}
+
+void EdictList_Add(edict_t* ent)
+{
+	int32_t	num = ent - g_edicts;
+
+	if (edict_list_bits[num >> 5] & (1u << (num & 31)))
+		return;
+
+	edict_list_bits[num >> 5] |= (1u << (num & 31));
+	edict_list_count++;
+}
+
+void EdictList_Remove(edict_t* ent)
+{
+	int32_t	num = ent - g_edicts;
+
+	if (!(edict_list_bits[num >> 5] & (1u << (num & 31))))
+		return;
+
+	edict_list_bits[num >> 5] &= ~(1u << (num & 31));
+	edict_list_count--;
+}
+
+void EdictList_Clear()
+{
+	memset(edict_list_bits, 0, sizeof(edict_list_bits));
+	edict_list_count = 0;
+}
+
+/*
+=============
+EdictList_Rebuild
+
+Rebuilds the list from the inuse flags, after the edicts have been loaded
+=============
+*/
+void EdictList_Rebuild()
+{
+	int32_t		i;
+	edict_t*	ent;
+
+	EdictList_Clear();
+
+	for (i = 0, ent = g_edicts; i < globals.num_edicts; i++, ent++)
+	{
+		if (ent->inuse)
+			EdictList_Add(ent);
+	}
+}
+
+/*
+=============
+EdictList_Next
+
+Returns the next live edict after from, or the first one if from is NULL.
+NULL will be returned if the end of the list is reached.
+=============
+*/
+edict_t* EdictList_Next(edict_t* from)
+{
+	int32_t		num, word;
+	uint32_t	bits;
+
+	num = (from) ? (int32_t)(from - g_edicts) + 1 : 0;
+
+	if (num >= globals.num_edicts)
+		return NULL;
+
+	word = num >> 5;
+	bits = edict_list_bits[word] & (0xFFFFFFFFu << (num & 31));
+
+	while (!bits)
+	{
+		if (++word >= EDICT_LIST_WORDS)
+			return NULL;
+
+		bits = edict_list_bits[word];
+	}
+
+	num = (word << 5) + EdictList_LowestBit(bits);
+
+	if (num >= globals.num_edicts)
+		return NULL;
+
+	return &g_edicts[num];
+}
+
 void Edict_Init(edict_t* e)
 {
 	e->inuse = true;
-	e->classname = "noclass";
+	Edict_SetClassname(e, "noclass");
 	e->gravity = 1.0;
 	e->s.number = e - g_edicts;
+
+	EdictList_Add(e);
+}
+
+/*
+==============================================================================
+
+FREE EDICT QUEUE
+
+==============================================================================
+
+Freed slots are pushed onto the back of a ring buffer as they are freed, so it
+is always ordered by freetime. G_Spawn only has to look at the front of it: if
+that slot is still in its reuse delay then so is every slot behind it.
+*/
+
+int32_t		edict_queue[MAX_EDICTS];
+int32_t		edict_queue_head;
+int32_t		edict_queue_count;
+
+edict_stats_t	edict_stats;
+
+static void EdictQueue_Push(edict_t* ent)
+{
+	if (edict_queue_count >= MAX_EDICTS)
+		return;
+
+	edict_queue[(edict_queue_head + edict_queue_count) % MAX_EDICTS] = ent - g_edicts;
+	edict_queue_count++;
+}
+
+/*
+=============
+EdictQueue_Rebuild
+
+Refills the queue from every free slot, after the edicts have been wiped or loaded
+=============
+*/
+void EdictQueue_Rebuild()
+{
+	int32_t		i;
+	edict_t*	ent;
+
+	edict_queue_head = edict_queue_count = 0;
+
+	for (i = sv_maxclients->value + 1, ent = &g_edicts[i]; i < globals.num_edicts; i++, ent++)
+	{
+		if (!ent->inuse
+			&& !ProjectilePool_Owns(ent))
+			EdictQueue_Push(ent);
+	}
+}
+
+/*
+=============
+EdictQueue_Release
+
+Puts a slot that was cleared without going through G_FreeEdict back in the queue
+=============
+*/
+void EdictQueue_Release(edict_t* ent)
+{
+	if ((ent - g_edicts) <= sv_maxclients->value
+		|| ProjectilePool_Owns(ent))
+		return;
+
+	EdictQueue_Push(ent);
+}
+
+/*
+=================
+Edict_FindFree
+
+Takes a slot from the front of the free queue, or a new one off the end.
+Returns NULL if every slot is in use.
+=================
+*/
+static edict_t* Edict_FindFree()
+{
+	edict_t* e = NULL;
+
+	while (edict_queue_count)
+	{
+		e = &g_edicts[edict_queue[edict_queue_head]];
+
+		// taken by something that didn't go through the queue
+		if (e->inuse)
+		{
+			edict_queue_head = (edict_queue_head + 1) % MAX_EDICTS;
+			edict_queue_count--;
+			e = NULL;
+			continue;
+		}
+
+		// the first couple seconds of server time can involve a lot of
+		// freeing and allocating, so relax the replacement policy
+		if (e->freetime < 2 || level.time - e->freetime > 0.5)
+		{
+			edict_queue_head = (edict_queue_head + 1) % MAX_EDICTS;
+			edict_queue_count--;
+		}
+		else
+		{
+			e = NULL;
+		}
+
+		break;
+	}
+
+	if (!e)
+	{
+		if (globals.num_edicts == game.maxentities)
+			return NULL;
+
+		e = &g_edicts[globals.num_edicts++];
+	}
+
+	return e;
+}
+
+static void Edict_CountSpawn()
+{
+	// allocation stats for sv stats
+	edict_stats.allocs++;
+	edict_stats.window_allocs++;
+
+	if (level.time - edict_stats.window_start >= 1.0f
+		|| level.time < edict_stats.window_start)
+	{
+		edict_stats.rate = edict_stats.window_allocs;
+		edict_stats.window_allocs = 0;
+		edict_stats.window_start = level.time;
+	}
+
+	if (edict_list_count > edict_stats.peak_live)
+		edict_stats.peak_live = edict_list_count;
+
+	if (globals.num_edicts > edict_stats.peak_edicts)
+		edict_stats.peak_edicts = globals.num_edicts;
 }
 
 /*
@@ -417,29 +798,154 @@ angles and bad trails.
 */
 edict_t* Edict_Spawn()
 {
-	int32_t	i;
 	edict_t* e;
 
-	e = &g_edicts[(int32_t)sv_maxclients->value + 1];
-	for (i = sv_maxclients->value + 1; i < globals.num_edicts; i++, e++)
-	{
-		// the first couple seconds of server time can involve a lot of
-		// freeing and allocating, so relax the replacement policy
-		if (!e->inuse && (e->freetime < 2 || level.time - e->freetime > 0.5))
-		{
-			Edict_Init(e);
-			return e;
-		}
-	}
+	e = Edict_FindFree();
 
-	if (i == game.maxentities)
+	if (!e)
 		gi.error("ED_Alloc: no free edicts");
 
-	globals.num_edicts++;
 	Edict_Init(e);
+	Edict_CountSpawn();
+	return e;
+}
+
+/*
+=================
+Edict_TrySpawn
+
+Like Edict_Spawn, but returns NULL instead of failing when no more than
+reserve free edicts are left, for things the game can do without
+=================
+*/
+edict_t* Edict_TrySpawn(int32_t reserve)
+{
+	edict_t* e;
+
+	// slots never handed out yet, and freed ones (some may still be in their reuse delay)
+	if (game.maxentities - globals.num_edicts + edict_queue_count <= reserve)
+		return NULL;
+
+	e = Edict_FindFree();
+
+	if (!e)
+		return NULL;
+
+	Edict_Init(e);
+	Edict_CountSpawn();
 	return e;
 }
 
+/*
+=================
+Edict_Recycle
+
+Clears an edict that is still in use and hands it straight back, for pools
+that would rather reuse their oldest entity than find a new one. The client
+sees it jump, so set s.event to EV_OTHER_TELEPORT once it has been moved.
+=================
+*/
+edict_t* Edict_Recycle(edict_t* e)
+{
+	Edict_Unlink(e);
+
+	ThinkWheel_Remove(e);
+	ThinkWheel_Uncarry(e);
+	EdictList_Remove(e);
+	Targetname_Unlink(e);
+	Class_Unlink(e);
+	GibPool_Remove(e);
+	Batch_Remove(e);
+	Component_RemoveAll(e);
+
+	memset(e, 0, sizeof(*e));
+	Edict_Init(e);
+	Edict_CountSpawn();
+	return e;
+}
+
+/*
+=================
+Edict_PrintStats
+
+Prints the edict allocator state for sv stats
+=================
+*/
+void Edict_PrintStats()
+{
+	int32_t		i, quarantined, asleep, resting;
+	edict_t*	e;
+
+	quarantined = 0;
+	asleep = resting = 0;
+
+	for (i = 0; i < edict_queue_count; i++)
+	{
+		e = &g_edicts[edict_queue[(edict_queue_head + i) % MAX_EDICTS]];
+
+		if (!e->inuse && e->freetime >= 2 && level.time - e->freetime <= 0.5)
+			quarantined++;
+	}
+
+	for (e = EdictList_Next(NULL); e; e = EdictList_Next(e))
+	{
+		if (!e->think_asleep)
+			continue;
+
+		asleep++;
+
+		if (e->movetype != MOVETYPE_NONE)
+			resting++;
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "Edicts:\n");
+	gi.cprintf(NULL, PRINT_HIGH, "  live        %5i (peak %i)\n", edict_list_count, edict_stats.peak_live);
+	gi.cprintf(NULL, PRINT_HIGH, "  allocated   %5i (peak %i, max %i)\n", globals.num_edicts, edict_stats.peak_edicts, game.maxentities);
+	gi.cprintf(NULL, PRINT_HIGH, "  free queue  %5i (%i waiting out reuse delay)\n", edict_queue_count, quarantined);
+	gi.cprintf(NULL, PRINT_HIGH, "  spawns      %5i (%i in the last second)\n", edict_stats.allocs, edict_stats.rate);
+	gi.cprintf(NULL, PRINT_HIGH, "  asleep      %5i (%i at rest on the ground)\n", asleep, resting);
+}
+
+/*
+=================
+Edict_Link
+
+Links ent into the world. The game keeps its own indexes of what is linked
+where, so everything has to call this rather than gi.Edict_Link. The order
+matters: the trace cache has to see ent before the engine links it, as it
+checks area.prev to tell whether ent was linked already, and the rest read the
+absmin and absmax the engine works out.
+=================
+*/
+void Edict_Link(edict_t* ent)
+{
+	TraceCache_Invalidate(ent, true);
+
+	gi.Edict_Link(ent);
+
+	ThinkWheel_Link(ent);		// wakes ent and whatever is asleep on it
+	Spatial_Link(ent);
+	Batch_Link(ent);
+}
+
+/*
+=================
+Edict_Unlink
+
+Takes ent out of the world and the game's indexes, in the same order as
+Edict_Link
+=================
+*/
+void Edict_Unlink(edict_t* ent)
+{
+	TraceCache_Invalidate(ent, false);
+
+	gi.Edict_Unlink(ent);
+
+	ThinkWheel_Unlink(ent);
+	Spatial_Unlink(ent);
+}
+
 /*
 =================
 G_FreeEdict
@@ -449,7 +955,9 @@ Marks the edict as free
 */
 void Edict_Free(edict_t* ed)
 {
-	gi.Edict_Unlink(ed);		// unlink from world
+	bool	inuse;
+
+	Edict_Unlink(ed);		// unlink from world
 
 	if ((ed - g_edicts) <= (sv_maxclients->value + BODY_QUEUE_SIZE))
 	{
@@ -457,10 +965,30 @@ void Edict_Free(edict_t* ed)
 		return;
 	}
 
+	ThinkWheel_Remove(ed);
+	ThinkWheel_Uncarry(ed);
+	EdictList_Remove(ed);
+	Targetname_Unlink(ed);
+	Class_Unlink(ed);
+	GibPool_Remove(ed);
+	Batch_Remove(ed);
+	Component_RemoveAll(ed);
+
+	inuse = ed->inuse;
+
 	memset(ed, 0, sizeof(*ed));
 	ed->classname = "freed";
 	ed->freetime = level.time;
 	ed->inuse = false;
+
+	// don't queue the same slot twice if it gets freed again
+	if (!inuse)
+		return;
+
+	if (ProjectilePool_Owns(ed))
+		ProjectilePool_Release(ed);
+	else
+		EdictQueue_Push(ed);
 }
 
 
@@ -472,14 +1000,16 @@ G_TouchTriggers
 */
 void Edict_TouchTriggers(edict_t* ent)
 {
-	int32_t  i, num;
-	edict_t* touch[MAX_EDICTS], * hit;
+	int32_t  i, num, mark;
+	edict_t** touch, * hit;
 
 	// dead things don't activate triggers!
 	if ((ent->client || (ent->svflags & SVF_MONSTER)) && (ent->health <= 0))
 		return;
 
-	num = gi.BoxEdicts(ent->absmin, ent->absmax, touch, MAX_EDICTS, AREA_TRIGGERS);
+	mark = FrameArena_Mark();
+	touch = FrameArena_Array(edict_t*, globals.num_edicts);
+	num = gi.BoxEdicts(ent->absmin, ent->absmax, touch, globals.num_edicts, AREA_TRIGGERS);
 
 	// be careful, it is possible to have an entity in this
 	// list removed before we get to it (killtriggered)
@@ -490,8 +1020,10 @@ void Edict_TouchTriggers(edict_t* ent)
 			continue;
 		if (!hit->touch)
 			continue;
-		hit->touch(hit, ent, NULL, NULL);
+		Profile_CallTouch(hit, ent, NULL, NULL);
 	}
+
+	FrameArena_Release(mark);
 }
 
 /*
@@ -504,10 +1036,12 @@ to force all entities it covers to immediately touch it
 */
 void Edict_TouchSolids(edict_t* ent)
 {
-	int32_t		i, num;
-	edict_t* touch[MAX_EDICTS], * hit;
+	int32_t		i, num, mark;
+	edict_t**	touch, * hit;
 
-	num = gi.BoxEdicts(ent->absmin, ent->absmax, touch, MAX_EDICTS, AREA_SOLID);
+	mark = FrameArena_Mark();
+	touch = FrameArena_Array(edict_t*, globals.num_edicts);
+	num = gi.BoxEdicts(ent->absmin, ent->absmax, touch, globals.num_edicts, AREA_SOLID);
 
 	// be careful, it is possible to have an entity in this
 	// list removed before we get to it (killtriggered)
@@ -521,6 +1055,8 @@ void Edict_TouchSolids(edict_t* ent)
 		if (!ent->inuse)
 			break;
 	}
+
+	FrameArena_Release(mark);
 }
 
 /*
@@ -545,7 +1081,7 @@ bool Game_KillBox(edict_t* ent)
 
 	while (1)
 	{
-		tr = gi.trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin, NULL, MASK_PLAYERSOLID);
+		tr = Game_Trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin, NULL, MASK_PLAYERSOLID);
 		if (!tr.ent)
 			break;
 
@@ -663,3 +1199,157 @@ void GameUI_SetImage(edict_t* ent, char* ui_name, char* control_name, char* imag
 		gi.unicast(ent, reliable); // reliable as not used regularly
 	}
 }
+
+/*
+==============================================================================
+
+PERFECT HASH
+
+==============================================================================
+
+Collision free lookup tables for the fixed name tables (spawn functions,
+fields, items), built once at startup with hash and displace: keys are
+grouped into buckets by their hash, then starting with the fullest bucket
+each one is given the smallest displacement that puts all of its keys into
+free slots. A lookup is one hash, one table read and one string compare.
+*/
+
+static uint32_t PerfectHash_Mix(uint32_t hash, uint32_t displace)
+{
+	hash ^= displace * 0x9E3779B9u;
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6Bu;
+	hash ^= hash >> 13;
+	return hash;
+}
+
+/*
+=============
+PerfectHash_Build
+
+key(i) returns the name of entry i, or NULL to leave it out. When two
+entries have the same name the first one wins, same as a linear search.
+=============
+*/
+void PerfectHash_Build(perfect_hash_t* hash, int32_t count, char* (*key)(int32_t index))
+{
+	uint32_t	hashes[PERFECT_HASH_SIZE];
+	int16_t		bucket_keys[PERFECT_HASH_SIZE][PERFECT_HASH_MAX_BUCKET];
+	int32_t		bucket_count[PERFECT_HASH_SIZE];
+	int32_t		order[PERFECT_HASH_SIZE];
+	int32_t		size, i, j, k, b, slot, tries;
+	uint32_t	displace;
+	char*		name;
+
+	if (count > PERFECT_HASH_SIZE)
+		gi.error("PerfectHash_Build: %i keys, max is %i", count, PERFECT_HASH_SIZE);
+
+	// buckets and slots are both the next power of two up from the key count
+	for (size = 1; size < count; size <<= 1)
+		;
+
+	hash->mask = size - 1;
+	memset(bucket_count, 0, sizeof(bucket_count));
+
+	for (i = 0; i < PERFECT_HASH_SIZE; i++)
+	{
+		hash->slots[i] = -1;
+		hash->displace[i] = 0;
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		name = key(i);
+
+		if (!name)
+			continue;
+
+		hashes[i] = Q_HashStringNoCase(name);
+		b = hashes[i] & hash->mask;
+
+		// drop later duplicates
+		for (j = 0; j < bucket_count[b]; j++)
+		{
+			if (!Q_stricmp(key(bucket_keys[b][j]), name))
+				break;
+		}
+
+		if (j < bucket_count[b])
+			continue;
+
+		if (bucket_count[b] == PERFECT_HASH_MAX_BUCKET)
+			gi.error("PerfectHash_Build: too many keys hash to the same bucket as %s", name);
+
+		bucket_keys[b][bucket_count[b]++] = i;
+	}
+
+	// place the fullest buckets first while there is the most room
+	for (i = 0; i <= hash->mask; i++)
+		order[i] = i;
+
+	for (i = 1; i <= hash->mask; i++)
+	{
+		b = order[i];
+
+		for (j = i; j > 0 && bucket_count[order[j - 1]] < bucket_count[b]; j--)
+			order[j] = order[j - 1];
+
+		order[j] = b;
+	}
+
+	for (i = 0; i <= hash->mask; i++)
+	{
+		b = order[i];
+
+		if (!bucket_count[b])
+			break;
+
+		for (displace = 0, tries = 0; ; displace++, tries++)
+		{
+			if (tries > 1 << 20)
+				gi.error("PerfectHash_Build: couldn't place bucket %i", b);
+
+			for (j = 0; j < bucket_count[b]; j++)
+			{
+				slot = PerfectHash_Mix(hashes[bucket_keys[b][j]], displace) & hash->mask;
+
+				if (hash->slots[slot] != -1)
+					break;
+
+				// keys in the same bucket can't share a slot either
+				for (k = 0; k < j; k++)
+				{
+					if ((PerfectHash_Mix(hashes[bucket_keys[b][k]], displace) & hash->mask) == slot)
+						break;
+				}
+
+				if (k < j)
+					break;
+			}
+
+			if (j == bucket_count[b])
+				break;
+		}
+
+		hash->displace[b] = displace;
+
+		for (j = 0; j < bucket_count[b]; j++)
+			hash->slots[PerfectHash_Mix(hashes[bucket_keys[b][j]], displace) & hash->mask] = bucket_keys[b][j];
+	}
+}
+
+/*
+=============
+PerfectHash_Find
+
+Returns the index of the only entry that could be called name, or -1. The
+caller still has to compare the name, as anything not in the table hashes
+to some slot too.
+=============
+*/
+int32_t PerfectHash_Find(perfect_hash_t* hash, char* name)
+{
+	uint32_t h = Q_HashStringNoCase(name);
+
+	return hash->slots[PerfectHash_Mix(h, hash->displace[h & hash->mask]) & hash->mask];
+}
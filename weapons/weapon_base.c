@@ -46,7 +46,7 @@ void Player_ProjectSource(edict_t* ent, vec3_t distance, vec3_t forward, vec3_t
 		VectorSet3(start, ent->s.origin[0], ent->s.origin[1], ent->s.origin[2] + ent->viewheight);
 		VectorMA3(start, 8192, forward, end);
 
-		trace_t	tr = gi.trace(start, NULL, NULL, end, ent, MASK_SHOT);
+		trace_t	tr = Game_Trace(start, NULL, NULL, end, ent, MASK_SHOT);
 		if (tr.fraction < 1)
 		{
 			VectorSubtract3(tr.endpos, result, forward);
@@ -87,7 +87,7 @@ void Player_Noise(edict_t* who, vec3_t where, int32_t type)
 	if (!who->mynoise)
 	{
 		noise = Edict_Spawn();
-		noise->classname = "player_noise";
+		Edict_SetClassname(noise, "player_noise");
 		VectorSet3(noise->mins, -8, -8, -8);
 		VectorSet3(noise->maxs, 8, 8, 8);
 		noise->owner = who;
@@ -95,7 +95,7 @@ void Player_Noise(edict_t* who, vec3_t where, int32_t type)
 		who->mynoise = noise;
 
 		noise = Edict_Spawn();
-		noise->classname = "player_noise";
+		Edict_SetClassname(noise, "player_noise");
 		VectorSet3(noise->mins, -8, -8, -8);
 		VectorSet3(noise->maxs, 8, 8, 8);
 		noise->owner = who;
@@ -120,7 +120,7 @@ void Player_Noise(edict_t* who, vec3_t where, int32_t type)
 	VectorSubtract3(where, noise->maxs, noise->absmin);
 	VectorAdd3(where, noise->maxs, noise->absmax);
 	noise->teleport_time = level.time;
-	gi.Edict_Link(noise);
+	Edict_Link(noise);
 }
 
 
@@ -128,7 +128,7 @@ bool Weapon_Pickup(edict_t* ent, edict_t* other)
 {
 	int32_t		index;
 	gitem_t*	ammo;
-	loadout_entry_t* loadout_ptr = Loadout_GetItem(other, ent->item->pickup_name);
+	gloadout_entry_t* loadout_ptr = Loadout_FindItem(other, ent->item);
 
 	if (!loadout_ptr)
 		loadout_ptr = Loadout_AddItem(other, ent->item->pickup_name, ent->item->icon, loadout_entry_type_weapon, 1);
@@ -154,7 +154,7 @@ bool Weapon_Pickup(edict_t* ent, edict_t* other)
 	if (!(ent->spawnflags & DROPPED_ITEM))
 	{
 		// give them some ammo with it
-		ammo = Item_FindByPickupName(ent->item->ammo);
+		ammo = ent->item->ammo_item;
 
 		if (ammo)
 		{
@@ -236,9 +236,9 @@ void Player_WeaponChange(edict_t* ent)
 
 	if (ent->client->pers.weapon && ent->client->pers.weapon->ammo)
 	{
-		gitem_t* item_ammo = Item_FindByPickupName(ent->client->pers.weapon->ammo);
+		gitem_t* item_ammo = ent->client->pers.weapon->ammo_item;
 
-		loadout_entry_t* item_ammo_loadout_ptr = Loadout_GetItem(ent, item_ammo->pickup_name);
+		gloadout_entry_t* item_ammo_loadout_ptr = Loadout_FindItem(ent, item_ammo);
 
 		// if the ammo is not already there, add it (failsafe, really shouldn't happen)
 		if (!item_ammo_loadout_ptr)
@@ -311,7 +311,7 @@ void Player_WeaponChangeNoAmmo(edict_t* ent)
 	}
 
 	//required as super shotgun uses 2 bullets
-	loadout_entry_t* bullets = Loadout_GetItem(ent, "bullets");
+	gloadout_entry_t* bullets = Loadout_GetItem(ent, "bullets");
 
 	if (bullets != NULL
 		&& bullets->amount >= 2
@@ -377,8 +377,8 @@ void Weapon_Use(edict_t* ent, gitem_t* item)
 
 	if (item->ammo && !g_select_empty->value && !(item->flags & IT_AMMO))
 	{
-		ammo_item = Item_FindByPickupName(item->ammo);
-		loadout_entry_t* ammo_item_loadout_ptr = Loadout_GetItem(ent, ammo_item->pickup_name);
+		ammo_item = item->ammo_item;
+		gloadout_entry_t* ammo_item_loadout_ptr = Loadout_FindItem(ent, ammo_item);
 
 		if (ammo_item_loadout_ptr == NULL
 			|| ammo_item_loadout_ptr->amount == 0)
@@ -411,7 +411,7 @@ void Weapon_Drop(edict_t* ent, gitem_t* item)
 	if ((int32_t)(gameflags->value) & GF_WEAPONS_STAY)
 		return;
 
-	loadout_entry_t* loadout_ptr = Loadout_GetItem(ent, item->pickup_name);
+	gloadout_entry_t* loadout_ptr = Loadout_FindItem(ent, item);
 
 	// see if we're already using it
 	if (((item == ent->client->pers.weapon) || (item == ent->client->newweapon)) && loadout_ptr->amount == 1)
@@ -33,7 +33,7 @@ void Chaingun_Fire(edict_t* ent)
 	vec3_t	offset = { 0 };
 	int32_t	damage;
 	int32_t	kick = 2;
-	loadout_entry_t* loadout_ptr = Loadout_GetItem(ent, "chaingun");
+	gloadout_entry_t* loadout_ptr = Loadout_GetItem(ent, "chaingun");
 
 	damage = 6;
 
@@ -143,7 +143,7 @@ void Chaingun_Fire(edict_t* ent)
 
 	if (!((int32_t)gameflags->value & GF_INFINITE_AMMO))
 	{
-		loadout_entry_t* entry_ptr = Loadout_GetItem(ent, "bullets");
+		gloadout_entry_t* entry_ptr = Loadout_GetItem(ent, "bullets");
 		entry_ptr->amount -= shots;
 	}
 }